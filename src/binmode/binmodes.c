@@ -106,6 +106,7 @@ const binmode_t binmodes[] = {
         .psu_en_voltage = 0,
         .psu_en_current = 0,  
         .button_to_exit = false,      
+        .service_in_yield = true,
         .binmode_name = dirtyproto_mode_name,
         .binmode_setup = dirtyproto_mode_setup,
         .binmode_service = dirtyproto_mode,
@@ -214,6 +215,10 @@ inline void binmode_setup(void) {
 }
 
 inline void binmode_service(void) {
+    // the scope frame stream has the binary USB port
+    if (system_config.binmode_usb_paused) {
+        return;
+    }
     //exit on button press
     if(binmodes[system_config.binmode_select].button_to_exit) {
         char c;
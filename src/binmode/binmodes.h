@@ -20,6 +20,7 @@ typedef struct _binmode {
     bool reset_to_hiz;
     bool pullup_enabled;
     bool button_to_exit;
+    bool service_in_yield; // also serviced from tasks_yield(), must refuse hardware requests there
     float psu_en_voltage;
     float psu_en_current;
     const char* binmode_name;
@@ -54,9 +54,19 @@
 #include "binmode/bpio_led.h"
 #include "binmode/bpio_infrared.h"
 #include "binmode/bpio_uart.h"
+#include "binmode/bpio_hash.h"
+#include "binmode/bpio_jtag.h"
+#include "pirate/hash.h"
+#include "display/scope.h"
 #include "mode/hiz.h"
 #include "mode/hw2wire.h"
 #include "mode/hwuart.h"
+#include "mode/jtag.h"
+#include "pirate/jtag_pio.h"
+#include "mode/hwled.h"
+#include "pirate/led_frame.h"
+#include "pirate/perf.h"
+#include "pirate/tasks.h"
 
 const char dirtyproto_mode_name[] = "BPIO2 flatbuffer interface";
 uint32_t time_start, time_end;
@@ -66,6 +76,7 @@ uint32_t time_start, time_end;
 #define BPIO_MAX_PACKET_SIZE 640
 #define BPIO_MAX_WRITE_SIZE 512
 #define BPIO_MAX_READ_SIZE  512
+#define BPIO_SCOPE_MAX_SAMPLES ((BPIO_MAX_READ_SIZE / 3) * 2) // 12 bit packed, 3 bytes per 2 samples
 #define BPIO_MAX_COBS_SIZE BPIO_MAX_PACKET_SIZE+((BPIO_MAX_PACKET_SIZE + 254) / 254) 
 
 // A helper to simplify creating vectors from C-arrays.
@@ -124,8 +135,8 @@ static const struct bpio_mode_handlers_t bpio_mode_handlers[count_of(modes)] = {
         .bpio_handler = NULL, //bpio_infrared_transaction
     },
     [JTAG]={
-        .bpio_configure = NULL,
-        .bpio_handler = NULL
+        .bpio_configure = bpio_jtag_configure,
+        .bpio_handler = bpio_jtag_transaction
     },
     [HWUART]={
         .bpio_configure = bpio_hwuart_configure,
@@ -171,11 +182,12 @@ bool mode_change_new(const char *mode_name, bpio_mode_configuration_t *mode_conf
 }
 
 static inline void send_packet(flatcc_builder_t *B, uint8_t *cobs_buf) {
+    PERF_START(PERF_BPIO_SEND);
     uint8_t* buf;
     size_t len = flatcc_builder_get_buffer_size(B);
     if(bpio_debug) printf("[Send Packet] Length %d\r\n", len);
          
-    buf = flatcc_builder_finalize_buffer(B, &len); //23uS
+    buf = flatcc_builder_finalize_buffer(B, &len);
 
     //uint8_t cobs_buf[BPIO_MAX_PACKET_SIZE + BPIO_MAX_PACKET_SIZE/256]; // COBS encoded buffer, + COBS overhead
     // Encode the buffer using COBS
@@ -192,7 +204,7 @@ static inline void send_packet(flatcc_builder_t *B, uint8_t *cobs_buf) {
     if(bpio_debug) printf("[Send Packet] COBS encoded buffer length: %zu\r\n", cobs_len);
 
     uint8_t *buf_ptr = cobs_buf;
-    while (cobs_len) { //80uS
+    while (cobs_len) {
         if (tud_cdc_n_write_available(CDC_INTF) >= 64) {
             uint32_t chunk_size = (cobs_len > 64) ? 64 : cobs_len;
             tud_cdc_n_write(CDC_INTF, buf_ptr, chunk_size);
@@ -201,11 +213,13 @@ static inline void send_packet(flatcc_builder_t *B, uint8_t *cobs_buf) {
             cobs_len -= chunk_size;
         }
     }
+    PERF_END(PERF_BPIO_SEND);
 }
 
 uint32_t status_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf) {
     const char *error = NULL;
     uint32_t query_flags=0;
+    bool perf_reset_request=false;
 
     bpio_StatusRequest_table_t status_request = (bpio_StatusRequest_table_t) bpio_RequestPacket_contents(packet);
     if(status_request == 0) {
@@ -227,6 +241,7 @@ uint32_t status_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B,
             }
             if(bpio_debug) printf("\r\n");
         }
+        perf_reset_request = bpio_StatusRequest_perf_reset(status_request);
     }
 
     bpio_StatusResponse_start(B);
@@ -333,6 +348,43 @@ uint32_t status_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B,
         bpio_StatusResponse_disk_used_mb_add(B, 0.0f); //todo: implement disk free space    
     }
 
+    // timing probes
+    if(query_flags & (1u << bpio_StatusRequestTypes_Perf) || query_flags & (1u << bpio_StatusRequestTypes_All)) {
+        if(bpio_debug) printf("[Status Request] Perf probes requested\r\n");
+        struct perf_stats stats[PERF_PROBE_COUNT];
+        bpio_StatusResponse_perf_probes_start(B);
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            const char *name = perf_get(i, &stats[i]);
+            bpio_StatusResponse_perf_probes_push(B, flatbuffers_string_create_str(B, name));
+        }
+        bpio_StatusResponse_perf_probes_end(B);
+        bpio_StatusResponse_perf_count_start(B);
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            bpio_StatusResponse_perf_count_push(B, &stats[i].count);
+        }
+        bpio_StatusResponse_perf_count_end(B);
+        bpio_StatusResponse_perf_min_us_start(B);
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            bpio_StatusResponse_perf_min_us_push(B, &stats[i].min_us);
+        }
+        bpio_StatusResponse_perf_min_us_end(B);
+        bpio_StatusResponse_perf_max_us_start(B);
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            bpio_StatusResponse_perf_max_us_push(B, &stats[i].max_us);
+        }
+        bpio_StatusResponse_perf_max_us_end(B);
+        bpio_StatusResponse_perf_avg_us_start(B);
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            bpio_StatusResponse_perf_avg_us_push(B, &stats[i].avg_us);
+        }
+        bpio_StatusResponse_perf_avg_us_end(B);
+    }
+
+    // reset after reporting so one request can read and clear
+    if(perf_reset_request) {
+        perf_reset();
+    }
+
     if(error) {
         bpio_StatusResponse_error_add(B, flatbuffers_string_create_str(B, error));
     }
@@ -692,6 +744,262 @@ data_response_error:
     send_packet(B, buf);
 }
 
+uint32_t hash_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf) {
+    bpio_HashRequest_table_t hash_request = (bpio_HashRequest_table_t) bpio_RequestPacket_contents(packet);
+    test_assert(hash_request != 0);
+
+    const char *target = NULL;
+    if(bpio_HashRequest_target_is_present(hash_request)) {
+        target = bpio_HashRequest_target(hash_request);
+    }
+    bool sha256 = bpio_HashRequest_sha256(hash_request);
+
+    if(bpio_debug) {
+        printf("[Hash Request] Target: %s\r\n", target ? target : "(none)");
+        printf("[Hash Request] Start: 0x%08X, length: %d\r\n", bpio_HashRequest_start_address(hash_request), bpio_HashRequest_length(hash_request));
+    }
+
+    hash_ctx_t hash;
+    uint8_t digest[HASH_SHA256_BYTES];
+    hash_init(&hash, sha256);
+    const char *error = bpio_hash_target(target,
+                                         bpio_HashRequest_start_address(hash_request),
+                                         bpio_HashRequest_length(hash_request),
+                                         bpio_HashRequest_i2c_address(hash_request),
+                                         bpio_HashRequest_data_lines(hash_request),
+                                         &hash);
+    hash_final(&hash, digest);
+
+    bpio_HashResponse_start(B);
+    if(error) {
+        flatbuffers_string_ref_t error_str = flatbuffers_string_create_str(B, error);
+        bpio_HashResponse_error_add(B, error_str);
+        if(bpio_debug) printf("[Hash Request] Error: %s\r\n", error);
+    } else {
+        bpio_HashResponse_length_add(B, hash.bytes);
+        bpio_HashResponse_crc32_add(B, hash.crc32);
+        if(sha256) {
+            bpio_HashResponse_sha256_create(B, digest, HASH_SHA256_BYTES);
+        }
+    }
+    bpio_HashResponse_ref_t hash_response = bpio_HashResponse_end(B);
+    // add to packet wrapper
+    bpio_ResponsePacket_start_as_root(B);
+    bpio_ResponsePacket_contents_HashResponse_add(B, hash_response);
+    bpio_ResponsePacket_end_as_root(B);
+    send_packet(B, buf);
+}
+
+uint32_t scope_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf) {
+    bpio_ScopeRequest_table_t scope_request = (bpio_ScopeRequest_table_t) bpio_RequestPacket_contents(packet);
+    test_assert(scope_request != 0);
+
+    const char *error = NULL;
+    if(bpio_ScopeRequest_stop(scope_request)) {
+        if(!scope_remote_stop()) error = "Scope display not active";
+    }
+    if(!error && bpio_ScopeRequest_run(scope_request)) {
+        if(!scope_remote_run(bpio_ScopeRequest_run_pin(scope_request), bpio_ScopeRequest_run_mode(scope_request))) {
+            error = "Scope display not active";
+        }
+    }
+
+    scope_frame_info_t info = {0};
+    uint32_t offset = bpio_ScopeRequest_sample_offset(scope_request);
+    uint32_t count = bpio_ScopeRequest_sample_count(scope_request);
+    uint8_t samples[BPIO_MAX_READ_SIZE];
+    // run or stop without a sample count doesn't read, there may be no frame yet
+    bool control_only = (bpio_ScopeRequest_run(scope_request) || bpio_ScopeRequest_stop(scope_request)) && count == 0;
+    bool have_frame = !error && scope_frame_get_info(&info);
+    if(!error && !control_only && !have_frame) {
+        error = "No frame";
+    }
+    if(control_only) {
+        offset = 0;
+        info.running = bpio_ScopeRequest_run(scope_request) && !bpio_ScopeRequest_stop(scope_request);
+    } else if(!error) {
+        uint32_t sequence = bpio_ScopeRequest_sequence(scope_request);
+        if(sequence && sequence != info.sequence) {
+            error = "frame changed";
+        } else if(offset > info.samples) {
+            error = "Offset beyond frame";
+        } else {
+            if(count == 0 || count > BPIO_SCOPE_MAX_SAMPLES) count = BPIO_SCOPE_MAX_SAMPLES;
+            if(count > info.samples - offset) count = info.samples - offset;
+            if(!scope_frame_read(info.sequence, offset, count, samples)) {
+                error = "frame changed";
+            }
+        }
+    }
+
+    if(bpio_debug && !error) {
+        printf("[Scope Request] Frame %d, offset %d, count %d\r\n", info.sequence, offset, count);
+    }
+
+    bpio_ScopeResponse_start(B);
+    if(error) {
+        flatbuffers_string_ref_t error_str = flatbuffers_string_create_str(B, error);
+        bpio_ScopeResponse_error_add(B, error_str);
+        if(bpio_debug) printf("[Scope Request] Error: %s\r\n", error);
+    } else {
+        bpio_ScopeResponse_sequence_add(B, info.sequence);
+        bpio_ScopeResponse_running_add(B, info.running);
+        bpio_ScopeResponse_pin_add(B, info.pin);
+        bpio_ScopeResponse_sample_rate_hz_add(B, info.sample_rate_hz);
+        bpio_ScopeResponse_trigger_type_add(B, info.trigger_type);
+        bpio_ScopeResponse_trigger_level_mv_add(B, info.trigger_level_mv);
+        bpio_ScopeResponse_trigger_index_add(B, info.trigger_index);
+        bpio_ScopeResponse_counts_per_5v_add(B, SCOPE_COUNTS_5V);
+        bpio_ScopeResponse_frame_samples_add(B, info.samples);
+        bpio_ScopeResponse_sample_offset_add(B, offset);
+        bpio_ScopeResponse_sample_count_add(B, count);
+        if(count) bpio_ScopeResponse_samples_create(B, samples, (count * 3 + 1) / 2);
+    }
+    bpio_ScopeResponse_ref_t scope_response = bpio_ScopeResponse_end(B);
+    // add to packet wrapper
+    bpio_ResponsePacket_start_as_root(B);
+    bpio_ResponsePacket_contents_ScopeResponse_add(B, scope_response);
+    bpio_ResponsePacket_end_as_root(B);
+    send_packet(B, buf);
+}
+
+uint32_t jtag_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf) {
+    bpio_JtagRequest_table_t jtag_request = (bpio_JtagRequest_table_t) bpio_RequestPacket_contents(packet);
+    test_assert(jtag_request != 0);
+
+    const char *error = NULL;
+    uint8_t shift = bpio_JtagRequest_shift(jtag_request);
+    uint32_t shift_bits = bpio_JtagRequest_shift_bits(jtag_request);
+    bool read_tdo = bpio_JtagRequest_read_tdo(jtag_request);
+    uint8_t swd_ack = 0;
+    uint32_t swd_data = bpio_JtagRequest_swd_data(jtag_request);
+    static uint8_t tdi[BPIO_MAX_READ_SIZE];
+    uint8_t tdo[BPIO_MAX_READ_SIZE];
+
+    // check everything before any pin moves
+    flatbuffers_uint8_vec_t tms = bpio_JtagRequest_tms(jtag_request);
+    uint32_t tms_bits = bpio_JtagRequest_tms_bits(jtag_request);
+    uint32_t tms_len = tms ? flatbuffers_uint8_vec_len(tms) : 0;
+    if(tms_bits == 0) tms_bits = tms_len * 8;
+    flatbuffers_uint8_vec_t tdi_vec = bpio_JtagRequest_tdi(jtag_request);
+    uint32_t tdi_len = tdi_vec ? flatbuffers_uint8_vec_len(tdi_vec) : 0;
+    bool swd = jtag_engine_swd();
+
+    if(system_config.mode != JTAG) {
+        error = "Not in JTAG mode";
+    } else if(tms_bits > tms_len * 8) {
+        error = "TMS bits beyond tms";
+    } else if(shift > 4) {
+        error = "Unknown shift";
+    } else if(shift && swd) {
+        error = "Shift in SWD mode";
+    } else if(shift && (shift_bits == 0 || shift_bits > BPIO_MAX_READ_SIZE * 8)) {
+        error = "Shift bits out of range";
+    } else if(bpio_JtagRequest_swd_transfer(jtag_request) && !swd) {
+        error = "SWD transfer in JTAG mode";
+    }
+
+    if(!error) {
+        jtag_engine_start();
+        if(bpio_JtagRequest_reset(jtag_request)) {
+            if(swd) {
+                swd_pio_line_reset();
+            } else {
+                jtag_pio_reset();
+            }
+        }
+        if(tms_bits) {
+            jtag_pio_tms(tms, tms_bits);
+        }
+        if(shift) {
+            uint32_t shift_bytes = (shift_bits + 7) / 8;
+            memset(tdi, 0xff, shift_bytes);
+            if(tdi_len) memcpy(tdi, tdi_vec, MIN(tdi_len, shift_bytes));
+            if(shift <= 2) {
+                jtag_pio_scan(shift == 1, tdi, read_tdo ? tdo : NULL, shift_bits);
+            } else {
+                jtag_pio_shift(tdi, read_tdo ? tdo : NULL, shift_bits, shift == 4);
+            }
+        }
+        if(bpio_JtagRequest_swd_transfer(jtag_request)) {
+            swd_ack = swd_pio_transfer(bpio_JtagRequest_swd_ap(jtag_request),
+                                       bpio_JtagRequest_swd_read(jtag_request),
+                                       bpio_JtagRequest_swd_addr(jtag_request),
+                                       &swd_data);
+        }
+    }
+
+    if(bpio_debug) {
+        printf("[JTAG Request] TMS %d bits, shift %d, %d bits, SWD ACK %d\r\n", tms_bits, shift, shift_bits, swd_ack);
+    }
+
+    bpio_JtagResponse_start(B);
+    if(error) {
+        flatbuffers_string_ref_t error_str = flatbuffers_string_create_str(B, error);
+        bpio_JtagResponse_error_add(B, error_str);
+        if(bpio_debug) printf("[JTAG Request] Error: %s\r\n", error);
+    } else {
+        if(shift && read_tdo) {
+            bpio_JtagResponse_tdo_create(B, tdo, (shift_bits + 7) / 8);
+        }
+        if(bpio_JtagRequest_swd_transfer(jtag_request)) {
+            bpio_JtagResponse_swd_ack_add(B, swd_ack);
+            bpio_JtagResponse_swd_data_add(B, swd_data);
+        }
+    }
+    bpio_JtagResponse_ref_t jtag_response = bpio_JtagResponse_end(B);
+    // add to packet wrapper
+    bpio_ResponsePacket_start_as_root(B);
+    bpio_ResponsePacket_contents_JtagResponse_add(B, jtag_response);
+    bpio_ResponsePacket_end_as_root(B);
+    send_packet(B, buf);
+}
+
+uint32_t led_frame_request(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf) {
+    bpio_LedFrameRequest_table_t frame_request = (bpio_LedFrameRequest_table_t) bpio_RequestPacket_contents(packet);
+    test_assert(frame_request != 0);
+
+    const char *error = NULL;
+    uint32_t leds = bpio_LedFrameRequest_leds(frame_request);
+    uint32_t first = bpio_LedFrameRequest_first(frame_request);
+    flatbuffers_uint8_vec_t pixels = bpio_LedFrameRequest_pixels(frame_request);
+    uint32_t pixels_len = pixels ? flatbuffers_uint8_vec_len(pixels) : 0;
+
+    if(system_config.mode != HWLED) {
+        error = "Not in LED mode";
+    } else if(pixels_len % 3) {
+        error = "Pixels must be 3 bytes per LED";
+    } else if(!hwled_frame_start()) {
+        error = "Frames need a WS2812 or APA102 strip";
+    } else {
+        led_frame_lut(bpio_LedFrameRequest_brightness(frame_request), bpio_LedFrameRequest_gamma(frame_request));
+        if(!led_frame_set(leds, first, pixels, pixels_len / 3)) {
+            error = "LEDs out of range";
+        } else if(bpio_LedFrameRequest_show(frame_request)) {
+            led_frame_show();
+        }
+    }
+
+    if(bpio_debug) {
+        printf("[LED Frame] %d LEDs from %d, strip %d, frame %d\r\n", pixels_len / 3, first, led_frame_leds(), led_frame_count());
+    }
+
+    bpio_LedFrameResponse_start(B);
+    if(error) {
+        flatbuffers_string_ref_t error_str = flatbuffers_string_create_str(B, error);
+        bpio_LedFrameResponse_error_add(B, error_str);
+        if(bpio_debug) printf("[LED Frame] Error: %s\r\n", error);
+    }
+    bpio_LedFrameResponse_leds_add(B, led_frame_leds());
+    bpio_LedFrameResponse_frames_add(B, led_frame_count());
+    bpio_LedFrameResponse_ref_t frame_response = bpio_LedFrameResponse_end(B);
+    // add to packet wrapper
+    bpio_ResponsePacket_start_as_root(B);
+    bpio_ResponsePacket_contents_LedFrameResponse_add(B, frame_response);
+    bpio_ResponsePacket_end_as_root(B);
+    send_packet(B, buf);
+}
+
 struct _bpio_function_t {
     uint32_t (*func)(bpio_RequestPacket_table_t packet, flatcc_builder_t *B, uint8_t *buf);
 };
@@ -701,6 +1009,10 @@ const static struct _bpio_function_t bpio_handlers[]={
     [bpio_RequestPacketContents_StatusRequest] = { .func = status_request },
     [bpio_RequestPacketContents_ConfigurationRequest] = { .func = configuration_request },
     [bpio_RequestPacketContents_DataRequest] = { .func = data_request },
+    [bpio_RequestPacketContents_HashRequest] = { .func = hash_request },
+    [bpio_RequestPacketContents_ScopeRequest] = { .func = scope_request },
+    [bpio_RequestPacketContents_JtagRequest] = { .func = jtag_request },
+    [bpio_RequestPacketContents_LedFrameRequest] = { .func = led_frame_request },
 };
 
 void bpio_check_async_data(flatcc_builder_t *B, uint8_t *buf) {
@@ -788,7 +1100,8 @@ void dirtyproto_mode(void) {
     
     // Check for async data if no request is pending
     if (!tud_cdc_n_available(CDC_INTF)) {
-        if(tud_cdc_n_connected(CDC_INTF)){
+        // under a command the mode's bus belongs to the command
+        if(tud_cdc_n_connected(CDC_INTF) && !tasks_yielding()){
             bpio_check_async_data(B, buf);
         }
         return; // No data available, exit early
@@ -837,7 +1150,9 @@ bpio_mode_read_end:
 
     // nanocobs decode the buffer
     size_t decoded_len;
+    PERF_START(PERF_BPIO_DECODE);
     cobs_ret_t const cobs_result = cobs_decode(buf, len, buf, sizeof(buf), &decoded_len);
+    PERF_END(PERF_BPIO_DECODE);
     if(cobs_result != COBS_RET_SUCCESS) {
         if(bpio_debug) printf("[BPIO] Error: COBS decode failed\r\n");
         error_response("COBS decode failed", B, buf);
@@ -845,7 +1160,9 @@ bpio_mode_read_end:
     }
     
     // Verify the flatbuffer packet (this will throw an error if invalid)
+    PERF_START(PERF_BPIO_VERIFY);
     int ret = bpio_RequestPacket_verify_as_root(buf, sizeof(buf)); 
+    PERF_END(PERF_BPIO_VERIFY);
     if(ret){
         if(bpio_debug){
             printf("[BPIO] Error: Invalid flatbuffer, verify returned %s\r\n", flatcc_verify_error_string(ret));
@@ -882,9 +1199,17 @@ bpio_mode_read_end:
         return;
     }
 
+    // a command (bridge, sniffer) holds the hardware and yields to us, only report status
+    if(tasks_yielding() && packet_type != bpio_RequestPacketContents_StatusRequest) {
+        error_response("A command is using the hardware, only StatusRequest is available", B, buf);
+        return;
+    }
+
     // Call the handler function for this packet type.
     flatcc_builder_reset(B);//25uS
-    bpio_handlers[packet_type].func(packet, B, buf); //450uS
+    PERF_START(PERF_BPIO_HANDLER);
+    bpio_handlers[packet_type].func(packet, B, buf);
+    PERF_END(PERF_BPIO_HANDLER);
     //flatcc_builder_reset(B);
     // build next buffer.
     //flatcc_builder_clear(B);    
@@ -25,19 +25,12 @@ uint32_t bpio_hw1wire_transaction(struct bpio_data_request_t *request, flatbuffe
 
     if(request->bytes_write > 0) {
         if(request->debug) printf("[1WIRE] Writing %d bytes\r\n", request->bytes_write);
-        for(uint32_t i = 0; i < request->bytes_write; i++) {
-            onewire_tx_byte(flatbuffers_uint8_vec_at(data_write, i));
-        }
-        onewire_wait_for_idle(); // wait for the bus to be idle after writing
+        onewire_tx_buf(data_write, request->bytes_write); // returns with the bus idle
     }
 
     if(request->bytes_read > 0) {
         if(request->debug) printf("[1WIRE] Reading %d bytes\r\n", request->bytes_read);
-        // read data
-        for(uint32_t i = 0; i < request->bytes_read; i++) {
-            data_read[i] = (uint8_t)onewire_rx_byte();
-            onewire_wait_for_idle(); //temp test
-        } 
+        onewire_rx_buf(data_read, request->bytes_read);
     }
 
     return false;
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "system_config.h"
+#include "modes.h"
+#include "fatfs/ff.h"
+#include "lib/sfud/inc/sfud.h"
+#include "lib/sfud/inc/sfud_def.h"
+#include "commands/spi/spiflash.h"
+#include "commands/eeprom/eeprom_base.h"
+#include "commands/eeprom/eeprom_i2c.h"
+#include "mode/hwi2c.h"
+#include "pirate/hash.h"
+#include "binmode/bpio_hash.h"
+
+// clamp start/length to the device, length 0 is the rest of the device
+static const char* bpio_hash_range(uint32_t size, uint32_t start, uint32_t* length) {
+    if (start >= size) {
+        return "Start address past end of device";
+    }
+    if (*length == 0 || *length > size - start) {
+        *length = size - start;
+    }
+    return NULL;
+}
+
+#ifdef BP_USE_HWSPI
+static const char* bpio_hash_flash(uint32_t start, uint32_t length, uint8_t data_lines, struct hash_ctx* hash) {
+    if (data_lines != 0 && data_lines != 1 && data_lines != 2 && data_lines != 4) {
+        return "Data lines must be 0 (auto), 1, 2 or 4";
+    }
+    sfud_flash flash_info = { .name = "SPI_FLASH", .spi.name = "SPI1" };
+    uint8_t buf[256];
+    if (!spiflash_init(&flash_info)) {
+        return "SPI flash not detected";
+    }
+    const char* error = bpio_hash_range(flash_info.chip.capacity, start, &length);
+    if (error) {
+        return error;
+    }
+    if (!spiflash_hash(start, start + length, sizeof(buf), buf, &flash_info, data_lines, hash, true)) {
+        return "SPI flash read failed";
+    }
+    return NULL;
+}
+#endif
+
+#ifdef BP_USE_HWI2C
+static const char* bpio_hash_i2c_eeprom(
+    const char* target, uint32_t start, uint32_t length, uint8_t i2c_address, struct hash_ctx* hash) {
+    if (i2c_mode_config.clock_stretch) {
+        return "I2C clock stretching must be disabled";
+    }
+    struct eeprom_info eeprom = { 0 };
+    if (!eeprom_i2c_find_device(target, i2c_address, &eeprom)) {
+        return "Unknown I2C EEPROM device";
+    }
+    const char* error = bpio_hash_range(eeprom.device->size_bytes, start, &length);
+    if (error) {
+        return error;
+    }
+    uint8_t buf[EEPROM_ADDRESS_PAGE_SIZE];
+    if (eeprom_hash(&eeprom, buf, sizeof(buf), start, length, hash, true)) {
+        return "I2C EEPROM read failed";
+    }
+    return NULL;
+}
+#endif
+
+const char* bpio_hash_target(const char* target,
+                             uint32_t start,
+                             uint32_t length,
+                             uint8_t i2c_address,
+                             uint8_t data_lines,
+                             struct hash_ctx* hash) {
+    if (!target) {
+        return "No hash target";
+    }
+    switch (system_config.mode) {
+#ifdef BP_USE_HWSPI
+        case HWSPI:
+            if (strcasecmp(target, "flash") != 0) {
+                return "SPI mode hash target must be \"flash\"";
+            }
+            return bpio_hash_flash(start, length, data_lines, hash);
+#endif
+#ifdef BP_USE_HWI2C
+        case HWI2C:
+            return bpio_hash_i2c_eeprom(target, start, length, i2c_address, hash);
+#endif
+        default:
+            return "Hash not supported in this mode";
+    }
+}
@@ -0,0 +1,34 @@
+/**
+ * @file bpio_hash.h
+ * @brief BPIO on-device CRC32/SHA-256 of memory devices.
+ * @details Hashes SPI flash (SPI mode) or I2C EEPROM (I2C mode) contents
+ *          on the Bus Pirate so a host can check an image without reading
+ *          it back over USB.
+ */
+
+#ifndef BPIO_HASH_H
+#define BPIO_HASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct hash_ctx;
+
+/**
+ * @brief Hash a range of a memory device in the current mode.
+ * @param target       "flash" in SPI mode, I2C EEPROM device name in I2C mode
+ * @param start        First byte to hash
+ * @param length       Number of bytes to hash, 0 for the rest of the device
+ * @param i2c_address  7-bit I2C address (EEPROM only)
+ * @param data_lines   SPI flash read data lines, 0 for auto (flash only)
+ * @param hash         Hash context, initialized with hash_init()
+ * @return             NULL on success, or an error message
+ */
+const char* bpio_hash_target(const char* target,
+                             uint32_t start,
+                             uint32_t length,
+                             uint8_t i2c_address,
+                             uint8_t data_lines,
+                             struct hash_ctx* hash);
+
+#endif // BPIO_HASH_H
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "bytecode.h"
+#include "command_struct.h"
+#include "bpio_reader.h"
+#include "bpio_jtag.h"
+#include "bpio_transactions.h"
+#include "mode/jtag.h"
+#include "pirate/jtag_pio.h"
+
+uint32_t bpio_jtag_transaction(struct bpio_data_request_t *request, flatbuffers_uint8_vec_t data_write, uint8_t *data_read) {
+    if(request->debug) printf("[JTAG] Performing transaction\r\n");
+
+    jtag_engine_start();
+
+    if(jtag_engine_swd()) {
+        // SWD has no raw shifts, use JtagRequest
+        if(request->bytes_write || request->bytes_read) {
+            if(request->debug) printf("[JTAG] SWD mode, use JtagRequest\r\n");
+            return true;
+        }
+        if(request->start_main) {
+            if(request->debug) printf("[JTAG] SWD line reset\r\n");
+            swd_pio_line_reset();
+        }
+        return false;
+    }
+
+    if(request->start_main) {
+        if(request->debug) printf("[JTAG] RESET\r\n");
+        jtag_pio_reset();
+    }
+
+    // TDI and TDO overlap for the shorter of the two, the rest shifts on its own
+    uint32_t write = request->bytes_write;
+    uint32_t read = request->bytes_read;
+    uint32_t both = MIN(write, read);
+    bool stop = request->stop_main;
+    if(both) {
+        if(request->debug) printf("[JTAG] Shift %d bytes\r\n", both);
+        jtag_pio_shift(data_write, data_read, both * 8, stop && write == read);
+    }
+    if(write > both) {
+        if(request->debug) printf("[JTAG] Writing %d bytes\r\n", write - both);
+        jtag_pio_shift(data_write + both, NULL, (write - both) * 8, stop);
+    } else if(read > both) {
+        if(request->debug) printf("[JTAG] Reading %d bytes\r\n", read - both);
+        jtag_pio_shift(NULL, data_read + both, (read - both) * 8, stop);
+    }
+
+    if(stop && (write || read)) {
+        static const uint8_t to_idle = 0x01; // Exit1: 1, 0
+        if(request->debug) printf("[JTAG] STOP\r\n");
+        jtag_pio_tms(&to_idle, 2);
+    }
+
+    return false;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file bpio_jtag.h
+ * @brief BPIO JTAG transaction handler.
+ * @details Provides binary protocol raw TDI/TDO shifts for JTAG mode.
+ *          Scans with TAP state changes and SWD transfers use JtagRequest.
+ */
+
+#ifndef BPIO_JTAG_H
+#define BPIO_JTAG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bpio_reader.h"
+
+// Forward declaration of the request structure (defined in bpio_transactions.h)
+struct bpio_data_request_t;
+
+/**
+ * @brief Perform a JTAG transaction.
+ * @param request     start_main: reset to Run-Test/Idle, stop_main: leave the shift state to Run-Test/Idle
+ * @param data_write  Flatbuffer vector containing TDI bytes, LSB first
+ * @param data_read   Buffer to store TDO bytes
+ * @return            0 on success, non-zero on error
+ */
+uint32_t bpio_jtag_transaction(struct bpio_data_request_t *request, flatbuffers_uint8_vec_t data_write, uint8_t *data_read);
+
+#endif // BPIO_JTAG_H
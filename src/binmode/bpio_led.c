@@ -8,6 +8,7 @@
 #include "bpio_transactions.h"
 #include "mode/hwled.h"
 #include "pirate/rgb.h"
+#include "pirate/led_frame.h"
 #include "ui/ui_format.h"
 #include "hardware/pio.h"
 #include "pio_config.h"
@@ -36,6 +37,7 @@ uint32_t bpio_led_transaction(struct bpio_data_request_t *request, flatbuffers_u
     
     uint32_t bytes_written = 0;
     uint32_t device = hwled_mode_config.device;
+    led_frame_wait();
     
     // Handle START condition using device-specific function
     if(request->start_main || request->start_alt) {
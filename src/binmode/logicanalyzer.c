@@ -283,6 +283,9 @@ void logic_analyzer_arm(bool led_indicator_enable) {
 }
 
 bool logic_analyzer_cleanup(void) {
+    if (!la_buf) {
+        return true; // setup failed or already cleaned up, the DMA channels aren't ours
+    }
     dma_channel_cleanup(la_dma_control_channel);
     dma_channel_cleanup(la_dma_data_channel);
     dma_channel_unclaim(la_dma_data_channel);
@@ -296,6 +299,7 @@ bool logic_analyzer_cleanup(void) {
     }
 
     mem_free((uint8_t*)la_buf);
+    la_buf = NULL; // the big buffer may have a new owner
 
     logicanalyzer_reset_led();
     return true;
@@ -303,8 +307,10 @@ bool logic_analyzer_cleanup(void) {
 
 bool logicanalyzer_setup(void) {
     //note that there isn't any alignment constraint for this buffer
-    la_buf = mem_alloc(LA_BUFFER_SIZE, 0);
-
+    la_buf = mem_alloc(LA_BUFFER_SIZE, BP_BIG_BUFFER_LA);
+    if (!la_buf) {
+        return false; // the big buffer is in use, don't aim the capture DMA at address 0
+    }
 
     // high bus priority to the DMA
     bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS;
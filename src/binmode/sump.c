@@ -42,6 +42,7 @@
 #include "usb_tx.h"
 #include "pirate/bio.h"
 #include "pirate/button.h"
+#include "pirate/mem.h"
 #include "system_config.h"
 #include "bytecode.h" //needed because modes.h has some functions that use it TODO: move all the opt args and bytecode stuff to a single helper file
 #include "command_struct.h" //needed for same reason as bytecode and needs same fix
@@ -574,6 +575,9 @@ void sump_logic_analyzer_service(void) {
     switch (state) {
         case SLA_STATE_IDLE:
             if (tud_cdc_n_connected(1)) {
+                if (!mem_available()) {
+                    break; // the big buffer is in use, try again on the next pass
+                }
                 cdc_sump_init();
                 cdc_sump_init_connect();
                 if (system_config.mode == 0 || !tud_cdc_n_connected(0)) {
@@ -31,12 +31,12 @@ static bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_clone
 static const flatbuffers_voffset_t __bpio_StatusRequest_required[] = { 0 };
 typedef flatbuffers_ref_t bpio_StatusRequest_ref_t;
 static bpio_StatusRequest_ref_t bpio_StatusRequest_clone(flatbuffers_builder_t *B, bpio_StatusRequest_table_t t);
-__flatbuffers_build_table(flatbuffers_, bpio_StatusRequest, 1)
+__flatbuffers_build_table(flatbuffers_, bpio_StatusRequest, 2)
 
 static const flatbuffers_voffset_t __bpio_StatusResponse_required[] = { 0 };
 typedef flatbuffers_ref_t bpio_StatusResponse_ref_t;
 static bpio_StatusResponse_ref_t bpio_StatusResponse_clone(flatbuffers_builder_t *B, bpio_StatusResponse_table_t t);
-__flatbuffers_build_table(flatbuffers_, bpio_StatusResponse, 29)
+__flatbuffers_build_table(flatbuffers_, bpio_StatusResponse, 34)
 
 static const flatbuffers_voffset_t __bpio_ModeConfiguration_required[] = { 0 };
 typedef flatbuffers_ref_t bpio_ModeConfiguration_ref_t;
@@ -63,6 +63,46 @@ typedef flatbuffers_ref_t bpio_DataResponse_ref_t;
 static bpio_DataResponse_ref_t bpio_DataResponse_clone(flatbuffers_builder_t *B, bpio_DataResponse_table_t t);
 __flatbuffers_build_table(flatbuffers_, bpio_DataResponse, 3)
 
+static const flatbuffers_voffset_t __bpio_HashRequest_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_HashRequest_ref_t;
+static bpio_HashRequest_ref_t bpio_HashRequest_clone(flatbuffers_builder_t *B, bpio_HashRequest_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_HashRequest, 6)
+
+static const flatbuffers_voffset_t __bpio_HashResponse_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_HashResponse_ref_t;
+static bpio_HashResponse_ref_t bpio_HashResponse_clone(flatbuffers_builder_t *B, bpio_HashResponse_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_HashResponse, 4)
+
+static const flatbuffers_voffset_t __bpio_ScopeRequest_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_ScopeRequest_ref_t;
+static bpio_ScopeRequest_ref_t bpio_ScopeRequest_clone(flatbuffers_builder_t *B, bpio_ScopeRequest_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_ScopeRequest, 7)
+
+static const flatbuffers_voffset_t __bpio_ScopeResponse_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_ScopeResponse_ref_t;
+static bpio_ScopeResponse_ref_t bpio_ScopeResponse_clone(flatbuffers_builder_t *B, bpio_ScopeResponse_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_ScopeResponse, 13)
+
+static const flatbuffers_voffset_t __bpio_JtagRequest_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_JtagRequest_ref_t;
+static bpio_JtagRequest_ref_t bpio_JtagRequest_clone(flatbuffers_builder_t *B, bpio_JtagRequest_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_JtagRequest, 12)
+
+static const flatbuffers_voffset_t __bpio_JtagResponse_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_JtagResponse_ref_t;
+static bpio_JtagResponse_ref_t bpio_JtagResponse_clone(flatbuffers_builder_t *B, bpio_JtagResponse_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_JtagResponse, 4)
+
+static const flatbuffers_voffset_t __bpio_LedFrameRequest_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_LedFrameRequest_ref_t;
+static bpio_LedFrameRequest_ref_t bpio_LedFrameRequest_clone(flatbuffers_builder_t *B, bpio_LedFrameRequest_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_LedFrameRequest, 6)
+
+static const flatbuffers_voffset_t __bpio_LedFrameResponse_required[] = { 0 };
+typedef flatbuffers_ref_t bpio_LedFrameResponse_ref_t;
+static bpio_LedFrameResponse_ref_t bpio_LedFrameResponse_clone(flatbuffers_builder_t *B, bpio_LedFrameResponse_table_t t);
+__flatbuffers_build_table(flatbuffers_, bpio_LedFrameResponse, 3)
+
 static const flatbuffers_voffset_t __bpio_RequestPacket_required[] = { 0 };
 typedef flatbuffers_ref_t bpio_RequestPacket_ref_t;
 static bpio_RequestPacket_ref_t bpio_RequestPacket_clone(flatbuffers_builder_t *B, bpio_RequestPacket_table_t t);
@@ -73,8 +113,8 @@ typedef flatbuffers_ref_t bpio_ResponsePacket_ref_t;
 static bpio_ResponsePacket_ref_t bpio_ResponsePacket_clone(flatbuffers_builder_t *B, bpio_ResponsePacket_table_t t);
 __flatbuffers_build_table(flatbuffers_, bpio_ResponsePacket, 3)
 
-#define __bpio_StatusRequest_formal_args , bpio_StatusRequestTypes_vec_ref_t v0
-#define __bpio_StatusRequest_call_args , v0
+#define __bpio_StatusRequest_formal_args , bpio_StatusRequestTypes_vec_ref_t v0, flatbuffers_bool_t v1
+#define __bpio_StatusRequest_call_args , v0, v1
 static inline bpio_StatusRequest_ref_t bpio_StatusRequest_create(flatbuffers_builder_t *B __bpio_StatusRequest_formal_args);
 __flatbuffers_build_table_prolog(flatbuffers_, bpio_StatusRequest, bpio_StatusRequest_file_identifier, bpio_StatusRequest_type_identifier)
 
@@ -85,7 +125,8 @@ __flatbuffers_build_table_prolog(flatbuffers_, bpio_StatusRequest, bpio_StatusRe
   flatbuffers_bool_t v12, uint32_t v13, uint32_t v14, uint32_t v15,\
   flatbuffers_bool_t v16, uint32_t v17, uint32_t v18, uint32_t v19,\
   uint32_t v20, flatbuffers_bool_t v21, flatbuffers_bool_t v22, flatbuffers_uint32_vec_ref_t v23,\
-  uint8_t v24, uint8_t v25, float v26, float v27, uint8_t v28
+  uint8_t v24, uint8_t v25, float v26, float v27,\
+  uint8_t v28, flatbuffers_string_vec_ref_t v29, flatbuffers_uint32_vec_ref_t v30, flatbuffers_uint32_vec_ref_t v31, flatbuffers_uint32_vec_ref_t v32, flatbuffers_uint32_vec_ref_t v33
 #define __bpio_StatusResponse_call_args ,\
   v0, v1, v2, v3,\
   v4, v5, v6, v7,\
@@ -93,7 +134,8 @@ __flatbuffers_build_table_prolog(flatbuffers_, bpio_StatusRequest, bpio_StatusRe
   v12, v13, v14, v15,\
   v16, v17, v18, v19,\
   v20, v21, v22, v23,\
-  v24, v25, v26, v27, v28
+  v24, v25, v26, v27,\
+  v28, v29, v30, v31, v32, v33
 static inline bpio_StatusResponse_ref_t bpio_StatusResponse_create(flatbuffers_builder_t *B __bpio_StatusResponse_formal_args);
 __flatbuffers_build_table_prolog(flatbuffers_, bpio_StatusResponse, bpio_StatusResponse_file_identifier, bpio_StatusResponse_type_identifier)
 
@@ -140,6 +182,70 @@ __flatbuffers_build_table_prolog(flatbuffers_, bpio_DataRequest, bpio_DataReques
 static inline bpio_DataResponse_ref_t bpio_DataResponse_create(flatbuffers_builder_t *B __bpio_DataResponse_formal_args);
 __flatbuffers_build_table_prolog(flatbuffers_, bpio_DataResponse, bpio_DataResponse_file_identifier, bpio_DataResponse_type_identifier)
 
+#define __bpio_HashRequest_formal_args ,\
+  flatbuffers_string_ref_t v0, uint32_t v1, uint32_t v2, uint8_t v3, uint8_t v4, flatbuffers_bool_t v5
+#define __bpio_HashRequest_call_args ,\
+  v0, v1, v2, v3, v4, v5
+static inline bpio_HashRequest_ref_t bpio_HashRequest_create(flatbuffers_builder_t *B __bpio_HashRequest_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_HashRequest, bpio_HashRequest_file_identifier, bpio_HashRequest_type_identifier)
+
+#define __bpio_HashResponse_formal_args ,\
+  flatbuffers_string_ref_t v0, uint32_t v1, uint32_t v2, flatbuffers_uint8_vec_ref_t v3
+#define __bpio_HashResponse_call_args ,\
+  v0, v1, v2, v3
+static inline bpio_HashResponse_ref_t bpio_HashResponse_create(flatbuffers_builder_t *B __bpio_HashResponse_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_HashResponse, bpio_HashResponse_file_identifier, bpio_HashResponse_type_identifier)
+
+#define __bpio_ScopeRequest_formal_args ,\
+  flatbuffers_bool_t v0, int8_t v1, uint8_t v2, flatbuffers_bool_t v3,\
+  uint32_t v4, uint32_t v5, uint32_t v6
+#define __bpio_ScopeRequest_call_args ,\
+  v0, v1, v2, v3,\
+  v4, v5, v6
+static inline bpio_ScopeRequest_ref_t bpio_ScopeRequest_create(flatbuffers_builder_t *B __bpio_ScopeRequest_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_ScopeRequest, bpio_ScopeRequest_file_identifier, bpio_ScopeRequest_type_identifier)
+
+#define __bpio_ScopeResponse_formal_args ,\
+  flatbuffers_string_ref_t v0, uint32_t v1, flatbuffers_bool_t v2, uint8_t v3,\
+  uint32_t v4, uint8_t v5, uint32_t v6, int32_t v7,\
+  uint16_t v8, uint32_t v9, uint32_t v10, uint32_t v11, flatbuffers_uint8_vec_ref_t v12
+#define __bpio_ScopeResponse_call_args ,\
+  v0, v1, v2, v3,\
+  v4, v5, v6, v7,\
+  v8, v9, v10, v11, v12
+static inline bpio_ScopeResponse_ref_t bpio_ScopeResponse_create(flatbuffers_builder_t *B __bpio_ScopeResponse_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_ScopeResponse, bpio_ScopeResponse_file_identifier, bpio_ScopeResponse_type_identifier)
+
+#define __bpio_JtagRequest_formal_args ,\
+  flatbuffers_bool_t v0, flatbuffers_uint8_vec_ref_t v1, uint32_t v2, uint8_t v3,\
+  flatbuffers_uint8_vec_ref_t v4, uint32_t v5, flatbuffers_bool_t v6, flatbuffers_bool_t v7,\
+  flatbuffers_bool_t v8, flatbuffers_bool_t v9, uint8_t v10, uint32_t v11
+#define __bpio_JtagRequest_call_args ,\
+  v0, v1, v2, v3,\
+  v4, v5, v6, v7,\
+  v8, v9, v10, v11
+static inline bpio_JtagRequest_ref_t bpio_JtagRequest_create(flatbuffers_builder_t *B __bpio_JtagRequest_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_JtagRequest, bpio_JtagRequest_file_identifier, bpio_JtagRequest_type_identifier)
+
+#define __bpio_JtagResponse_formal_args ,\
+  flatbuffers_string_ref_t v0, flatbuffers_uint8_vec_ref_t v1, uint8_t v2, uint32_t v3
+#define __bpio_JtagResponse_call_args ,\
+  v0, v1, v2, v3
+static inline bpio_JtagResponse_ref_t bpio_JtagResponse_create(flatbuffers_builder_t *B __bpio_JtagResponse_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_JtagResponse, bpio_JtagResponse_file_identifier, bpio_JtagResponse_type_identifier)
+
+#define __bpio_LedFrameRequest_formal_args ,\
+  uint32_t v0, uint32_t v1, flatbuffers_uint8_vec_ref_t v2, uint8_t v3, float v4, flatbuffers_bool_t v5
+#define __bpio_LedFrameRequest_call_args ,\
+  v0, v1, v2, v3, v4, v5
+static inline bpio_LedFrameRequest_ref_t bpio_LedFrameRequest_create(flatbuffers_builder_t *B __bpio_LedFrameRequest_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_LedFrameRequest, bpio_LedFrameRequest_file_identifier, bpio_LedFrameRequest_type_identifier)
+
+#define __bpio_LedFrameResponse_formal_args , flatbuffers_string_ref_t v0, uint32_t v1, uint32_t v2
+#define __bpio_LedFrameResponse_call_args , v0, v1, v2
+static inline bpio_LedFrameResponse_ref_t bpio_LedFrameResponse_create(flatbuffers_builder_t *B __bpio_LedFrameResponse_formal_args);
+__flatbuffers_build_table_prolog(flatbuffers_, bpio_LedFrameResponse, bpio_LedFrameResponse_file_identifier, bpio_LedFrameResponse_type_identifier)
+
 #define __bpio_RequestPacket_formal_args , uint8_t v0, uint16_t v1, bpio_RequestPacketContents_union_ref_t v3
 #define __bpio_RequestPacket_call_args , v0, v1, v3
 static inline bpio_RequestPacket_ref_t bpio_RequestPacket_create(flatbuffers_builder_t *B __bpio_RequestPacket_formal_args);
@@ -158,6 +264,14 @@ static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_
 { bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_ConfigurationRequest; uref.value = ref; return uref; }
 static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_as_DataRequest(bpio_DataRequest_ref_t ref)
 { bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_DataRequest; uref.value = ref; return uref; }
+static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_as_HashRequest(bpio_HashRequest_ref_t ref)
+{ bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_HashRequest; uref.value = ref; return uref; }
+static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_as_ScopeRequest(bpio_ScopeRequest_ref_t ref)
+{ bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_ScopeRequest; uref.value = ref; return uref; }
+static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_as_JtagRequest(bpio_JtagRequest_ref_t ref)
+{ bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_JtagRequest; uref.value = ref; return uref; }
+static inline bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_as_LedFrameRequest(bpio_LedFrameRequest_ref_t ref)
+{ bpio_RequestPacketContents_union_ref_t uref; uref.type = bpio_RequestPacketContents_LedFrameRequest; uref.value = ref; return uref; }
 __flatbuffers_build_union_vector(flatbuffers_, bpio_RequestPacketContents)
 
 static bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_clone(flatbuffers_builder_t *B, bpio_RequestPacketContents_union_t u)
@@ -166,6 +280,10 @@ static bpio_RequestPacketContents_union_ref_t bpio_RequestPacketContents_clone(f
     case 1: return bpio_RequestPacketContents_as_StatusRequest(bpio_StatusRequest_clone(B, (bpio_StatusRequest_table_t)u.value));
     case 2: return bpio_RequestPacketContents_as_ConfigurationRequest(bpio_ConfigurationRequest_clone(B, (bpio_ConfigurationRequest_table_t)u.value));
     case 3: return bpio_RequestPacketContents_as_DataRequest(bpio_DataRequest_clone(B, (bpio_DataRequest_table_t)u.value));
+    case 4: return bpio_RequestPacketContents_as_HashRequest(bpio_HashRequest_clone(B, (bpio_HashRequest_table_t)u.value));
+    case 5: return bpio_RequestPacketContents_as_ScopeRequest(bpio_ScopeRequest_clone(B, (bpio_ScopeRequest_table_t)u.value));
+    case 6: return bpio_RequestPacketContents_as_JtagRequest(bpio_JtagRequest_clone(B, (bpio_JtagRequest_table_t)u.value));
+    case 7: return bpio_RequestPacketContents_as_LedFrameRequest(bpio_LedFrameRequest_clone(B, (bpio_LedFrameRequest_table_t)u.value));
     default: return bpio_RequestPacketContents_as_NONE();
     }
 }
@@ -178,6 +296,14 @@ static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContent
 { bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_ConfigurationResponse; uref.value = ref; return uref; }
 static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_as_DataResponse(bpio_DataResponse_ref_t ref)
 { bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_DataResponse; uref.value = ref; return uref; }
+static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_as_HashResponse(bpio_HashResponse_ref_t ref)
+{ bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_HashResponse; uref.value = ref; return uref; }
+static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_as_ScopeResponse(bpio_ScopeResponse_ref_t ref)
+{ bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_ScopeResponse; uref.value = ref; return uref; }
+static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_as_JtagResponse(bpio_JtagResponse_ref_t ref)
+{ bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_JtagResponse; uref.value = ref; return uref; }
+static inline bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_as_LedFrameResponse(bpio_LedFrameResponse_ref_t ref)
+{ bpio_ResponsePacketContents_union_ref_t uref; uref.type = bpio_ResponsePacketContents_LedFrameResponse; uref.value = ref; return uref; }
 __flatbuffers_build_union_vector(flatbuffers_, bpio_ResponsePacketContents)
 
 static bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_clone(flatbuffers_builder_t *B, bpio_ResponsePacketContents_union_t u)
@@ -186,16 +312,22 @@ static bpio_ResponsePacketContents_union_ref_t bpio_ResponsePacketContents_clone
     case 1: return bpio_ResponsePacketContents_as_StatusResponse(bpio_StatusResponse_clone(B, (bpio_StatusResponse_table_t)u.value));
     case 2: return bpio_ResponsePacketContents_as_ConfigurationResponse(bpio_ConfigurationResponse_clone(B, (bpio_ConfigurationResponse_table_t)u.value));
     case 3: return bpio_ResponsePacketContents_as_DataResponse(bpio_DataResponse_clone(B, (bpio_DataResponse_table_t)u.value));
+    case 4: return bpio_ResponsePacketContents_as_HashResponse(bpio_HashResponse_clone(B, (bpio_HashResponse_table_t)u.value));
+    case 5: return bpio_ResponsePacketContents_as_ScopeResponse(bpio_ScopeResponse_clone(B, (bpio_ScopeResponse_table_t)u.value));
+    case 6: return bpio_ResponsePacketContents_as_JtagResponse(bpio_JtagResponse_clone(B, (bpio_JtagResponse_table_t)u.value));
+    case 7: return bpio_ResponsePacketContents_as_LedFrameResponse(bpio_LedFrameResponse_clone(B, (bpio_LedFrameResponse_table_t)u.value));
     default: return bpio_ResponsePacketContents_as_NONE();
     }
 }
 
 __flatbuffers_build_vector_field(0, flatbuffers_, bpio_StatusRequest_query, bpio_StatusRequestTypes, bpio_StatusRequestTypes_enum_t, bpio_StatusRequest)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_StatusRequest_perf_reset, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_StatusRequest)
 
 static inline bpio_StatusRequest_ref_t bpio_StatusRequest_create(flatbuffers_builder_t *B __bpio_StatusRequest_formal_args)
 {
     if (bpio_StatusRequest_start(B)
-        || bpio_StatusRequest_query_add(B, v0)) {
+        || bpio_StatusRequest_query_add(B, v0)
+        || bpio_StatusRequest_perf_reset_add(B, v1)) {
         return 0;
     }
     return bpio_StatusRequest_end(B);
@@ -205,7 +337,8 @@ static bpio_StatusRequest_ref_t bpio_StatusRequest_clone(flatbuffers_builder_t *
 {
     __flatbuffers_memoize_begin(B, t);
     if (bpio_StatusRequest_start(B)
-        || bpio_StatusRequest_query_pick(B, t)) {
+        || bpio_StatusRequest_query_pick(B, t)
+        || bpio_StatusRequest_perf_reset_pick(B, t)) {
         return 0;
     }
     __flatbuffers_memoize_end(B, t, bpio_StatusRequest_end(B));
@@ -240,6 +373,11 @@ __flatbuffers_build_scalar_field(25, flatbuffers_, bpio_StatusResponse_io_value,
 __flatbuffers_build_scalar_field(26, flatbuffers_, bpio_StatusResponse_disk_size_mb, flatbuffers_float, float, 4, 4, 0.00000000f, bpio_StatusResponse)
 __flatbuffers_build_scalar_field(27, flatbuffers_, bpio_StatusResponse_disk_used_mb, flatbuffers_float, float, 4, 4, 0.00000000f, bpio_StatusResponse)
 __flatbuffers_build_scalar_field(28, flatbuffers_, bpio_StatusResponse_led_count, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_StatusResponse)
+__flatbuffers_build_string_vector_field(29, flatbuffers_, bpio_StatusResponse_perf_probes, bpio_StatusResponse)
+__flatbuffers_build_vector_field(30, flatbuffers_, bpio_StatusResponse_perf_count, flatbuffers_uint32, uint32_t, bpio_StatusResponse)
+__flatbuffers_build_vector_field(31, flatbuffers_, bpio_StatusResponse_perf_min_us, flatbuffers_uint32, uint32_t, bpio_StatusResponse)
+__flatbuffers_build_vector_field(32, flatbuffers_, bpio_StatusResponse_perf_max_us, flatbuffers_uint32, uint32_t, bpio_StatusResponse)
+__flatbuffers_build_vector_field(33, flatbuffers_, bpio_StatusResponse_perf_avg_us, flatbuffers_uint32, uint32_t, bpio_StatusResponse)
 
 static inline bpio_StatusResponse_ref_t bpio_StatusResponse_create(flatbuffers_builder_t *B __bpio_StatusResponse_formal_args)
 {
@@ -260,6 +398,11 @@ static inline bpio_StatusResponse_ref_t bpio_StatusResponse_create(flatbuffers_b
         || bpio_StatusResponse_adc_mv_add(B, v23)
         || bpio_StatusResponse_disk_size_mb_add(B, v26)
         || bpio_StatusResponse_disk_used_mb_add(B, v27)
+        || bpio_StatusResponse_perf_probes_add(B, v29)
+        || bpio_StatusResponse_perf_count_add(B, v30)
+        || bpio_StatusResponse_perf_min_us_add(B, v31)
+        || bpio_StatusResponse_perf_max_us_add(B, v32)
+        || bpio_StatusResponse_perf_avg_us_add(B, v33)
         || bpio_StatusResponse_version_flatbuffers_minor_add(B, v2)
         || bpio_StatusResponse_version_flatbuffers_major_add(B, v1)
         || bpio_StatusResponse_version_hardware_major_add(B, v3)
@@ -298,6 +441,11 @@ static bpio_StatusResponse_ref_t bpio_StatusResponse_clone(flatbuffers_builder_t
         || bpio_StatusResponse_adc_mv_pick(B, t)
         || bpio_StatusResponse_disk_size_mb_pick(B, t)
         || bpio_StatusResponse_disk_used_mb_pick(B, t)
+        || bpio_StatusResponse_perf_probes_pick(B, t)
+        || bpio_StatusResponse_perf_count_pick(B, t)
+        || bpio_StatusResponse_perf_min_us_pick(B, t)
+        || bpio_StatusResponse_perf_max_us_pick(B, t)
+        || bpio_StatusResponse_perf_avg_us_pick(B, t)
         || bpio_StatusResponse_version_flatbuffers_minor_pick(B, t)
         || bpio_StatusResponse_version_flatbuffers_major_pick(B, t)
         || bpio_StatusResponse_version_hardware_major_pick(B, t)
@@ -535,12 +683,325 @@ static bpio_DataResponse_ref_t bpio_DataResponse_clone(flatbuffers_builder_t *B,
     __flatbuffers_memoize_end(B, t, bpio_DataResponse_end(B));
 }
 
+__flatbuffers_build_string_field(0, flatbuffers_, bpio_HashRequest_target, bpio_HashRequest)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_HashRequest_start_address, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_HashRequest)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_HashRequest_length, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_HashRequest)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_HashRequest_i2c_address, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(80), bpio_HashRequest)
+__flatbuffers_build_scalar_field(4, flatbuffers_, bpio_HashRequest_data_lines, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_HashRequest)
+__flatbuffers_build_scalar_field(5, flatbuffers_, bpio_HashRequest_sha256, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(1), bpio_HashRequest)
+
+static inline bpio_HashRequest_ref_t bpio_HashRequest_create(flatbuffers_builder_t *B __bpio_HashRequest_formal_args)
+{
+    if (bpio_HashRequest_start(B)
+        || bpio_HashRequest_target_add(B, v0)
+        || bpio_HashRequest_start_address_add(B, v1)
+        || bpio_HashRequest_length_add(B, v2)
+        || bpio_HashRequest_i2c_address_add(B, v3)
+        || bpio_HashRequest_data_lines_add(B, v4)
+        || bpio_HashRequest_sha256_add(B, v5)) {
+        return 0;
+    }
+    return bpio_HashRequest_end(B);
+}
+
+static bpio_HashRequest_ref_t bpio_HashRequest_clone(flatbuffers_builder_t *B, bpio_HashRequest_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_HashRequest_start(B)
+        || bpio_HashRequest_target_pick(B, t)
+        || bpio_HashRequest_start_address_pick(B, t)
+        || bpio_HashRequest_length_pick(B, t)
+        || bpio_HashRequest_i2c_address_pick(B, t)
+        || bpio_HashRequest_data_lines_pick(B, t)
+        || bpio_HashRequest_sha256_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_HashRequest_end(B));
+}
+
+__flatbuffers_build_string_field(0, flatbuffers_, bpio_HashResponse_error, bpio_HashResponse)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_HashResponse_length, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_HashResponse)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_HashResponse_crc32, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_HashResponse)
+__flatbuffers_build_vector_field(3, flatbuffers_, bpio_HashResponse_sha256, flatbuffers_uint8, uint8_t, bpio_HashResponse)
+
+static inline bpio_HashResponse_ref_t bpio_HashResponse_create(flatbuffers_builder_t *B __bpio_HashResponse_formal_args)
+{
+    if (bpio_HashResponse_start(B)
+        || bpio_HashResponse_error_add(B, v0)
+        || bpio_HashResponse_length_add(B, v1)
+        || bpio_HashResponse_crc32_add(B, v2)
+        || bpio_HashResponse_sha256_add(B, v3)) {
+        return 0;
+    }
+    return bpio_HashResponse_end(B);
+}
+
+static bpio_HashResponse_ref_t bpio_HashResponse_clone(flatbuffers_builder_t *B, bpio_HashResponse_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_HashResponse_start(B)
+        || bpio_HashResponse_error_pick(B, t)
+        || bpio_HashResponse_length_pick(B, t)
+        || bpio_HashResponse_crc32_pick(B, t)
+        || bpio_HashResponse_sha256_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_HashResponse_end(B));
+}
+
+__flatbuffers_build_scalar_field(0, flatbuffers_, bpio_ScopeRequest_run, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_ScopeRequest_run_pin, flatbuffers_int8, int8_t, 1, 1, INT8_C(-1), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_ScopeRequest_run_mode, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(255), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_ScopeRequest_stop, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(4, flatbuffers_, bpio_ScopeRequest_sequence, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(5, flatbuffers_, bpio_ScopeRequest_sample_offset, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeRequest)
+__flatbuffers_build_scalar_field(6, flatbuffers_, bpio_ScopeRequest_sample_count, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeRequest)
+
+static inline bpio_ScopeRequest_ref_t bpio_ScopeRequest_create(flatbuffers_builder_t *B __bpio_ScopeRequest_formal_args)
+{
+    if (bpio_ScopeRequest_start(B)
+        || bpio_ScopeRequest_sequence_add(B, v4)
+        || bpio_ScopeRequest_sample_offset_add(B, v5)
+        || bpio_ScopeRequest_sample_count_add(B, v6)
+        || bpio_ScopeRequest_run_add(B, v0)
+        || bpio_ScopeRequest_run_pin_add(B, v1)
+        || bpio_ScopeRequest_run_mode_add(B, v2)
+        || bpio_ScopeRequest_stop_add(B, v3)) {
+        return 0;
+    }
+    return bpio_ScopeRequest_end(B);
+}
+
+static bpio_ScopeRequest_ref_t bpio_ScopeRequest_clone(flatbuffers_builder_t *B, bpio_ScopeRequest_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_ScopeRequest_start(B)
+        || bpio_ScopeRequest_sequence_pick(B, t)
+        || bpio_ScopeRequest_sample_offset_pick(B, t)
+        || bpio_ScopeRequest_sample_count_pick(B, t)
+        || bpio_ScopeRequest_run_pick(B, t)
+        || bpio_ScopeRequest_run_pin_pick(B, t)
+        || bpio_ScopeRequest_run_mode_pick(B, t)
+        || bpio_ScopeRequest_stop_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_ScopeRequest_end(B));
+}
+
+__flatbuffers_build_string_field(0, flatbuffers_, bpio_ScopeResponse_error, bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_ScopeResponse_sequence, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_ScopeResponse_running, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_ScopeResponse_pin, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(4, flatbuffers_, bpio_ScopeResponse_sample_rate_hz, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(5, flatbuffers_, bpio_ScopeResponse_trigger_type, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(6, flatbuffers_, bpio_ScopeResponse_trigger_level_mv, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(7, flatbuffers_, bpio_ScopeResponse_trigger_index, flatbuffers_int32, int32_t, 4, 4, INT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(8, flatbuffers_, bpio_ScopeResponse_counts_per_5v, flatbuffers_uint16, uint16_t, 2, 2, UINT16_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(9, flatbuffers_, bpio_ScopeResponse_frame_samples, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(10, flatbuffers_, bpio_ScopeResponse_sample_offset, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_scalar_field(11, flatbuffers_, bpio_ScopeResponse_sample_count, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_ScopeResponse)
+__flatbuffers_build_vector_field(12, flatbuffers_, bpio_ScopeResponse_samples, flatbuffers_uint8, uint8_t, bpio_ScopeResponse)
+
+static inline bpio_ScopeResponse_ref_t bpio_ScopeResponse_create(flatbuffers_builder_t *B __bpio_ScopeResponse_formal_args)
+{
+    if (bpio_ScopeResponse_start(B)
+        || bpio_ScopeResponse_error_add(B, v0)
+        || bpio_ScopeResponse_sequence_add(B, v1)
+        || bpio_ScopeResponse_sample_rate_hz_add(B, v4)
+        || bpio_ScopeResponse_trigger_level_mv_add(B, v6)
+        || bpio_ScopeResponse_trigger_index_add(B, v7)
+        || bpio_ScopeResponse_frame_samples_add(B, v9)
+        || bpio_ScopeResponse_sample_offset_add(B, v10)
+        || bpio_ScopeResponse_sample_count_add(B, v11)
+        || bpio_ScopeResponse_samples_add(B, v12)
+        || bpio_ScopeResponse_counts_per_5v_add(B, v8)
+        || bpio_ScopeResponse_running_add(B, v2)
+        || bpio_ScopeResponse_pin_add(B, v3)
+        || bpio_ScopeResponse_trigger_type_add(B, v5)) {
+        return 0;
+    }
+    return bpio_ScopeResponse_end(B);
+}
+
+static bpio_ScopeResponse_ref_t bpio_ScopeResponse_clone(flatbuffers_builder_t *B, bpio_ScopeResponse_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_ScopeResponse_start(B)
+        || bpio_ScopeResponse_error_pick(B, t)
+        || bpio_ScopeResponse_sequence_pick(B, t)
+        || bpio_ScopeResponse_sample_rate_hz_pick(B, t)
+        || bpio_ScopeResponse_trigger_level_mv_pick(B, t)
+        || bpio_ScopeResponse_trigger_index_pick(B, t)
+        || bpio_ScopeResponse_frame_samples_pick(B, t)
+        || bpio_ScopeResponse_sample_offset_pick(B, t)
+        || bpio_ScopeResponse_sample_count_pick(B, t)
+        || bpio_ScopeResponse_samples_pick(B, t)
+        || bpio_ScopeResponse_counts_per_5v_pick(B, t)
+        || bpio_ScopeResponse_running_pick(B, t)
+        || bpio_ScopeResponse_pin_pick(B, t)
+        || bpio_ScopeResponse_trigger_type_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_ScopeResponse_end(B));
+}
+
+__flatbuffers_build_scalar_field(0, flatbuffers_, bpio_JtagRequest_reset, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_vector_field(1, flatbuffers_, bpio_JtagRequest_tms, flatbuffers_uint8, uint8_t, bpio_JtagRequest)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_JtagRequest_tms_bits, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_JtagRequest_shift, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_vector_field(4, flatbuffers_, bpio_JtagRequest_tdi, flatbuffers_uint8, uint8_t, bpio_JtagRequest)
+__flatbuffers_build_scalar_field(5, flatbuffers_, bpio_JtagRequest_shift_bits, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(6, flatbuffers_, bpio_JtagRequest_read_tdo, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(7, flatbuffers_, bpio_JtagRequest_swd_transfer, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(8, flatbuffers_, bpio_JtagRequest_swd_ap, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(9, flatbuffers_, bpio_JtagRequest_swd_read, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(10, flatbuffers_, bpio_JtagRequest_swd_addr, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_JtagRequest)
+__flatbuffers_build_scalar_field(11, flatbuffers_, bpio_JtagRequest_swd_data, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_JtagRequest)
+
+static inline bpio_JtagRequest_ref_t bpio_JtagRequest_create(flatbuffers_builder_t *B __bpio_JtagRequest_formal_args)
+{
+    if (bpio_JtagRequest_start(B)
+        || bpio_JtagRequest_tms_add(B, v1)
+        || bpio_JtagRequest_tms_bits_add(B, v2)
+        || bpio_JtagRequest_tdi_add(B, v4)
+        || bpio_JtagRequest_shift_bits_add(B, v5)
+        || bpio_JtagRequest_swd_data_add(B, v11)
+        || bpio_JtagRequest_reset_add(B, v0)
+        || bpio_JtagRequest_shift_add(B, v3)
+        || bpio_JtagRequest_read_tdo_add(B, v6)
+        || bpio_JtagRequest_swd_transfer_add(B, v7)
+        || bpio_JtagRequest_swd_ap_add(B, v8)
+        || bpio_JtagRequest_swd_read_add(B, v9)
+        || bpio_JtagRequest_swd_addr_add(B, v10)) {
+        return 0;
+    }
+    return bpio_JtagRequest_end(B);
+}
+
+static bpio_JtagRequest_ref_t bpio_JtagRequest_clone(flatbuffers_builder_t *B, bpio_JtagRequest_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_JtagRequest_start(B)
+        || bpio_JtagRequest_tms_pick(B, t)
+        || bpio_JtagRequest_tms_bits_pick(B, t)
+        || bpio_JtagRequest_tdi_pick(B, t)
+        || bpio_JtagRequest_shift_bits_pick(B, t)
+        || bpio_JtagRequest_swd_data_pick(B, t)
+        || bpio_JtagRequest_reset_pick(B, t)
+        || bpio_JtagRequest_shift_pick(B, t)
+        || bpio_JtagRequest_read_tdo_pick(B, t)
+        || bpio_JtagRequest_swd_transfer_pick(B, t)
+        || bpio_JtagRequest_swd_ap_pick(B, t)
+        || bpio_JtagRequest_swd_read_pick(B, t)
+        || bpio_JtagRequest_swd_addr_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_JtagRequest_end(B));
+}
+
+__flatbuffers_build_string_field(0, flatbuffers_, bpio_JtagResponse_error, bpio_JtagResponse)
+__flatbuffers_build_vector_field(1, flatbuffers_, bpio_JtagResponse_tdo, flatbuffers_uint8, uint8_t, bpio_JtagResponse)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_JtagResponse_swd_ack, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_JtagResponse)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_JtagResponse_swd_data, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_JtagResponse)
+
+static inline bpio_JtagResponse_ref_t bpio_JtagResponse_create(flatbuffers_builder_t *B __bpio_JtagResponse_formal_args)
+{
+    if (bpio_JtagResponse_start(B)
+        || bpio_JtagResponse_error_add(B, v0)
+        || bpio_JtagResponse_tdo_add(B, v1)
+        || bpio_JtagResponse_swd_data_add(B, v3)
+        || bpio_JtagResponse_swd_ack_add(B, v2)) {
+        return 0;
+    }
+    return bpio_JtagResponse_end(B);
+}
+
+static bpio_JtagResponse_ref_t bpio_JtagResponse_clone(flatbuffers_builder_t *B, bpio_JtagResponse_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_JtagResponse_start(B)
+        || bpio_JtagResponse_error_pick(B, t)
+        || bpio_JtagResponse_tdo_pick(B, t)
+        || bpio_JtagResponse_swd_data_pick(B, t)
+        || bpio_JtagResponse_swd_ack_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_JtagResponse_end(B));
+}
+
+__flatbuffers_build_scalar_field(0, flatbuffers_, bpio_LedFrameRequest_leds, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_LedFrameRequest)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_LedFrameRequest_first, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_LedFrameRequest)
+__flatbuffers_build_vector_field(2, flatbuffers_, bpio_LedFrameRequest_pixels, flatbuffers_uint8, uint8_t, bpio_LedFrameRequest)
+__flatbuffers_build_scalar_field(3, flatbuffers_, bpio_LedFrameRequest_brightness, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(255), bpio_LedFrameRequest)
+__flatbuffers_build_scalar_field(4, flatbuffers_, bpio_LedFrameRequest_gamma, flatbuffers_float, float, 4, 4, 1.00000000f, bpio_LedFrameRequest)
+__flatbuffers_build_scalar_field(5, flatbuffers_, bpio_LedFrameRequest_show, flatbuffers_bool, flatbuffers_bool_t, 1, 1, UINT8_C(1), bpio_LedFrameRequest)
+
+static inline bpio_LedFrameRequest_ref_t bpio_LedFrameRequest_create(flatbuffers_builder_t *B __bpio_LedFrameRequest_formal_args)
+{
+    if (bpio_LedFrameRequest_start(B)
+        || bpio_LedFrameRequest_leds_add(B, v0)
+        || bpio_LedFrameRequest_first_add(B, v1)
+        || bpio_LedFrameRequest_pixels_add(B, v2)
+        || bpio_LedFrameRequest_gamma_add(B, v4)
+        || bpio_LedFrameRequest_brightness_add(B, v3)
+        || bpio_LedFrameRequest_show_add(B, v5)) {
+        return 0;
+    }
+    return bpio_LedFrameRequest_end(B);
+}
+
+static bpio_LedFrameRequest_ref_t bpio_LedFrameRequest_clone(flatbuffers_builder_t *B, bpio_LedFrameRequest_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_LedFrameRequest_start(B)
+        || bpio_LedFrameRequest_leds_pick(B, t)
+        || bpio_LedFrameRequest_first_pick(B, t)
+        || bpio_LedFrameRequest_pixels_pick(B, t)
+        || bpio_LedFrameRequest_gamma_pick(B, t)
+        || bpio_LedFrameRequest_brightness_pick(B, t)
+        || bpio_LedFrameRequest_show_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_LedFrameRequest_end(B));
+}
+
+__flatbuffers_build_string_field(0, flatbuffers_, bpio_LedFrameResponse_error, bpio_LedFrameResponse)
+__flatbuffers_build_scalar_field(1, flatbuffers_, bpio_LedFrameResponse_leds, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_LedFrameResponse)
+__flatbuffers_build_scalar_field(2, flatbuffers_, bpio_LedFrameResponse_frames, flatbuffers_uint32, uint32_t, 4, 4, UINT32_C(0), bpio_LedFrameResponse)
+
+static inline bpio_LedFrameResponse_ref_t bpio_LedFrameResponse_create(flatbuffers_builder_t *B __bpio_LedFrameResponse_formal_args)
+{
+    if (bpio_LedFrameResponse_start(B)
+        || bpio_LedFrameResponse_error_add(B, v0)
+        || bpio_LedFrameResponse_leds_add(B, v1)
+        || bpio_LedFrameResponse_frames_add(B, v2)) {
+        return 0;
+    }
+    return bpio_LedFrameResponse_end(B);
+}
+
+static bpio_LedFrameResponse_ref_t bpio_LedFrameResponse_clone(flatbuffers_builder_t *B, bpio_LedFrameResponse_table_t t)
+{
+    __flatbuffers_memoize_begin(B, t);
+    if (bpio_LedFrameResponse_start(B)
+        || bpio_LedFrameResponse_error_pick(B, t)
+        || bpio_LedFrameResponse_leds_pick(B, t)
+        || bpio_LedFrameResponse_frames_pick(B, t)) {
+        return 0;
+    }
+    __flatbuffers_memoize_end(B, t, bpio_LedFrameResponse_end(B));
+}
+
 __flatbuffers_build_scalar_field(0, flatbuffers_, bpio_RequestPacket_version_major, flatbuffers_uint8, uint8_t, 1, 1, UINT8_C(0), bpio_RequestPacket)
 __flatbuffers_build_scalar_field(1, flatbuffers_, bpio_RequestPacket_minimum_version_minor, flatbuffers_uint16, uint16_t, 2, 2, UINT16_C(0), bpio_RequestPacket)
 __flatbuffers_build_union_field(3, flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, bpio_RequestPacket)
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, StatusRequest, bpio_StatusRequest)
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, ConfigurationRequest, bpio_ConfigurationRequest)
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, DataRequest, bpio_DataRequest)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, HashRequest, bpio_HashRequest)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, ScopeRequest, bpio_ScopeRequest)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, JtagRequest, bpio_JtagRequest)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_RequestPacket_contents, bpio_RequestPacketContents, LedFrameRequest, bpio_LedFrameRequest)
 
 static inline bpio_RequestPacket_ref_t bpio_RequestPacket_create(flatbuffers_builder_t *B __bpio_RequestPacket_formal_args)
 {
@@ -571,6 +1032,10 @@ __flatbuffers_build_union_field(2, flatbuffers_, bpio_ResponsePacket_contents, b
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, StatusResponse, bpio_StatusResponse)
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, ConfigurationResponse, bpio_ConfigurationResponse)
 __flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, DataResponse, bpio_DataResponse)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, HashResponse, bpio_HashResponse)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, ScopeResponse, bpio_ScopeResponse)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, JtagResponse, bpio_JtagResponse)
+__flatbuffers_build_union_table_value_field(flatbuffers_, bpio_ResponsePacket_contents, bpio_ResponsePacketContents, LedFrameResponse, bpio_LedFrameResponse)
 
 static inline bpio_ResponsePacket_ref_t bpio_ResponsePacket_create(flatbuffers_builder_t *B __bpio_ResponsePacket_formal_args)
 {
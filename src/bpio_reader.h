@@ -47,6 +47,38 @@ typedef const struct bpio_DataResponse_table *bpio_DataResponse_table_t;
 typedef struct bpio_DataResponse_table *bpio_DataResponse_mutable_table_t;
 typedef const flatbuffers_uoffset_t *bpio_DataResponse_vec_t;
 typedef flatbuffers_uoffset_t *bpio_DataResponse_mutable_vec_t;
+typedef const struct bpio_HashRequest_table *bpio_HashRequest_table_t;
+typedef struct bpio_HashRequest_table *bpio_HashRequest_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_HashRequest_vec_t;
+typedef flatbuffers_uoffset_t *bpio_HashRequest_mutable_vec_t;
+typedef const struct bpio_HashResponse_table *bpio_HashResponse_table_t;
+typedef struct bpio_HashResponse_table *bpio_HashResponse_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_HashResponse_vec_t;
+typedef flatbuffers_uoffset_t *bpio_HashResponse_mutable_vec_t;
+typedef const struct bpio_ScopeRequest_table *bpio_ScopeRequest_table_t;
+typedef struct bpio_ScopeRequest_table *bpio_ScopeRequest_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_ScopeRequest_vec_t;
+typedef flatbuffers_uoffset_t *bpio_ScopeRequest_mutable_vec_t;
+typedef const struct bpio_ScopeResponse_table *bpio_ScopeResponse_table_t;
+typedef struct bpio_ScopeResponse_table *bpio_ScopeResponse_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_ScopeResponse_vec_t;
+typedef flatbuffers_uoffset_t *bpio_ScopeResponse_mutable_vec_t;
+typedef const struct bpio_JtagRequest_table *bpio_JtagRequest_table_t;
+typedef struct bpio_JtagRequest_table *bpio_JtagRequest_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_JtagRequest_vec_t;
+typedef flatbuffers_uoffset_t *bpio_JtagRequest_mutable_vec_t;
+typedef const struct bpio_JtagResponse_table *bpio_JtagResponse_table_t;
+typedef struct bpio_JtagResponse_table *bpio_JtagResponse_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_JtagResponse_vec_t;
+typedef flatbuffers_uoffset_t *bpio_JtagResponse_mutable_vec_t;
+typedef const struct bpio_LedFrameRequest_table *bpio_LedFrameRequest_table_t;
+typedef struct bpio_LedFrameRequest_table *bpio_LedFrameRequest_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_LedFrameRequest_vec_t;
+typedef flatbuffers_uoffset_t *bpio_LedFrameRequest_mutable_vec_t;
+typedef const struct bpio_LedFrameResponse_table *bpio_LedFrameResponse_table_t;
+typedef struct bpio_LedFrameResponse_table *bpio_LedFrameResponse_mutable_table_t;
+typedef const flatbuffers_uoffset_t *bpio_LedFrameResponse_vec_t;
+typedef flatbuffers_uoffset_t *bpio_LedFrameResponse_mutable_vec_t;
 typedef const struct bpio_RequestPacket_table *bpio_RequestPacket_table_t;
 typedef struct bpio_RequestPacket_table *bpio_RequestPacket_mutable_table_t;
 typedef const flatbuffers_uoffset_t *bpio_RequestPacket_vec_t;
@@ -139,6 +171,102 @@ typedef flatbuffers_uoffset_t *bpio_ResponsePacket_mutable_vec_t;
 #ifndef bpio_DataResponse_file_extension
 #define bpio_DataResponse_file_extension "bin"
 #endif
+#ifndef bpio_HashRequest_file_identifier
+#define bpio_HashRequest_file_identifier 0
+#endif
+/* deprecated, use bpio_HashRequest_file_identifier */
+#ifndef bpio_HashRequest_identifier
+#define bpio_HashRequest_identifier 0
+#endif
+#define bpio_HashRequest_type_hash ((flatbuffers_thash_t)0x92bab374)
+#define bpio_HashRequest_type_identifier "\x74\xb3\xba\x92"
+#ifndef bpio_HashRequest_file_extension
+#define bpio_HashRequest_file_extension "bin"
+#endif
+#ifndef bpio_HashResponse_file_identifier
+#define bpio_HashResponse_file_identifier 0
+#endif
+/* deprecated, use bpio_HashResponse_file_identifier */
+#ifndef bpio_HashResponse_identifier
+#define bpio_HashResponse_identifier 0
+#endif
+#define bpio_HashResponse_type_hash ((flatbuffers_thash_t)0x63942fd8)
+#define bpio_HashResponse_type_identifier "\xd8\x2f\x94\x63"
+#ifndef bpio_HashResponse_file_extension
+#define bpio_HashResponse_file_extension "bin"
+#endif
+#ifndef bpio_ScopeRequest_file_identifier
+#define bpio_ScopeRequest_file_identifier 0
+#endif
+/* deprecated, use bpio_ScopeRequest_file_identifier */
+#ifndef bpio_ScopeRequest_identifier
+#define bpio_ScopeRequest_identifier 0
+#endif
+#define bpio_ScopeRequest_type_hash ((flatbuffers_thash_t)0x83a3a696)
+#define bpio_ScopeRequest_type_identifier "\x96\xa6\xa3\x83"
+#ifndef bpio_ScopeRequest_file_extension
+#define bpio_ScopeRequest_file_extension "bin"
+#endif
+#ifndef bpio_ScopeResponse_file_identifier
+#define bpio_ScopeResponse_file_identifier 0
+#endif
+/* deprecated, use bpio_ScopeResponse_file_identifier */
+#ifndef bpio_ScopeResponse_identifier
+#define bpio_ScopeResponse_identifier 0
+#endif
+#define bpio_ScopeResponse_type_hash ((flatbuffers_thash_t)0xd8e767ea)
+#define bpio_ScopeResponse_type_identifier "\xea\x67\xe7\xd8"
+#ifndef bpio_ScopeResponse_file_extension
+#define bpio_ScopeResponse_file_extension "bin"
+#endif
+#ifndef bpio_JtagRequest_file_identifier
+#define bpio_JtagRequest_file_identifier 0
+#endif
+/* deprecated, use bpio_JtagRequest_file_identifier */
+#ifndef bpio_JtagRequest_identifier
+#define bpio_JtagRequest_identifier 0
+#endif
+#define bpio_JtagRequest_type_hash ((flatbuffers_thash_t)0x38657f06)
+#define bpio_JtagRequest_type_identifier "\x06\x7f\x65\x38"
+#ifndef bpio_JtagRequest_file_extension
+#define bpio_JtagRequest_file_extension "bin"
+#endif
+#ifndef bpio_JtagResponse_file_identifier
+#define bpio_JtagResponse_file_identifier 0
+#endif
+/* deprecated, use bpio_JtagResponse_file_identifier */
+#ifndef bpio_JtagResponse_identifier
+#define bpio_JtagResponse_identifier 0
+#endif
+#define bpio_JtagResponse_type_hash ((flatbuffers_thash_t)0x6221fbda)
+#define bpio_JtagResponse_type_identifier "\xda\xfb\x21\x62"
+#ifndef bpio_JtagResponse_file_extension
+#define bpio_JtagResponse_file_extension "bin"
+#endif
+#ifndef bpio_LedFrameRequest_file_identifier
+#define bpio_LedFrameRequest_file_identifier 0
+#endif
+/* deprecated, use bpio_LedFrameRequest_file_identifier */
+#ifndef bpio_LedFrameRequest_identifier
+#define bpio_LedFrameRequest_identifier 0
+#endif
+#define bpio_LedFrameRequest_type_hash ((flatbuffers_thash_t)0xa264afae)
+#define bpio_LedFrameRequest_type_identifier "\xae\xaf\x64\xa2"
+#ifndef bpio_LedFrameRequest_file_extension
+#define bpio_LedFrameRequest_file_extension "bin"
+#endif
+#ifndef bpio_LedFrameResponse_file_identifier
+#define bpio_LedFrameResponse_file_identifier 0
+#endif
+/* deprecated, use bpio_LedFrameResponse_file_identifier */
+#ifndef bpio_LedFrameResponse_identifier
+#define bpio_LedFrameResponse_identifier 0
+#endif
+#define bpio_LedFrameResponse_type_hash ((flatbuffers_thash_t)0x742946f2)
+#define bpio_LedFrameResponse_type_identifier "\xf2\x46\x29\x74"
+#ifndef bpio_LedFrameResponse_file_extension
+#define bpio_LedFrameResponse_file_extension "bin"
+#endif
 #ifndef bpio_RequestPacket_file_identifier
 #define bpio_RequestPacket_file_identifier 0
 #endif
@@ -175,6 +303,7 @@ __flatbuffers_define_integer_type(bpio_StatusRequestTypes, bpio_StatusRequestTyp
 #define bpio_StatusRequestTypes_IO ((bpio_StatusRequestTypes_enum_t)INT8_C(6))
 #define bpio_StatusRequestTypes_Disk ((bpio_StatusRequestTypes_enum_t)INT8_C(7))
 #define bpio_StatusRequestTypes_LED ((bpio_StatusRequestTypes_enum_t)INT8_C(8))
+#define bpio_StatusRequestTypes_Perf ((bpio_StatusRequestTypes_enum_t)INT8_C(9))
 
 static inline const char *bpio_StatusRequestTypes_name(bpio_StatusRequestTypes_enum_t value)
 {
@@ -188,6 +317,7 @@ static inline const char *bpio_StatusRequestTypes_name(bpio_StatusRequestTypes_e
     case bpio_StatusRequestTypes_IO: return "IO";
     case bpio_StatusRequestTypes_Disk: return "Disk";
     case bpio_StatusRequestTypes_LED: return "LED";
+    case bpio_StatusRequestTypes_Perf: return "Perf";
     default: return "";
     }
 }
@@ -204,6 +334,7 @@ static inline int bpio_StatusRequestTypes_is_known_value(bpio_StatusRequestTypes
     case bpio_StatusRequestTypes_IO: return 1;
     case bpio_StatusRequestTypes_Disk: return 1;
     case bpio_StatusRequestTypes_LED: return 1;
+    case bpio_StatusRequestTypes_Perf: return 1;
     default: return 0;
     }
 }
@@ -219,6 +350,7 @@ __flatbuffers_offset_vec_at(bpio_StatusRequest_table_t, vec, i, 0)
 __flatbuffers_table_as_root(bpio_StatusRequest)
 
 __flatbuffers_define_vector_field(0, bpio_StatusRequest, query, bpio_StatusRequestTypes_vec_t, 0)
+__flatbuffers_define_scalar_field(1, bpio_StatusRequest, perf_reset, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
 
 struct bpio_StatusResponse_table { uint8_t unused__; };
 
@@ -257,6 +389,11 @@ __flatbuffers_define_scalar_field(25, bpio_StatusResponse, io_value, flatbuffers
 __flatbuffers_define_scalar_field(26, bpio_StatusResponse, disk_size_mb, flatbuffers_float, float, 0.00000000f)
 __flatbuffers_define_scalar_field(27, bpio_StatusResponse, disk_used_mb, flatbuffers_float, float, 0.00000000f)
 __flatbuffers_define_scalar_field(28, bpio_StatusResponse, led_count, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_vector_field(29, bpio_StatusResponse, perf_probes, flatbuffers_string_vec_t, 0)
+__flatbuffers_define_vector_field(30, bpio_StatusResponse, perf_count, flatbuffers_uint32_vec_t, 0)
+__flatbuffers_define_vector_field(31, bpio_StatusResponse, perf_min_us, flatbuffers_uint32_vec_t, 0)
+__flatbuffers_define_vector_field(32, bpio_StatusResponse, perf_max_us, flatbuffers_uint32_vec_t, 0)
+__flatbuffers_define_vector_field(33, bpio_StatusResponse, perf_avg_us, flatbuffers_uint32_vec_t, 0)
 
 struct bpio_ModeConfiguration_table { uint8_t unused__; };
 
@@ -345,6 +482,133 @@ __flatbuffers_table_as_root(bpio_DataResponse)
 __flatbuffers_define_string_field(0, bpio_DataResponse, error, 0)
 __flatbuffers_define_vector_field(1, bpio_DataResponse, data_read, flatbuffers_uint8_vec_t, 0)
 __flatbuffers_define_scalar_field(2, bpio_DataResponse, is_async, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+
+struct bpio_HashRequest_table { uint8_t unused__; };
+
+static inline size_t bpio_HashRequest_vec_len(bpio_HashRequest_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_HashRequest_table_t bpio_HashRequest_vec_at(bpio_HashRequest_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_HashRequest_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_HashRequest)
+
+__flatbuffers_define_string_field(0, bpio_HashRequest, target, 0)
+__flatbuffers_define_scalar_field(1, bpio_HashRequest, start_address, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(2, bpio_HashRequest, length, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(3, bpio_HashRequest, i2c_address, flatbuffers_uint8, uint8_t, UINT8_C(80))
+__flatbuffers_define_scalar_field(4, bpio_HashRequest, data_lines, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(5, bpio_HashRequest, sha256, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(1))
+
+struct bpio_HashResponse_table { uint8_t unused__; };
+
+static inline size_t bpio_HashResponse_vec_len(bpio_HashResponse_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_HashResponse_table_t bpio_HashResponse_vec_at(bpio_HashResponse_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_HashResponse_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_HashResponse)
+
+__flatbuffers_define_string_field(0, bpio_HashResponse, error, 0)
+__flatbuffers_define_scalar_field(1, bpio_HashResponse, length, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(2, bpio_HashResponse, crc32, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_vector_field(3, bpio_HashResponse, sha256, flatbuffers_uint8_vec_t, 0)
+
+struct bpio_ScopeRequest_table { uint8_t unused__; };
+
+static inline size_t bpio_ScopeRequest_vec_len(bpio_ScopeRequest_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_ScopeRequest_table_t bpio_ScopeRequest_vec_at(bpio_ScopeRequest_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_ScopeRequest_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_ScopeRequest)
+
+__flatbuffers_define_scalar_field(0, bpio_ScopeRequest, run, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(1, bpio_ScopeRequest, run_pin, flatbuffers_int8, int8_t, INT8_C(-1))
+__flatbuffers_define_scalar_field(2, bpio_ScopeRequest, run_mode, flatbuffers_uint8, uint8_t, UINT8_C(255))
+__flatbuffers_define_scalar_field(3, bpio_ScopeRequest, stop, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(4, bpio_ScopeRequest, sequence, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(5, bpio_ScopeRequest, sample_offset, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(6, bpio_ScopeRequest, sample_count, flatbuffers_uint32, uint32_t, UINT32_C(0))
+
+struct bpio_ScopeResponse_table { uint8_t unused__; };
+
+static inline size_t bpio_ScopeResponse_vec_len(bpio_ScopeResponse_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_ScopeResponse_table_t bpio_ScopeResponse_vec_at(bpio_ScopeResponse_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_ScopeResponse_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_ScopeResponse)
+
+__flatbuffers_define_string_field(0, bpio_ScopeResponse, error, 0)
+__flatbuffers_define_scalar_field(1, bpio_ScopeResponse, sequence, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(2, bpio_ScopeResponse, running, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(3, bpio_ScopeResponse, pin, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(4, bpio_ScopeResponse, sample_rate_hz, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(5, bpio_ScopeResponse, trigger_type, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(6, bpio_ScopeResponse, trigger_level_mv, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(7, bpio_ScopeResponse, trigger_index, flatbuffers_int32, int32_t, INT32_C(0))
+__flatbuffers_define_scalar_field(8, bpio_ScopeResponse, counts_per_5v, flatbuffers_uint16, uint16_t, UINT16_C(0))
+__flatbuffers_define_scalar_field(9, bpio_ScopeResponse, frame_samples, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(10, bpio_ScopeResponse, sample_offset, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(11, bpio_ScopeResponse, sample_count, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_vector_field(12, bpio_ScopeResponse, samples, flatbuffers_uint8_vec_t, 0)
+
+struct bpio_JtagRequest_table { uint8_t unused__; };
+
+static inline size_t bpio_JtagRequest_vec_len(bpio_JtagRequest_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_JtagRequest_table_t bpio_JtagRequest_vec_at(bpio_JtagRequest_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_JtagRequest_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_JtagRequest)
+
+__flatbuffers_define_scalar_field(0, bpio_JtagRequest, reset, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_vector_field(1, bpio_JtagRequest, tms, flatbuffers_uint8_vec_t, 0)
+__flatbuffers_define_scalar_field(2, bpio_JtagRequest, tms_bits, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(3, bpio_JtagRequest, shift, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_vector_field(4, bpio_JtagRequest, tdi, flatbuffers_uint8_vec_t, 0)
+__flatbuffers_define_scalar_field(5, bpio_JtagRequest, shift_bits, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(6, bpio_JtagRequest, read_tdo, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(7, bpio_JtagRequest, swd_transfer, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(8, bpio_JtagRequest, swd_ap, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(9, bpio_JtagRequest, swd_read, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(10, bpio_JtagRequest, swd_addr, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(11, bpio_JtagRequest, swd_data, flatbuffers_uint32, uint32_t, UINT32_C(0))
+
+struct bpio_JtagResponse_table { uint8_t unused__; };
+
+static inline size_t bpio_JtagResponse_vec_len(bpio_JtagResponse_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_JtagResponse_table_t bpio_JtagResponse_vec_at(bpio_JtagResponse_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_JtagResponse_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_JtagResponse)
+
+__flatbuffers_define_string_field(0, bpio_JtagResponse, error, 0)
+__flatbuffers_define_vector_field(1, bpio_JtagResponse, tdo, flatbuffers_uint8_vec_t, 0)
+__flatbuffers_define_scalar_field(2, bpio_JtagResponse, swd_ack, flatbuffers_uint8, uint8_t, UINT8_C(0))
+__flatbuffers_define_scalar_field(3, bpio_JtagResponse, swd_data, flatbuffers_uint32, uint32_t, UINT32_C(0))
+
+struct bpio_LedFrameRequest_table { uint8_t unused__; };
+
+static inline size_t bpio_LedFrameRequest_vec_len(bpio_LedFrameRequest_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_LedFrameRequest_table_t bpio_LedFrameRequest_vec_at(bpio_LedFrameRequest_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_LedFrameRequest_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_LedFrameRequest)
+
+__flatbuffers_define_scalar_field(0, bpio_LedFrameRequest, leds, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(1, bpio_LedFrameRequest, first, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_vector_field(2, bpio_LedFrameRequest, pixels, flatbuffers_uint8_vec_t, 0)
+__flatbuffers_define_scalar_field(3, bpio_LedFrameRequest, brightness, flatbuffers_uint8, uint8_t, UINT8_C(255))
+__flatbuffers_define_scalar_field(4, bpio_LedFrameRequest, gamma, flatbuffers_float, float, 1.00000000f)
+__flatbuffers_define_scalar_field(5, bpio_LedFrameRequest, show, flatbuffers_bool, flatbuffers_bool_t, UINT8_C(1))
+
+struct bpio_LedFrameResponse_table { uint8_t unused__; };
+
+static inline size_t bpio_LedFrameResponse_vec_len(bpio_LedFrameResponse_vec_t vec)
+__flatbuffers_vec_len(vec)
+static inline bpio_LedFrameResponse_table_t bpio_LedFrameResponse_vec_at(bpio_LedFrameResponse_vec_t vec, size_t i)
+__flatbuffers_offset_vec_at(bpio_LedFrameResponse_table_t, vec, i, 0)
+__flatbuffers_table_as_root(bpio_LedFrameResponse)
+
+__flatbuffers_define_string_field(0, bpio_LedFrameResponse, error, 0)
+__flatbuffers_define_scalar_field(1, bpio_LedFrameResponse, leds, flatbuffers_uint32, uint32_t, UINT32_C(0))
+__flatbuffers_define_scalar_field(2, bpio_LedFrameResponse, frames, flatbuffers_uint32, uint32_t, UINT32_C(0))
 typedef uint8_t bpio_RequestPacketContents_union_type_t;
 __flatbuffers_define_integer_type(bpio_RequestPacketContents, bpio_RequestPacketContents_union_type_t, 8)
 __flatbuffers_define_union(flatbuffers_, bpio_RequestPacketContents)
@@ -352,6 +616,10 @@ __flatbuffers_define_union(flatbuffers_, bpio_RequestPacketContents)
 #define bpio_RequestPacketContents_StatusRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(1))
 #define bpio_RequestPacketContents_ConfigurationRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(2))
 #define bpio_RequestPacketContents_DataRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(3))
+#define bpio_RequestPacketContents_HashRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(4))
+#define bpio_RequestPacketContents_ScopeRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(5))
+#define bpio_RequestPacketContents_JtagRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(6))
+#define bpio_RequestPacketContents_LedFrameRequest ((bpio_RequestPacketContents_union_type_t)UINT8_C(7))
 
 static inline const char *bpio_RequestPacketContents_type_name(bpio_RequestPacketContents_union_type_t type)
 {
@@ -360,6 +628,10 @@ static inline const char *bpio_RequestPacketContents_type_name(bpio_RequestPacke
     case bpio_RequestPacketContents_StatusRequest: return "StatusRequest";
     case bpio_RequestPacketContents_ConfigurationRequest: return "ConfigurationRequest";
     case bpio_RequestPacketContents_DataRequest: return "DataRequest";
+    case bpio_RequestPacketContents_HashRequest: return "HashRequest";
+    case bpio_RequestPacketContents_ScopeRequest: return "ScopeRequest";
+    case bpio_RequestPacketContents_JtagRequest: return "JtagRequest";
+    case bpio_RequestPacketContents_LedFrameRequest: return "LedFrameRequest";
     default: return "";
     }
 }
@@ -371,6 +643,10 @@ static inline int bpio_RequestPacketContents_is_known_type(bpio_RequestPacketCon
     case bpio_RequestPacketContents_StatusRequest: return 1;
     case bpio_RequestPacketContents_ConfigurationRequest: return 1;
     case bpio_RequestPacketContents_DataRequest: return 1;
+    case bpio_RequestPacketContents_HashRequest: return 1;
+    case bpio_RequestPacketContents_ScopeRequest: return 1;
+    case bpio_RequestPacketContents_JtagRequest: return 1;
+    case bpio_RequestPacketContents_LedFrameRequest: return 1;
     default: return 0;
     }
 }
@@ -394,6 +670,10 @@ __flatbuffers_define_union(flatbuffers_, bpio_ResponsePacketContents)
 #define bpio_ResponsePacketContents_StatusResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(1))
 #define bpio_ResponsePacketContents_ConfigurationResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(2))
 #define bpio_ResponsePacketContents_DataResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(3))
+#define bpio_ResponsePacketContents_HashResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(4))
+#define bpio_ResponsePacketContents_ScopeResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(5))
+#define bpio_ResponsePacketContents_JtagResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(6))
+#define bpio_ResponsePacketContents_LedFrameResponse ((bpio_ResponsePacketContents_union_type_t)UINT8_C(7))
 
 static inline const char *bpio_ResponsePacketContents_type_name(bpio_ResponsePacketContents_union_type_t type)
 {
@@ -402,6 +682,10 @@ static inline const char *bpio_ResponsePacketContents_type_name(bpio_ResponsePac
     case bpio_ResponsePacketContents_StatusResponse: return "StatusResponse";
     case bpio_ResponsePacketContents_ConfigurationResponse: return "ConfigurationResponse";
     case bpio_ResponsePacketContents_DataResponse: return "DataResponse";
+    case bpio_ResponsePacketContents_HashResponse: return "HashResponse";
+    case bpio_ResponsePacketContents_ScopeResponse: return "ScopeResponse";
+    case bpio_ResponsePacketContents_JtagResponse: return "JtagResponse";
+    case bpio_ResponsePacketContents_LedFrameResponse: return "LedFrameResponse";
     default: return "";
     }
 }
@@ -413,6 +697,10 @@ static inline int bpio_ResponsePacketContents_is_known_type(bpio_ResponsePacketC
     case bpio_ResponsePacketContents_StatusResponse: return 1;
     case bpio_ResponsePacketContents_ConfigurationResponse: return 1;
     case bpio_ResponsePacketContents_DataResponse: return 1;
+    case bpio_ResponsePacketContents_HashResponse: return 1;
+    case bpio_ResponsePacketContents_ScopeResponse: return 1;
+    case bpio_ResponsePacketContents_JtagResponse: return 1;
+    case bpio_ResponsePacketContents_LedFrameResponse: return 1;
     default: return 0;
     }
 }
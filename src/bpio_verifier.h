@@ -16,6 +16,14 @@ static int bpio_ConfigurationRequest_verify_table(flatcc_table_verifier_descript
 static int bpio_ConfigurationResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
 static int bpio_DataRequest_verify_table(flatcc_table_verifier_descriptor_t *td);
 static int bpio_DataResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_HashRequest_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_HashResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_ScopeRequest_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_ScopeResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_JtagRequest_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_JtagResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_LedFrameRequest_verify_table(flatcc_table_verifier_descriptor_t *td);
+static int bpio_LedFrameResponse_verify_table(flatcc_table_verifier_descriptor_t *td);
 static int bpio_RequestPacket_verify_table(flatcc_table_verifier_descriptor_t *td);
 static int bpio_ResponsePacket_verify_table(flatcc_table_verifier_descriptor_t *td);
 
@@ -25,6 +33,10 @@ static int bpio_RequestPacketContents_union_verifier(flatcc_union_verifier_descr
     case 1: return flatcc_verify_union_table(ud, bpio_StatusRequest_verify_table); /* StatusRequest */
     case 2: return flatcc_verify_union_table(ud, bpio_ConfigurationRequest_verify_table); /* ConfigurationRequest */
     case 3: return flatcc_verify_union_table(ud, bpio_DataRequest_verify_table); /* DataRequest */
+    case 4: return flatcc_verify_union_table(ud, bpio_HashRequest_verify_table); /* HashRequest */
+    case 5: return flatcc_verify_union_table(ud, bpio_ScopeRequest_verify_table); /* ScopeRequest */
+    case 6: return flatcc_verify_union_table(ud, bpio_JtagRequest_verify_table); /* JtagRequest */
+    case 7: return flatcc_verify_union_table(ud, bpio_LedFrameRequest_verify_table); /* LedFrameRequest */
     default: return flatcc_verify_ok;
     }
 }
@@ -35,6 +47,10 @@ static int bpio_ResponsePacketContents_union_verifier(flatcc_union_verifier_desc
     case 1: return flatcc_verify_union_table(ud, bpio_StatusResponse_verify_table); /* StatusResponse */
     case 2: return flatcc_verify_union_table(ud, bpio_ConfigurationResponse_verify_table); /* ConfigurationResponse */
     case 3: return flatcc_verify_union_table(ud, bpio_DataResponse_verify_table); /* DataResponse */
+    case 4: return flatcc_verify_union_table(ud, bpio_HashResponse_verify_table); /* HashResponse */
+    case 5: return flatcc_verify_union_table(ud, bpio_ScopeResponse_verify_table); /* ScopeResponse */
+    case 6: return flatcc_verify_union_table(ud, bpio_JtagResponse_verify_table); /* JtagResponse */
+    case 7: return flatcc_verify_union_table(ud, bpio_LedFrameResponse_verify_table); /* LedFrameResponse */
     default: return flatcc_verify_ok;
     }
 }
@@ -43,6 +59,7 @@ static int bpio_StatusRequest_verify_table(flatcc_table_verifier_descriptor_t *t
 {
     int ret;
     if ((ret = flatcc_verify_vector_field(td, 0, 0, 1, 1, INT64_C(4294967295)) /* query */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 1, 1) /* perf_reset */)) return ret;
     return flatcc_verify_ok;
 }
 
@@ -118,6 +135,11 @@ static int bpio_StatusResponse_verify_table(flatcc_table_verifier_descriptor_t *
     if ((ret = flatcc_verify_field(td, 26, 4, 4) /* disk_size_mb */)) return ret;
     if ((ret = flatcc_verify_field(td, 27, 4, 4) /* disk_used_mb */)) return ret;
     if ((ret = flatcc_verify_field(td, 28, 1, 1) /* led_count */)) return ret;
+    if ((ret = flatcc_verify_string_vector_field(td, 29, 0) /* perf_probes */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 30, 0, 4, 4, INT64_C(1073741823)) /* perf_count */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 31, 0, 4, 4, INT64_C(1073741823)) /* perf_min_us */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 32, 0, 4, 4, INT64_C(1073741823)) /* perf_max_us */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 33, 0, 4, 4, INT64_C(1073741823)) /* perf_avg_us */)) return ret;
     return flatcc_verify_ok;
 }
 
@@ -434,6 +456,429 @@ static inline int bpio_DataResponse_verify_as_root_with_type_hash_and_size(const
     return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_DataResponse_verify_table);
 }
 
+static int bpio_HashRequest_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_string_field(td, 0, 0) /* target */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 4, 4) /* start_address */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 4, 4) /* length */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 1, 1) /* i2c_address */)) return ret;
+    if ((ret = flatcc_verify_field(td, 4, 1, 1) /* data_lines */)) return ret;
+    if ((ret = flatcc_verify_field(td, 5, 1, 1) /* sha256 */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_HashRequest_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_HashRequest_identifier, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_HashRequest_identifier, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_HashRequest_type_identifier, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_HashRequest_type_identifier, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_HashRequest_verify_table);
+}
+
+static inline int bpio_HashRequest_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_HashRequest_verify_table);
+}
+
+static int bpio_HashResponse_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_string_field(td, 0, 0) /* error */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 4, 4) /* length */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 4, 4) /* crc32 */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 3, 0, 1, 1, INT64_C(4294967295)) /* sha256 */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_HashResponse_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_HashResponse_identifier, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_HashResponse_identifier, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_HashResponse_type_identifier, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_HashResponse_type_identifier, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_HashResponse_verify_table);
+}
+
+static inline int bpio_HashResponse_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_HashResponse_verify_table);
+}
+
+static int bpio_ScopeRequest_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_field(td, 0, 1, 1) /* run */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 1, 1) /* run_pin */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 1, 1) /* run_mode */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 1, 1) /* stop */)) return ret;
+    if ((ret = flatcc_verify_field(td, 4, 4, 4) /* sequence */)) return ret;
+    if ((ret = flatcc_verify_field(td, 5, 4, 4) /* sample_offset */)) return ret;
+    if ((ret = flatcc_verify_field(td, 6, 4, 4) /* sample_count */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_ScopeRequest_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_ScopeRequest_identifier, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_ScopeRequest_identifier, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_ScopeRequest_type_identifier, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_ScopeRequest_type_identifier, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_ScopeRequest_verify_table);
+}
+
+static inline int bpio_ScopeRequest_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_ScopeRequest_verify_table);
+}
+
+static int bpio_ScopeResponse_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_string_field(td, 0, 0) /* error */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 4, 4) /* sequence */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 1, 1) /* running */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 1, 1) /* pin */)) return ret;
+    if ((ret = flatcc_verify_field(td, 4, 4, 4) /* sample_rate_hz */)) return ret;
+    if ((ret = flatcc_verify_field(td, 5, 1, 1) /* trigger_type */)) return ret;
+    if ((ret = flatcc_verify_field(td, 6, 4, 4) /* trigger_level_mv */)) return ret;
+    if ((ret = flatcc_verify_field(td, 7, 4, 4) /* trigger_index */)) return ret;
+    if ((ret = flatcc_verify_field(td, 8, 2, 2) /* counts_per_5v */)) return ret;
+    if ((ret = flatcc_verify_field(td, 9, 4, 4) /* frame_samples */)) return ret;
+    if ((ret = flatcc_verify_field(td, 10, 4, 4) /* sample_offset */)) return ret;
+    if ((ret = flatcc_verify_field(td, 11, 4, 4) /* sample_count */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 12, 0, 1, 1, INT64_C(4294967295)) /* samples */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_ScopeResponse_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_ScopeResponse_identifier, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_ScopeResponse_identifier, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_ScopeResponse_type_identifier, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_ScopeResponse_type_identifier, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_ScopeResponse_verify_table);
+}
+
+static inline int bpio_ScopeResponse_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_ScopeResponse_verify_table);
+}
+
+static int bpio_JtagRequest_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_field(td, 0, 1, 1) /* reset */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 1, 0, 1, 1, INT64_C(4294967295)) /* tms */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 4, 4) /* tms_bits */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 1, 1) /* shift */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 4, 0, 1, 1, INT64_C(4294967295)) /* tdi */)) return ret;
+    if ((ret = flatcc_verify_field(td, 5, 4, 4) /* shift_bits */)) return ret;
+    if ((ret = flatcc_verify_field(td, 6, 1, 1) /* read_tdo */)) return ret;
+    if ((ret = flatcc_verify_field(td, 7, 1, 1) /* swd_transfer */)) return ret;
+    if ((ret = flatcc_verify_field(td, 8, 1, 1) /* swd_ap */)) return ret;
+    if ((ret = flatcc_verify_field(td, 9, 1, 1) /* swd_read */)) return ret;
+    if ((ret = flatcc_verify_field(td, 10, 1, 1) /* swd_addr */)) return ret;
+    if ((ret = flatcc_verify_field(td, 11, 4, 4) /* swd_data */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_JtagRequest_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_JtagRequest_identifier, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_JtagRequest_identifier, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_JtagRequest_type_identifier, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_JtagRequest_type_identifier, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_JtagRequest_verify_table);
+}
+
+static inline int bpio_JtagRequest_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_JtagRequest_verify_table);
+}
+
+static int bpio_JtagResponse_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_string_field(td, 0, 0) /* error */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 1, 0, 1, 1, INT64_C(4294967295)) /* tdo */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 1, 1) /* swd_ack */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 4, 4) /* swd_data */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_JtagResponse_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_JtagResponse_identifier, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_JtagResponse_identifier, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_JtagResponse_type_identifier, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_JtagResponse_type_identifier, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_JtagResponse_verify_table);
+}
+
+static inline int bpio_JtagResponse_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_JtagResponse_verify_table);
+}
+
+static int bpio_LedFrameRequest_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_field(td, 0, 4, 4) /* leds */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 4, 4) /* first */)) return ret;
+    if ((ret = flatcc_verify_vector_field(td, 2, 0, 1, 1, INT64_C(4294967295)) /* pixels */)) return ret;
+    if ((ret = flatcc_verify_field(td, 3, 1, 1) /* brightness */)) return ret;
+    if ((ret = flatcc_verify_field(td, 4, 4, 4) /* gamma */)) return ret;
+    if ((ret = flatcc_verify_field(td, 5, 1, 1) /* show */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_LedFrameRequest_identifier, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_LedFrameRequest_identifier, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_LedFrameRequest_type_identifier, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_LedFrameRequest_type_identifier, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_LedFrameRequest_verify_table);
+}
+
+static inline int bpio_LedFrameRequest_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_LedFrameRequest_verify_table);
+}
+
+static int bpio_LedFrameResponse_verify_table(flatcc_table_verifier_descriptor_t *td)
+{
+    int ret;
+    if ((ret = flatcc_verify_string_field(td, 0, 0) /* error */)) return ret;
+    if ((ret = flatcc_verify_field(td, 1, 4, 4) /* leds */)) return ret;
+    if ((ret = flatcc_verify_field(td, 2, 4, 4) /* frames */)) return ret;
+    return flatcc_verify_ok;
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_LedFrameResponse_identifier, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_LedFrameResponse_identifier, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_typed_root(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, bpio_LedFrameResponse_type_identifier, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_typed_root_with_size(const void *buf, size_t bufsiz)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, bpio_LedFrameResponse_type_identifier, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root_with_identifier(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root(buf, bufsiz, fid, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root_with_identifier_and_size(const void *buf, size_t bufsiz, const char *fid)
+{
+    return flatcc_verify_table_as_root_with_size(buf, bufsiz, fid, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root_with_type_hash(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root(buf, bufsiz, thash, &bpio_LedFrameResponse_verify_table);
+}
+
+static inline int bpio_LedFrameResponse_verify_as_root_with_type_hash_and_size(const void *buf, size_t bufsiz, flatbuffers_thash_t thash)
+{
+    return flatcc_verify_table_as_typed_root_with_size(buf, bufsiz, thash, &bpio_LedFrameResponse_verify_table);
+}
+
 static int bpio_RequestPacket_verify_table(flatcc_table_verifier_descriptor_t *td)
 {
     int ret;
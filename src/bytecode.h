@@ -53,9 +53,11 @@ struct _bytecode {
  * Ensures _bytecode structure doesn't exceed 28 bytes, preventing
  * unintentional RAM usage increases.
  */
+#if UINTPTR_MAX == 0xffffffffu // the budget is for the 32 bit target, host tests have wider pointers
 static_assert(
     sizeof(struct _bytecode) <= 28,
     "sizeof(struct _bytecode) has increased.  This will impact RAM.  Review to ensure this is not avoidable.");
+#endif
 
 /**
  * @brief Bytecode output structure (alternative representation)
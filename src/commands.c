@@ -16,6 +16,7 @@
 #include "commands/global/freq.h"
 #include "commands/global/a_auxio.h"
 #include "commands/global/v_adc.h"
+#include "commands/global/adclog.h"
 #include "commands/global/w_psu.h"
 #include "commands/global/p_pullups.h"
 #include "commands/global/cmd_mcu.h"
@@ -43,6 +44,8 @@
 #include "commands/global/otpdump.h"
 #endif
 #include "commands/global/ovrclk.h"
+#include "commands/global/cmd_tasks.h"
+#include "commands/global/cmd_perf.h"
 
 // command configuration
 const struct _global_command_struct commands[] = {
@@ -61,6 +64,7 @@ const struct _global_command_struct commands[] = {
 { .command="g",         .allow_hiz=false, .func=&pwm_configure_disable,              .def=&pwm_disable_def, .category=CMD_CAT_IO },
 { .command="v",         .allow_hiz=true,  .func=&adc_measure_single,                 .def=&adc_single_def, .category=CMD_CAT_IO },
 { .command="V",         .allow_hiz=true,  .func=&adc_measure_cont,                   .def=&adc_cont_def, .category=CMD_CAT_IO },
+{ .command="adclog",    .allow_hiz=true,  .func=&adclog_handler,                     .def=&adclog_def, .category=CMD_CAT_IO },
 // Configure: terminal, display, mode config
 { .command="c",         .allow_hiz=true,  .func=&ui_config_main_menu,                .def=&ui_config_def, .category=CMD_CAT_CONFIGURE },
 { .command="d",         .allow_hiz=true,  .func=&ui_display_enable_args,             .def=&display_select_def, .category=CMD_CAT_CONFIGURE },
@@ -75,6 +79,8 @@ const struct _global_command_struct commands[] = {
 { .command="~",         .allow_hiz=true,  .func=&cmd_selftest_handler,               .def=&cmd_selftest_def, .category=CMD_CAT_SYSTEM },
 { .command="bug",       .allow_hiz=true,  .func=&bug_handler,                        .def=&bug_def, .category=CMD_CAT_SYSTEM },
 { .command="ovrclk",    .allow_hiz=true,  .func=&ovrclk_handler,                     .def=&ovrclk_def, .category=CMD_CAT_SYSTEM },
+{ .command="tasks",     .allow_hiz=true,  .func=&cmd_tasks_handler,                  .def=&cmd_tasks_def, .category=CMD_CAT_SYSTEM },
+{ .command="perf",      .allow_hiz=true,  .func=&cmd_perf_handler,                   .def=&cmd_perf_def, .category=CMD_CAT_SYSTEM },
 // Files: storage and file operations
 { .command="ls",        .allow_hiz=true,  .func=&disk_ls_handler,   .def=&disk_ls_def, .category=CMD_CAT_FILES },
 { .command="cd",        .allow_hiz=true,  .func=&disk_cd_handler,   .def=&disk_cd_def, .category=CMD_CAT_FILES },
@@ -23,8 +23,14 @@
 #include "binmode/fala.h"
 
 static const char* const usage[] = {
-    "scan\t[-h(elp)]",
+    "scan\t[-h(elp)] [-t(emperature)]",
     "Scan 1-Wire address space:%s scan",
+    "Scan and read all temperature sensors:%s scan -t",
+};
+
+static const bp_command_opt_t scan_1wire_opts[] = {
+    { "temperature", 't', BP_ARG_NONE, NULL, T_HELP_1WIRE_SCAN_TEMP },
+    { 0 }
 };
 
 const bp_command_def_t scan_1wire_def = {
@@ -32,7 +38,7 @@ const bp_command_def_t scan_1wire_def = {
     .description = T_HELP_1WIRE_SCAN,
     .actions = NULL,
     .action_count = 0,
-    .opts = NULL,
+    .opts = scan_1wire_opts,
     .usage = usage,
     .usage_count = count_of(usage),
 };
@@ -172,6 +178,48 @@ void ds1wire_id(unsigned char famID) {
 /* ROM Search test */
 #define TRUE 1
 #define FALSE 0
+#define SCAN_MAX_DEVICES 32
+
+static bool scan_temperature_family(unsigned char famID) {
+    return famID == 0x10 || famID == 0x22 || famID == 0x28;
+}
+
+/* One conversion for all sensors, then read them one by one */
+static void scan_read_temperatures(unsigned char (*romids)[8], int devcount) {
+    unsigned char sensors[SCAN_MAX_DEVICES][8];
+    unsigned char scratchpads[SCAN_MAX_DEVICES][9];
+    int count = 0;
+
+    for (int i = 0; i < devcount; i++) {
+        if (scan_temperature_family(romids[i][0])) {
+            memcpy(sensors[count++], romids[i], 8);
+        }
+    }
+    if (!count) {
+        return;
+    }
+
+    if (onewire_convert_read_all(sensors, count, scratchpads, 800) < 0) {
+        printf("No response\r\n");
+        return;
+    }
+
+    printf("Temperature:\r\n");
+    for (int i = 0; i < count; i++) {
+        printf("%.2x%.2x%.2x%.2x%.2x%.2x%.2x%.2x:",
+               sensors[i][0], sensors[i][1], sensors[i][2], sensors[i][3],
+               sensors[i][4], sensors[i][5], sensors[i][6], sensors[i][7]);
+        if (calc_crc8_buf(scratchpads[i], 8) != scratchpads[i][8]) {
+            printf(" CRC Fail\r\n");
+            continue;
+        }
+        int32_t temp = (int16_t)(scratchpads[i][0] | (scratchpads[i][1] << 8));
+        // DS1820/DS18S20 count half degrees, DS1822/DS18B20 1/16 degrees
+        float c = (sensors[i][0] == 0x10) ? (float)temp / 2 : (float)temp / 16;
+        printf(" %.3fC\r\n", c);
+    }
+}
+
 void onewire_test_romsearch(struct command_result* res) {
     if (bp_cmd_help_check(&scan_1wire_def, res->help_flag)) {
         return;
@@ -181,6 +229,8 @@ void onewire_test_romsearch(struct command_result* res) {
     int ret;
     int devcount;
     struct owobj search_owobj;
+    unsigned char romids[SCAN_MAX_DEVICES][8];
+    bool temperature = bp_cmd_find_flag(&scan_1wire_def, 't');
 
     /* Full  romsearch */
     printf("1-Wire ROM search:\r\n");
@@ -191,6 +241,9 @@ void onewire_test_romsearch(struct command_result* res) {
     ret = OWFirst(&search_owobj);
     devcount = 0;
     while (ret == TRUE) {
+        if (devcount < SCAN_MAX_DEVICES) {
+            memcpy(romids[devcount], search_owobj.ROM_NO, 8);
+        }
         devcount++;
         printf("%d:", devcount);
         for (i = 0; i < 8; i++) {
@@ -201,6 +254,10 @@ void onewire_test_romsearch(struct command_result* res) {
         printf(")\r\n");
         ret = OWNext(&search_owobj);
     }
+
+    if (temperature && devcount) {
+        scan_read_temperatures(romids, MIN(devcount, SCAN_MAX_DEVICES));
+    }
     
     //we manually control any FALA capture
     fala_stop_hook();
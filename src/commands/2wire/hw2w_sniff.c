@@ -15,6 +15,7 @@
 #include "usb_rx.h"
 #include "usb_tx.h"
 #include "lib/bp_args/bp_cmd.h"
+#include "pirate/tasks.h"
 
 static const char pin_labels[][5] = {
     "SDA",
@@ -136,6 +137,10 @@ void hw2w_sniff(struct command_result* res){
             }            
         }
 
+        if (!new_val) {
+            tasks_yield(); // bus is quiet, let the background tasks run
+        }
+
         // x to exit
         char c;
         if(rx_fifo_try_get(&c)){
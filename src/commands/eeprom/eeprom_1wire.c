@@ -63,6 +63,7 @@ SOFTWARE.
 #define DS243X_WRITE_MASK 0xAA    
 #define DS243X_CMD_SIZE 3
 #define DS243X_CRC_SIZE 2
+#define DS243X_TPROG_US 15000 // t_PROG = 12.5ms worst case, the bus must stay idle until it ends
 #define DS243X_MAX_PAGE_SIZE 32 //DS2433 has 32 bit page
 #define DS243X_BUFFER_SIZE (DS243X_CMD_SIZE + DS243X_MAX_PAGE_SIZE)
 
@@ -74,7 +75,8 @@ enum eeprom_actions_enum {
     EEPROM_VERIFY,
     EEPROM_TEST,
     EEPROM_LIST,
-    EEPROM_PROTECT
+    EEPROM_PROTECT,
+    EEPROM_HASH
 };
 
 static const bp_command_action_t eeprom_1wire_action_defs[] = {
@@ -86,6 +88,7 @@ static const bp_command_action_t eeprom_1wire_action_defs[] = {
     { EEPROM_TEST,    "test",    T_HELP_EEPROM_TEST },
     { EEPROM_LIST,    "list",    T_HELP_EEPROM_LIST },
     { EEPROM_PROTECT, "protect", T_HELP_EEPROM_PROTECT },
+    { EEPROM_HASH,    "hash",    T_HELP_EEPROM_HASH },
 };
 
 static const bp_command_opt_t eeprom_1wire_opts[] = {
@@ -101,7 +104,7 @@ static const bp_command_opt_t eeprom_1wire_opts[] = {
 };
 
 static const char* const usage[] = {
-    "eeprom [dump|erase|write|read|verify|test|list|protect]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-h(elp)]",
+    "eeprom [dump|erase|write|read|verify|test|list|protect|hash]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-h(elp)]",
     "List available EEPROM devices:%s eeprom list",
     "Display contents (x to exit):%s eeprom dump -d ds2431",
     "Display 16 bytes starting at address 0x10:%s eeprom dump -d ds2431 -s 0x10 -b 16",
@@ -110,6 +113,7 @@ static const char* const usage[] = {
     "Read to file, verify:%s eeprom read -d ds2431 -f example.bin -v",
     "Verify against file:%s eeprom verify -d ds2431 -f example.bin",
     "Test chip (full erase/write/verify):%s eeprom test -d ds2431",
+    "CRC32/SHA-256 of contents:%s eeprom hash -d ds2431",
     "Show write protect control block:%s eeprom protect -d ds2431",
 };
 
@@ -166,6 +170,8 @@ static bool ow_eeprom_read(struct eeprom_info *eeprom, uint32_t address, uint32_
     return false;
 }
 
+static uint32_t ow_eeprom_copy_start_us; // start of the current copy scratchpad t_PROG
+
 static bool ow_eeprom_write_page(struct eeprom_info *eeprom, uint32_t address, uint8_t *buf, uint32_t page_write_size){
 
     //get address
@@ -242,15 +248,23 @@ static bool ow_eeprom_write_page(struct eeprom_info *eeprom, uint32_t address, u
     onewire_tx_byte(TA1); //Send authorization code (TA1, TA2, E/S)
     onewire_tx_byte(TA2); // Send TA2
     onewire_tx_byte(ES); // Send E/S (DS2431_PF_MASK)
-    // Wait for the write to complete
-    busy_wait_ms(15); // t_PROG = 12.5ms worst case.
+    ow_eeprom_copy_start_us = time_us_32();
+    return false; // copy started, poll with ow_eeprom_write_busy()
+}
+
+//the DS243X can't be polled during t_PROG, report busy until it has passed then read the result
+static bool ow_eeprom_write_busy(struct eeprom_info *eeprom, bool *busy){
+    if((time_us_32() - ow_eeprom_copy_start_us) < DS243X_TPROG_US) {
+        (*busy) = true;
+        return false;
+    }
+    (*busy) = false;
     uint8_t write_result = onewire_rx_byte(); // Read the result of the write operation
     // Check if the write was successful
     if (write_result != DS243X_WRITE_MASK) {
         printf("Error: Write operation failed, expected 0x%02X, got 0x%02X\r\n", DS243X_WRITE_MASK, write_result);
         return true; // Write operation failed
     }
-
     return false; // write is complete
 }
 
@@ -318,6 +332,7 @@ static struct eeprom_hal_t ow_eeprom_hal = {
     .get_address = eeprom_get_address,
     .read = ow_eeprom_read,
     .write_page = ow_eeprom_write_page,
+    .write_busy = ow_eeprom_write_busy,
     .is_write_protected = NULL, // 1-Wire EEPROMs do not have write protection
     .probe_protect = eeprom_probe_block_protect, // probe the write protection status
 };
@@ -446,6 +461,12 @@ void onewire_eeprom_handler(struct command_result* res) {
             goto ow_eeprom_cleanup; // error during verify
         }
     }
+
+    if (eeprom.action==EEPROM_HASH) {
+        if(eeprom_action_hash(&eeprom_1wire_def, &eeprom, buf, sizeof(buf))){
+            goto ow_eeprom_cleanup; // error during hash
+        }
+    }
     printf("Success :)\r\n");
 
 ow_eeprom_cleanup:
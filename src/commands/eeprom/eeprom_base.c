@@ -14,6 +14,7 @@
 //#include "commands/i2c/eeprom.h"
 #include "pirate/file.h" // File handling related
 //#include "pirate/hwspi.h" // SPI related functions
+#include "pirate/hash.h" // CRC32/SHA-256
 #include "eeprom_base.h"
 
 bool eeprom_confirm_action(const bp_command_def_t *def){
@@ -105,7 +106,60 @@ bool eeprom_dump(const bp_command_def_t *def, struct eeprom_info *eeprom, uint8_
     return false;
 }
 
-bool eeprom_write(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, bool write_from_buf) {
+void eeprom_write_stats_init(struct eeprom_write_stats *stats) {
+    memset(stats, 0, sizeof(struct eeprom_write_stats));
+    stats->min_us = UINT32_MAX;
+}
+
+void eeprom_write_stats_print(struct eeprom_write_stats *stats) {
+    if(stats->pages == 0) return;
+    printf("\r\nWrite cycle: %d pages, min %dus, avg %dus, max %dus, %d.%02d polls/page\r\n",
+        stats->pages, stats->min_us, (uint32_t)(stats->total_us / stats->pages), stats->max_us,
+        stats->polls / stats->pages, ((stats->polls % stats->pages) * 100) / stats->pages);
+}
+
+// Wait for the write cycle started at start_us to finish.
+// Polling starts just before the learned write time, then at 1/16 of it,
+// so a 5ms part isn't hammered with bus traffic and a fast part isn't slept on.
+static bool eeprom_write_wait(struct eeprom_info *eeprom, struct eeprom_write_stats *stats, uint32_t start_us) {
+    if(stats->estimate_us) {
+        uint32_t first_poll_us = stats->estimate_us - (stats->estimate_us / 8);
+        uint32_t elapsed_us = time_us_32() - start_us;
+        if(elapsed_us < first_poll_us) {
+            busy_wait_us_32(first_poll_us - elapsed_us);
+        }
+    }
+    uint32_t interval_us = stats->estimate_us / 16;
+    if(interval_us < EEPROM_POLL_MIN_US) interval_us = EEPROM_POLL_MIN_US;
+
+    bool busy = true;
+    uint32_t cycle_us;
+    while(true) {
+        if(eeprom->device->hal->write_busy(eeprom, &busy)) return true; // bus error
+        stats->polls++;
+        cycle_us = time_us_32() - start_us;
+        if(!busy) break;
+        if(cycle_us > EEPROM_WRITE_TIMEOUT_US) {
+            printf("\r\nError: write cycle timeout\r\n");
+            return true;
+        }
+        busy_wait_us_32(interval_us);
+    }
+
+    // learn the write cycle time, the first poll lands at 7/8 of it so it tracks downward too
+    if(stats->estimate_us == 0) {
+        stats->estimate_us = cycle_us;
+    } else {
+        stats->estimate_us = ((stats->estimate_us * 3) + cycle_us) / 4;
+    }
+    stats->pages++;
+    stats->total_us += cycle_us;
+    if(cycle_us < stats->min_us) stats->min_us = cycle_us;
+    if(cycle_us > stats->max_us) stats->max_us = cycle_us;
+    return false;
+}
+
+bool eeprom_write(struct eeprom_info *eeprom, uint8_t *buf, uint8_t *prefetch_buf, uint32_t buf_size, bool write_from_buf) {
 
     uint32_t file_size_bytes; 
     if(!write_from_buf){
@@ -123,75 +177,70 @@ bool eeprom_write(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, b
     uint32_t address_blocks_total=eeprom_get_address_blocks_total(eeprom);
     // 256 bytes at a time, less for smaller devices (128 bytes)
     uint32_t write_size = eeprom_get_address_block_size(eeprom); 
-    uint32_t write_pages = write_size / eeprom->device->page_bytes;
+    uint32_t page_bytes = eeprom->device->page_bytes;
+    uint32_t write_pages = write_size / page_bytes;
     
     printf("Writing %d blocks of %d bytes each, %d pages per block\r\n", address_blocks_total, write_size, write_pages);
 
-    for(uint32_t i = 0; i < address_blocks_total; i++) {
-        uint32_t bytes_read=write_size;
-        uint32_t page_write_size = eeprom->device->page_bytes; // default page write size is the page size
-        
-        if(!write_from_buf){
-            //read the next file chunk into the buffer, close with message if error
-            if(file_read(&eeprom->file_handle, buf, write_size, &bytes_read))return true;
-            if(bytes_read == 0){ //end of file
-                //file_close(&eeprom->file_handle);
-                //return false;
-                goto eeprom_base_write_cleanup; // if we are at the end of the file, break out of the loop
+    struct eeprom_write_stats stats;
+    eeprom_write_stats_init(&stats);
+
+    uint8_t *block = buf;
+    uint32_t block_bytes = write_size;
+    if(!write_from_buf){
+        //read the first file chunk, the rest are read while the EEPROM is busy writing
+        if(file_read(&eeprom->file_handle, block, write_size, &block_bytes)) return true;
+    }
+
+    for(uint32_t i = 0; i < address_blocks_total && block_bytes; i++) {
+        print_progress(i, address_blocks_total);
+
+        // a short block is the end of the file, there is nothing to prefetch
+        uint8_t *next_block = (block == buf) ? prefetch_buf : buf;
+        uint32_t next_bytes = 0;
+        bool prefetch = !write_from_buf && (i + 1) < address_blocks_total && block_bytes == write_size;
+        bool prefetched = false;
+
+        uint32_t remaining = block_bytes;
+        for(uint32_t j = 0; j < write_pages && remaining; j++) {
+            // the last page of a file may be partial, the HAL fills it from the EEPROM
+            uint32_t page_write_size = (remaining < page_bytes) ? remaining : page_bytes;
+            uint32_t address = (i*256)+(j*page_bytes);
+            if(eeprom->device->hal->write_page(eeprom, address, &block[j*page_bytes], page_write_size)) {
+                printf("Error writing EEPROM at %d\r\n", address);
+                goto eeprom_base_write_error;
             }
-        }
+            uint32_t start_us = time_us_32();
 
-        #if !EEPROM_DEBUG
-            print_progress(i, address_blocks_total);
-        #else
-            printf("Block %d, SB: 0x%02X, address 0x%02X00, %d write pages, %d bytes\r\n", i, i2caddr_7bit, block_ptr[0], write_pages, eeprom->device->page_bytes); //debug
-        #endif
+            // read the next chunk from disk during the first write cycle of this block
+            if(prefetch && !prefetched) {
+                if(file_read(&eeprom->file_handle, next_block, write_size, &next_bytes)) return true;
+                prefetched = true;
+            }
 
-        for(uint32_t j = 0; j < write_pages; j++) {
-            bool end_of_file = false;
-            // write page to the EEPROM
-            #if !EEPROM_DEBUG
-                
-                if(!write_from_buf){
-                    if(bytes_read == 0) {
-                        //printf("\r\nEnd of file reached, stopping write 1\r\n");
-                        goto eeprom_base_write_cleanup; // if we are at the end of the file, break out of the loop
-                    }
-                    if(bytes_read < eeprom->device->page_bytes) {
-                        page_write_size = bytes_read; // if we are at the end of the file, write only the remaining bytes
-                        end_of_file = true; // we are at the end of the file
-                    }
-                }
-                
-                if(eeprom->device->hal->write_page(eeprom, (i*256)+(j*eeprom->device->page_bytes), &buf[j*eeprom->device->page_bytes], page_write_size)) {
-                    printf("Error writing EEPROM at %d\r\n", (i*256) + j);
-                    if(!write_from_buf) file_close(&eeprom->file_handle); // close the file if there was an error
-                    return true; // error
-                }
-            #else
-                printf("%d ", j);
-            #endif
-            if(!write_from_buf){
-                if(end_of_file) {
-                    // if we are at the end of the file, break out of the loop
-                    //printf("\r\nEnd of file reached, stopping write 2\r\n");
-                    goto eeprom_base_write_cleanup; 
-                }
-                bytes_read -= page_write_size; // reduce the bytes read by the page write size
+            if(eeprom_write_wait(eeprom, &stats, start_us)) {
+                printf("Error writing EEPROM at %d\r\n", address);
+                goto eeprom_base_write_error;
             }
+            remaining -= page_write_size;
         }
-        #if EEPROM_DEBUG
-            printf("\r\n");
-        #endif   
+
+        if(write_from_buf) continue; // same buffer for every block
+        if(!prefetched) break; // end of file
+        block = next_block;
+        block_bytes = next_bytes;
     }
-eeprom_base_write_cleanup:
-    #if !EEPROM_DEBUG
-        print_progress(address_blocks_total, address_blocks_total);
-    #endif
+
+    print_progress(address_blocks_total, address_blocks_total);
+    eeprom_write_stats_print(&stats);
     if(!write_from_buf){
         if(file_close(&eeprom->file_handle)) return true;
     }   
     return false; // success
+
+eeprom_base_write_error:
+    if(!write_from_buf) file_close(&eeprom->file_handle); // close the file if there was an error
+    return true; // error
 }
 
 bool eeprom_read(struct eeprom_info *eeprom, char *buf, uint32_t buf_size, char *verify_buf, uint32_t verify_buf_size, enum eeprom_read_action action) {   
@@ -287,7 +336,7 @@ eeprom_base_read_cleanup:
 bool eeprom_action_erase(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, uint8_t *verify_buf, uint32_t verify_buf_size, bool verify) {
     printf("Erase: Writing 0xFF to all bytes...\r\n");
     memset(buf, 0xFF, buf_size); // fill the buffer with 0xFF for erase
-    if (eeprom_write(eeprom, buf, buf_size, true)) {
+    if (eeprom_write(eeprom, buf, NULL, buf_size, true)) {
         return true;
     }
     printf("\r\nErase complete\r\n");
@@ -313,7 +362,7 @@ bool eeprom_action_test(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_s
             verify_buf[i] = 0x55; // odd bytes
         }
     }
-    if (eeprom_write(eeprom, verify_buf, verify_buf_size, true)) {
+    if (eeprom_write(eeprom, verify_buf, NULL, verify_buf_size, true)) {
         return true; // error during write
     }
     printf("\r\nWrite complete\r\nWrite verify...\r\n");
@@ -329,7 +378,7 @@ bool eeprom_action_test(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_s
             verify_buf[i] = 0xAA; // odd bytes
         }
     }
-    if (eeprom_write(eeprom, verify_buf, verify_buf_size, true)) {
+    if (eeprom_write(eeprom, verify_buf, NULL, verify_buf_size, true)) {
         return true; // error during write
     }
     printf("\r\nWrite complete\r\nWrite verify...\r\n");
@@ -342,7 +391,8 @@ bool eeprom_action_test(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_s
 
 bool eeprom_action_write(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, uint8_t *verify_buf, uint32_t verify_buf_size, bool verify) {
     printf("Write: Writing EEPROM from file %s...\r\n", eeprom->file_name);
-    if (eeprom_write(eeprom, buf, buf_size, false)) {
+    // verify_buf is free until the verify, use it to read ahead from the file
+    if (eeprom_write(eeprom, buf, verify_buf, buf_size, false)) {
         return true; // error during write
     }
     printf("\r\nWrite complete\r\n");
@@ -378,4 +428,57 @@ bool eeprom_action_verify(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf
         return true; // error during read
     }
     printf("\r\nVerify complete\r\n");
-} 
\ No newline at end of file
+} 
+
+bool eeprom_hash(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, uint32_t start_address, uint32_t bytes, struct hash_ctx *hash, bool quiet) {
+    if (start_address >= eeprom->device->size_bytes || bytes > (eeprom->device->size_bytes - start_address)) {
+        if(!quiet) printf("Error: Hash range is outside the EEPROM\r\n");
+        return true; // invalid range
+    }
+    uint32_t end_address = start_address + bytes;
+    uint32_t address = start_address;
+    while(address < end_address) {
+        #if !EEPROM_DEBUG
+            if(!quiet) print_progress(address - start_address, bytes);
+        #endif
+        // don't cross a 256 byte address page, the block select bits may change
+        uint32_t read_size = EEPROM_ADDRESS_PAGE_SIZE - (address % EEPROM_ADDRESS_PAGE_SIZE);
+        if(read_size > buf_size) read_size = buf_size;
+        if(read_size > (end_address - address)) read_size = end_address - address;
+        if(eeprom->device->hal->read(eeprom, address, read_size, buf)) {
+            if(!quiet) printf("Error reading EEPROM at %d\r\n", address);
+            return true; // error
+        }
+        hash_update(hash, buf, read_size);
+        address += read_size;
+    }
+    #if !EEPROM_DEBUG
+        if(!quiet) print_progress(bytes, bytes);
+    #endif
+    return false; // success
+}
+
+bool eeprom_action_hash(const bp_command_def_t *def, struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size) {
+    // whole device by default, or a range with -s and -b
+    uint32_t start_address = 0;
+    uint32_t bytes;
+    bp_cmd_get_uint32(def, 's', &start_address);
+    if(start_address >= eeprom->device->size_bytes) {
+        printf("Error: Start address (-s) is past the end of the EEPROM\r\n");
+        return true;
+    }
+    if(!bp_cmd_get_uint32(def, 'b', &bytes) || bytes > (eeprom->device->size_bytes - start_address)) {
+        bytes = eeprom->device->size_bytes - start_address;
+    }
+    printf("Hash: Reading 0x%06X-0x%06X...\r\n", start_address, start_address + bytes - 1);
+    hash_ctx_t hash;
+    uint8_t digest[HASH_SHA256_BYTES];
+    hash_init(&hash, true);
+    if(eeprom_hash(eeprom, buf, buf_size, start_address, bytes, &hash, false)) {
+        return true; // error during read
+    }
+    hash_final(&hash, digest);
+    printf("\r\n");
+    hash_print(&hash, digest);
+    return false; // success
+}
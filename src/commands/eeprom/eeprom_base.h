@@ -6,6 +6,8 @@
 
 #define EEPROM_DEBUG 0
 #define EEPROM_ADDRESS_PAGE_SIZE 256 // size of the EEPROM address page in bytes
+#define EEPROM_WRITE_TIMEOUT_US 100000 // longest page write cycle before giving up
+#define EEPROM_POLL_MIN_US 20 // shortest interval between busy polls
 
 struct bp_command_def;
 typedef struct bp_command_def bp_command_def_t;
@@ -43,11 +45,22 @@ struct eeprom_info{
 struct eeprom_hal_t {
     bool (*get_address)(struct eeprom_info *eeprom, uint32_t address, uint8_t *block_select_bits, uint8_t *address_array);
     bool (*read)(struct eeprom_info *eeprom, uint32_t address, uint32_t read_bytes, uint8_t *buf);
-    bool (*write_page)(struct eeprom_info *eeprom, uint32_t address, uint8_t *buf, uint32_t page_write_size);
+    bool (*write_page)(struct eeprom_info *eeprom, uint32_t address, uint8_t *buf, uint32_t page_write_size); // start a page write, don't wait for it
+    bool (*write_busy)(struct eeprom_info *eeprom, bool *busy); // poll once for the end of the write cycle
     bool (*is_write_protected)(struct eeprom_info *eeprom);
     bool (*probe_protect)(struct eeprom_info *eeprom); // probe the write protection status of the device
 };
 
+// page write cycle times, measured from the end of write_page() to the first not-busy poll
+struct eeprom_write_stats {
+    uint32_t pages;
+    uint32_t polls;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t estimate_us; // learned write cycle time, sets the poll timing
+};
+
 enum eeprom_read_action{
     EEPROM_READ_TO_FILE = 0,
     EEPROM_VERIFY_FILE,
@@ -97,13 +110,29 @@ bool eeprom_dump(const struct bp_command_def *def, struct eeprom_info *eeprom, u
 
 /**
  * @brief Write data to EEPROM.
+ * @details Pages are written back to back: while the EEPROM is busy with a
+ *          write cycle the next block is read from the file, and busy polling
+ *          is timed from the write cycles already measured.
  * @param eeprom          EEPROM information structure
  * @param buf             Data buffer
+ * @param prefetch_buf    Second buffer (buf_size) to read the file ahead into, NULL when writing from buffer
  * @param buf_size        Buffer size in bytes
  * @param write_from_buf  true to write from buffer, false from file
  * @return                true on success
  */
-bool eeprom_write(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, bool write_from_buf);
+bool eeprom_write(struct eeprom_info *eeprom, uint8_t *buf, uint8_t *prefetch_buf, uint32_t buf_size, bool write_from_buf);
+
+/**
+ * @brief Reset page write statistics.
+ * @param stats  Write statistics
+ */
+void eeprom_write_stats_init(struct eeprom_write_stats *stats);
+
+/**
+ * @brief Print page write cycle min/avg/max and polls per page.
+ * @param stats  Write statistics
+ */
+void eeprom_write_stats_print(struct eeprom_write_stats *stats);
 
 /**
  * @brief Read data from EEPROM.
@@ -175,6 +204,31 @@ bool eeprom_action_read(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_s
  */
 bool eeprom_action_verify(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, uint8_t *verify_buf, uint32_t verify_buf_size);
 
+/**
+ * @brief Feed a range of EEPROM to a running CRC32/SHA-256.
+ * @param eeprom         EEPROM information structure
+ * @param buf            Working buffer
+ * @param buf_size       Buffer size
+ * @param start_address  First byte to hash
+ * @param bytes          Number of bytes to hash
+ * @param hash           Hash context, initialized with hash_init()
+ * @param quiet          No progress or error messages (for BPIO)
+ * @return               false on success, true on error
+ */
+struct hash_ctx;
+bool eeprom_hash(struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size, uint32_t start_address, uint32_t bytes, struct hash_ctx *hash, bool quiet);
+
+/**
+ * @brief Hash EEPROM contents and print CRC32 and SHA-256.
+ * @details Hashes the whole device, or the range given with -s and -b.
+ * @param def       Command definition (used to get -s/-b)
+ * @param eeprom    EEPROM information structure
+ * @param buf       Working buffer
+ * @param buf_size  Buffer size
+ * @return          false on success, true on error
+ */
+bool eeprom_action_hash(const bp_command_def_t *def, struct eeprom_info *eeprom, uint8_t *buf, uint32_t buf_size);
+
 /**
  * @brief Confirm destructive action with user.
  * @details Checks for -y flag on the command line via the command definition.
@@ -14,10 +14,10 @@
 #include "pirate/file.h" // File handling related
 #include "pirate/hwi2c_pio.h"
 #include "eeprom_base.h"
+#include "eeprom_i2c.h"
 #include "bytecode.h"
 #include "mode/hwi2c.h"
 
-#define I2C_EEPROM_DEFAULT_ADDRESS 0x50 // Default I2C address for EEPROMs
 
 enum eeprom_actions_enum {
     EEPROM_DUMP=0,
@@ -26,7 +26,8 @@ enum eeprom_actions_enum {
     EEPROM_READ,
     EEPROM_VERIFY,
     EEPROM_TEST,
-    EEPROM_LIST
+    EEPROM_LIST,
+    EEPROM_HASH
 };
 
 static const bp_command_action_t eeprom_i2c_action_defs[] = {
@@ -37,6 +38,7 @@ static const bp_command_action_t eeprom_i2c_action_defs[] = {
     { EEPROM_VERIFY, "verify", T_HELP_EEPROM_VERIFY },
     { EEPROM_TEST,   "test",   T_HELP_EEPROM_TEST },
     { EEPROM_LIST,   "list",   T_HELP_EEPROM_LIST },
+    { EEPROM_HASH,   "hash",   T_HELP_EEPROM_HASH },
 };
 
 static const bp_command_opt_t eeprom_i2c_opts[] = {
@@ -53,7 +55,7 @@ static const bp_command_opt_t eeprom_i2c_opts[] = {
 };
 
 static const char* const usage[] = {
-    "eeprom [dump|erase|write|read|verify|test|list]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-a <i2c address>] [-h(elp)]",
+    "eeprom [dump|erase|write|read|verify|test|list|hash]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-a <i2c address>] [-h(elp)]",
     "List available EEPROM devices:%s eeprom list",
     "Display contents (x to exit):%s eeprom dump -d 24x02",
     "Display 16 bytes starting at address 0x60:%s eeprom dump -d 24x02 -s 0x60 -b 16",
@@ -62,6 +64,7 @@ static const char* const usage[] = {
     "Read to file, verify:%s eeprom read -d 24x02 -f example.bin -v",
     "Verify against file:%s eeprom verify -d 24x02 -f example.bin",
     "Test chip (full erase/write/verify):%s eeprom test -d 24x02",
+    "CRC32/SHA-256 of contents:%s eeprom hash -d 24x02",
     "Use alternate I2C address (0x50 default):%s eeprom dump -d 24x02 -a 0x53",
 };
 
@@ -118,17 +121,13 @@ uint32_t i2c_eeprom_determineSize(const bool debug)
 //----------------------------------------------------------------------------------
 // I2C EEPROM hardware abstraction layer functions
 //----------------------------------------------------------------------------------
-//poll for busy status, return false if write is complete, true if timeout
-static bool i2c_eeprom_poll_busy(struct eeprom_info *eeprom){
-    //poll for write complete
-    for(uint32_t i = 0; i<0xfffffu; i++){
-        uint32_t timeout = 0xfffffu; // default timeout for I2C operations
-        hwi2c_status_t i2c_result = pio_i2c_write_array_timeout(eeprom->device_address<<1, NULL, 0, 0xfffffu);
-        if(!i2c_result){
-            return false; // write is complete
-        }
-    }
-    return true; // timeout, write is not complete
+//ACK poll, the EEPROM NACKs its address until the write cycle is complete
+//return true on bus error
+static bool i2c_eeprom_write_busy(struct eeprom_info *eeprom, bool *busy){
+    hwi2c_status_t i2c_result = pio_i2c_write_array_timeout(eeprom->device_address<<1, NULL, 0, 0xfffffu);
+    if(i2c_result == HWI2C_TIMEOUT) return true;
+    (*busy) = (i2c_result == HWI2C_NACK);
+    return false;
 }
 
 static bool i2c_eeprom_read(struct eeprom_info *eeprom, uint32_t address, uint32_t read_bytes, uint8_t *buf) {
@@ -183,16 +182,14 @@ static bool i2c_eeprom_write_page(struct eeprom_info *eeprom, uint32_t address,
 
     if (pio_i2c_stop_timeout(timeout)) return true;
     if (pio_i2c_wait_idle_extern(timeout)) return true;
-
-    //poll for write complete
-    if(i2c_eeprom_poll_busy(eeprom))return true;
-    return false; // write is complete
+    return false; // write cycle started, poll with i2c_eeprom_write_busy()
 }
 
 static struct eeprom_hal_t i2c_eeprom_hal = {
     .get_address = eeprom_get_address,
     .read = i2c_eeprom_read,
     .write_page = i2c_eeprom_write_page,
+    .write_busy = i2c_eeprom_write_busy,
     .is_write_protected = NULL, // I2C EEPROMs do not have write protection
     .probe_protect = NULL // I2C EEPROMs do not have write protection
 };
@@ -214,6 +211,20 @@ static const struct eeprom_device_t eeprom_devices[] = {
     { "24XM02",  262144, 2, 2, 0, 256, 400, &i2c_eeprom_hal }
 };
 
+bool eeprom_i2c_find_device(const char *name, uint8_t i2c_address, struct eeprom_info *eeprom) {
+    char dev_name[9] = {0};
+    strncpy(dev_name, name, sizeof(dev_name) - 1);
+    strupr(dev_name);
+    for(uint8_t i = 0; i < count_of(eeprom_devices); i++) {
+        if(strcmp(dev_name, eeprom_devices[i].name) == 0) {
+            eeprom->device = &eeprom_devices[i];
+            eeprom->device_address = i2c_address;
+            return true;
+        }
+    }
+    return false;
+}
+
 static bool eeprom_get_args(struct eeprom_info *args) {
     // Parse action
     if (!bp_cmd_get_action(&eeprom_i2c_def, &args->action)) {
@@ -236,20 +247,6 @@ static bool eeprom_get_args(struct eeprom_info *args) {
         eeprom_display_devices(eeprom_devices, count_of(eeprom_devices));
         return true;
     }
-    strupr(dev_name);
-    uint8_t eeprom_type = 0xFF;
-    for(uint8_t i = 0; i < count_of(eeprom_devices); i++) {
-        if(strcmp(dev_name, eeprom_devices[i].name) == 0) {
-            eeprom_type = i;
-            break;
-        }
-    }
-    if(eeprom_type == 0xFF) {
-        printf("Invalid EEPROM device name: %s\r\n", dev_name);
-        eeprom_display_devices(eeprom_devices, count_of(eeprom_devices));
-        return true;
-    }
-    args->device = &eeprom_devices[eeprom_type];
 
     // I2C address (optional, default)
     uint32_t i2c_address = I2C_EEPROM_DEFAULT_ADDRESS;
@@ -259,7 +256,12 @@ static bool eeprom_get_args(struct eeprom_info *args) {
             return true;
         }
     }
-    args->device_address = i2c_address;
+
+    if(!eeprom_i2c_find_device(dev_name, i2c_address, args)) {
+        printf("Invalid EEPROM device name: %s\r\n", dev_name);
+        eeprom_display_devices(eeprom_devices, count_of(eeprom_devices));
+        return true;
+    }
 
     // verify_flag
     args->verify_flag = bp_cmd_find_flag(&eeprom_i2c_def, 'v');
@@ -348,6 +350,12 @@ void i2c_eeprom_handler(struct command_result* res) {
             goto i2c_eeprom_cleanup; // error during verify
         }
     }
+
+    if (eeprom.action==EEPROM_HASH) {
+        if(eeprom_action_hash(&eeprom_i2c_def, &eeprom, buf, sizeof(buf))){
+            goto i2c_eeprom_cleanup; // error during hash
+        }
+    }
     printf("Success :)\r\n");
 
 i2c_eeprom_cleanup:
@@ -10,5 +10,17 @@
  */
 void i2c_eeprom_handler(struct command_result* res);
 
+#define I2C_EEPROM_DEFAULT_ADDRESS 0x50 // Default I2C address for EEPROMs
+
+/**
+ * @brief Look up an I2C EEPROM by name.
+ * @param name         Device name (case insensitive), e.g. 24X02
+ * @param i2c_address  7-bit I2C address
+ * @param eeprom       EEPROM information structure to fill in
+ * @return             true if the device was found
+ */
+struct eeprom_info;
+bool eeprom_i2c_find_device(const char *name, uint8_t i2c_address, struct eeprom_info *eeprom);
+
 extern const struct bp_command_def eeprom_i2c_def;
 
@@ -32,7 +32,8 @@ enum eeprom_actions_enum {
     EEPROM_VERIFY,
     EEPROM_TEST,
     EEPROM_LIST,
-    EEPROM_PROTECT
+    EEPROM_PROTECT,
+    EEPROM_HASH
 };
 
 static const bp_command_action_t spi_eeprom_action_defs[] = {
@@ -44,11 +45,12 @@ static const bp_command_action_t spi_eeprom_action_defs[] = {
     { EEPROM_TEST,    "test",    T_HELP_EEPROM_TEST },
     { EEPROM_LIST,    "list",    T_HELP_EEPROM_LIST },
     { EEPROM_PROTECT, "protect", T_HELP_EEPROM_PROTECT },
+    { EEPROM_HASH,    "hash",    T_HELP_EEPROM_HASH },
 };
 
 
 static const char* const usage[] = {
-    "eeprom [dump|erase|write|read|verify|test|list|protect]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-t(test)] [-p <protection blocks>] [-w <WPEN>] [-h(elp)]",
+    "eeprom [dump|erase|write|read|verify|test|list|protect|hash]\r\n\t[-d <device>] [-f <file>] [-v(verify)] [-s <start address>] [-b <bytes>] [-t(test)] [-p <protection blocks>] [-w <WPEN>] [-h(elp)]",
     "List available EEPROM devices:%s eeprom list",
     "Display contents:%s eeprom dump -d 25x020",
     "Display 16 bytes starting at address 0x60:%s eeprom dump -d 25x020 -s 0x60 -b 16",
@@ -57,6 +59,7 @@ static const char* const usage[] = {
     "Read to file, verify:%s eeprom read -d 25x020 -f example.bin -v",
     "Verify against file:%s eeprom verify -d 25x020 -f example.bin",
     "Test chip (full erase/write/verify):%s eeprom test -d 25x020",
+    "CRC32/SHA-256 of contents:%s eeprom hash -d 25x020",
     "Probe Status Register block protection:%s eeprom protect -d 25x020",
     "Test for chip block protection features:%s eeprom protect -d 25x020 -t",
     "Disable all block protection bits (BP1, BP0):%s eeprom protect -d 25x020 -p 0b00",
@@ -105,6 +108,14 @@ static bool eeprom_25x_poll_busy(struct eeprom_info *eeprom){
     return true;
 }
 
+//single status register poll for the page write engine
+static bool eeprom_25x_write_busy(struct eeprom_info *eeprom, bool *busy){
+    uint8_t reg;
+    hwspi_write_read_cs((uint8_t[]){SPI_EEPROM_RDSR_CMD}, 1, &reg, 1); // send the read status command
+    (*busy) = (reg & 0x01); // WIP bit
+    return false;
+}
+
 static bool eeprom_25x_read(struct eeprom_info *eeprom, uint32_t address, uint32_t read_bytes, uint8_t *buf) {
     // get the address for the current byte
     uint8_t block_select_bits = 0;
@@ -151,9 +162,7 @@ static bool eeprom_25x_write_page(struct eeprom_info *eeprom, uint32_t address,
     }
     //hwspi_write_n(buf, eeprom->device->page_bytes); // write the page data, use the specified page write size
     hwspi_deselect(); // deselect the EEPROM chip
-    
-    if(eeprom_25x_poll_busy(eeprom))return true; // poll for write complete, return true if timeout
-    return false; // write is complete
+    return false; // write cycle started, poll with eeprom_25x_write_busy()
 }
 
 static void eeprom_25x_status_reg_print(uint8_t reg) {
@@ -298,6 +307,7 @@ static struct eeprom_hal_t eeprom_25x_hal = {
     .get_address = eeprom_get_address,
     .read = eeprom_25x_read,
     .write_page = eeprom_25x_write_page,
+    .write_busy = eeprom_25x_write_busy,
     .is_write_protected = eeprom_25x_is_write_protect,
     .probe_protect = eeprom_25x_probe_block_protect
 };
@@ -310,24 +320,15 @@ static struct eeprom_hal_t eeprom_25x_hal = {
 #define E93_EWEN_CMD 0b10011
 #define E93_WRITE_CMD 0b101
 
-//poll for busy status, return false if write is complete, true if timeout
-static bool eeprom_93x_poll_busy(struct eeprom_info *eeprom){
-    uint8_t reg;
-
+//single poll: raise CS and check DO, the 93X drives it high when the write is complete
+static bool eeprom_93x_write_busy(struct eeprom_info *eeprom, bool *busy){
     //wait 250ns, then raise CS
     busy_wait_us(1);
-    hwspi_deselect(); // select the EEPROM chip NOTE: 93X are CS active HIGH
+    hwspi_deselect(); // raise CS NOTE: 93X are CS active HIGH
     busy_wait_us(1);
-    //wait for DO to go low->high
-    for(uint32_t i=0; i<0xfffff; i++) {
-        if(bio_get(M_SPI_CDI)) {
-            hwspi_select(); // select the EEPROM chip NOTE: 93X are CS active HIGH
-            return false; // write is complete
-        }
-    }
+    (*busy) = !bio_get(M_SPI_CDI);
     hwspi_select(); // select the EEPROM chip NOTE: 93X are CS active HIGH
-    //printf("Error: EEPROM write timeout\r\n");
-    return true;
+    return false;
 }
 
 //function to return the block select, address given a byte address
@@ -410,11 +411,9 @@ static bool eeprom_93x_write_page(struct eeprom_info *eeprom, uint32_t address,
     hwspi_select(); // select the EEPROM chip NOTE: 93X are CS active HIGH
     hwspi_set_cphase(cphase_current); // restore the clock phase
     
-    if(eeprom_93x_poll_busy(eeprom))return true; // poll for write complete, return true if timeout
-    
     //hwspi_set_frame_format(SPI_FRF_MOTOROLA); // restore the frame format to Motorola for other SPI operations
 
-    return false; // write is complete
+    return false; // write cycle started, poll with eeprom_93x_write_busy()
 }
 
 static bool eeprom_93x_is_write_protect(struct eeprom_info *eeprom) {
@@ -427,6 +426,7 @@ static struct eeprom_hal_t eeprom_93x_hal = {
     .get_address = NULL, //eeprom_get_address,
     .read = eeprom_93x_read,
     .write_page = eeprom_93x_write_page,
+    .write_busy = eeprom_93x_write_busy,
     .is_write_protected = eeprom_93x_is_write_protect,
     .probe_protect = NULL
 };
@@ -632,6 +632,12 @@ void spi_eeprom_handler(struct command_result* res) {
             goto spi_eeprom_cleanup; // error during verify
         }
     }
+
+    if (eeprom.action==EEPROM_HASH) {
+        if(eeprom_action_hash(&eeprom_spi_def, &eeprom, buf, sizeof(buf))){
+            goto spi_eeprom_cleanup; // error during hash
+        }
+    }
     printf("Success :)\r\n");
 
 spi_eeprom_cleanup:
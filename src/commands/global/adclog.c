@@ -0,0 +1,380 @@
+/**
+ * @file adclog.c
+ * @brief Multi-channel ADC data logger command.
+ * @details Scans the selected AMUX channels round robin at a fixed rate and
+ *          reduces each window of scans to min/mean/max per channel on the
+ *          device, so long power profiles fit through USB or onto the flash
+ *          disk without a separate DAQ.
+ *
+ *          Output:
+ *          - CSV to the terminal (default)
+ *          - CSV to a file on the flash disk (-f)
+ *          - Binary frames on the second CDC interface (-b)
+ *
+ *          Binary frame, little endian:
+ *          - 0xAD 0xC0 sync
+ *          - uint16 channel mask: bit 0-7 IO0-IO7, bit 8 VOUT, bit 9 current
+ *          - uint8 flags: ADCLOG_FLAG_x
+ *          - uint32 sequence number
+ *          - uint32 window end time in ms since start
+ *          - per channel in mask order: uint16 min, uint16 max raw ADC,
+ *            uint16 mean raw ADC x16
+ *          - uint8 XOR of all bytes after the sync
+ *
+ *          Raw to units: IO and VOUT mV = raw * 6600 / 4096,
+ *          current uA = raw * 500000 / 4095.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "system_config.h"
+#include "command_struct.h"
+#include "fatfs/ff.h"
+#include "pirate/storage.h"
+#include "pirate/file.h"
+#include "pirate/amux.h"
+#include "lib/bp_args/bp_cmd.h"
+#include "ui/ui_help.h"
+#include "ui/ui_term.h"
+#include "usb_rx.h"
+#include "usb_tx.h"
+
+#define ADCLOG_CH_VOUT 8
+#define ADCLOG_CH_CURRENT 9
+#define ADCLOG_MAX_CHANNELS 10
+
+#define ADCLOG_FLAG_OVERRUN 0x01 // a scan was late in this window
+#define ADCLOG_FLAG_DROPPED 0x02 // frames were dropped before this one, host not reading
+
+static const char* const usage[] = {
+    "adclog [-c <channels>] [-r <Hz>] [-w <scans>] [-f <file> | -b]",
+    "Log all channels to the terminal:%s adclog",
+    "IO0, VOUT and current at 2kHz, 200 scan windows:%s adclog -c 0,v,i -r 2000 -w 200",
+    "Log to a CSV file on the flash disk:%s adclog -c i -f power.csv",
+    "Binary frames on the binary USB port:%s adclog -c 0,1 -b",
+    "Channels: 0-7 IO pins, v VOUT, i current. Any key to stop",
+};
+
+static const bp_val_constraint_t adclog_rate_range = {
+    .type = BP_VAL_UINT32,
+    .u = { .min = 1, .max = 50000, .def = 1000 },
+    .prompt = T_HELP_GCMD_ADCLOG_RATE,
+};
+
+static const bp_val_constraint_t adclog_window_range = {
+    .type = BP_VAL_UINT32,
+    .u = { .min = 1, .max = 65535, .def = 100 },
+    .prompt = T_HELP_GCMD_ADCLOG_WINDOW,
+};
+
+static const bp_command_opt_t adclog_opts[] = {
+    { "channels", 'c', BP_ARG_REQUIRED, "0-7,v,i", T_HELP_GCMD_ADCLOG_CHANNELS },
+    { "rate",     'r', BP_ARG_REQUIRED, "Hz",      T_HELP_GCMD_ADCLOG_RATE, &adclog_rate_range },
+    { "window",   'w', BP_ARG_REQUIRED, "scans",   T_HELP_GCMD_ADCLOG_WINDOW, &adclog_window_range },
+    { "file",     'f', BP_ARG_REQUIRED, "file",    T_HELP_GCMD_ADCLOG_FILE },
+    { "binary",   'b', BP_ARG_NONE,     NULL,      T_HELP_GCMD_ADCLOG_BINARY },
+    { 0 }
+};
+
+const bp_command_def_t adclog_def = {
+    .name         = "adclog",
+    .description  = T_HELP_GCMD_ADCLOG,
+    .actions      = NULL,
+    .action_count = 0,
+    .opts         = adclog_opts,
+    .usage        = usage,
+    .usage_count  = count_of(usage),
+};
+
+static struct {
+    uint8_t count;
+    uint8_t id[ADCLOG_MAX_CHANNELS];   // 0-7 IO, ADCLOG_CH_VOUT, ADCLOG_CH_CURRENT
+    uint8_t amux[ADCLOG_MAX_CHANNELS]; // channel for amux_scan()
+    uint16_t min[ADCLOG_MAX_CHANNELS];
+    uint16_t max[ADCLOG_MAX_CHANNELS];
+    uint32_t sum[ADCLOG_MAX_CHANNELS];
+} ch;
+
+// parse "0,1,v,i" into ch, in mask order so the binary frame needs no channel list
+static bool adclog_parse_channels(const char* s) {
+    uint16_t mask = 0;
+    for (; *s; s++) {
+        if (*s >= '0' && *s <= '7') {
+            mask |= 1u << (*s - '0');
+        } else if (*s == 'v' || *s == 'V') {
+            mask |= 1u << ADCLOG_CH_VOUT;
+        } else if (*s == 'i' || *s == 'I') {
+            mask |= 1u << ADCLOG_CH_CURRENT;
+        } else if (*s != ',' && *s != ' ') {
+            printf("Unknown channel '%c'\r\n", *s);
+            return false;
+        }
+    }
+    if (!mask) {
+        return false;
+    }
+    ch.count = 0;
+    for (uint8_t id = 0; id < ADCLOG_MAX_CHANNELS; id++) {
+        if (!(mask & (1u << id))) {
+            continue;
+        }
+        ch.id[ch.count] = id;
+        if (id == ADCLOG_CH_VOUT) {
+            ch.amux[ch.count] = HW_ADC_MUX_VREF_VOUT;
+        } else if (id == ADCLOG_CH_CURRENT) {
+            ch.amux[ch.count] = HW_ADC_CURRENT_SENSE;
+        } else {
+            ch.amux[ch.count] = bufio2amux(id);
+        }
+        ch.count++;
+    }
+    return true;
+}
+
+static void adclog_window_reset(void) {
+    for (uint8_t i = 0; i < ch.count; i++) {
+        ch.min[i] = 0xffff;
+        ch.max[i] = 0;
+        ch.sum[i] = 0;
+    }
+}
+
+static uint32_t adclog_raw_to_units(uint8_t i, uint32_t raw) {
+    if (ch.id[i] == ADCLOG_CH_CURRENT) {
+        return raw * ((500 * 1000) / 4095); // uA
+    }
+    return (6600 * raw) / 4096; // mV, resistor divider /2
+}
+
+static uint32_t adclog_csv_header(char* buf, uint32_t size) {
+    uint32_t len = snprintf(buf, size, "ms");
+    for (uint8_t i = 0; i < ch.count && len < size; i++) {
+        char name[5];
+        const char* unit = "mV";
+        if (ch.id[i] == ADCLOG_CH_CURRENT) {
+            strcpy(name, "I");
+            unit = "uA";
+        } else if (ch.id[i] == ADCLOG_CH_VOUT) {
+            strcpy(name, "VOUT");
+        } else {
+            snprintf(name, sizeof(name), "IO%d", ch.id[i]);
+        }
+        len += snprintf(&buf[len], size - len, ",%s_min_%s,%s_avg_%s,%s_max_%s", name, unit, name, unit, name, unit);
+    }
+    len += snprintf(&buf[len], size - len, "\r\n");
+    return len;
+}
+
+static uint32_t adclog_csv_record(char* buf, uint32_t size, uint32_t ms, uint32_t scans) {
+    uint32_t len = snprintf(buf, size, "%u", ms);
+    for (uint8_t i = 0; i < ch.count && len < size; i++) {
+        len += snprintf(&buf[len],
+                        size - len,
+                        ",%u,%u,%u",
+                        adclog_raw_to_units(i, ch.min[i]),
+                        adclog_raw_to_units(i, (ch.sum[i] + scans / 2) / scans),
+                        adclog_raw_to_units(i, ch.max[i]));
+    }
+    len += snprintf(&buf[len], size - len, "\r\n");
+    return len;
+}
+
+static uint32_t adclog_frame(uint8_t* buf, uint32_t seq, uint32_t ms, uint32_t scans, uint8_t flags) {
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < ch.count; i++) {
+        mask |= 1u << ch.id[i];
+    }
+    uint32_t len = 0;
+    buf[len++] = 0xAD;
+    buf[len++] = 0xC0;
+    buf[len++] = mask;
+    buf[len++] = mask >> 8;
+    buf[len++] = flags;
+    for (uint8_t b = 0; b < 4; b++) {
+        buf[len++] = seq >> (8 * b);
+    }
+    for (uint8_t b = 0; b < 4; b++) {
+        buf[len++] = ms >> (8 * b);
+    }
+    for (uint8_t i = 0; i < ch.count; i++) {
+        uint16_t mean_x16 = ((ch.sum[i] << 4) + scans / 2) / scans;
+        buf[len++] = ch.min[i];
+        buf[len++] = ch.min[i] >> 8;
+        buf[len++] = ch.max[i];
+        buf[len++] = ch.max[i] >> 8;
+        buf[len++] = mean_x16;
+        buf[len++] = mean_x16 >> 8;
+    }
+    uint8_t check = 0;
+    for (uint32_t i = 2; i < len; i++) {
+        check ^= buf[i];
+    }
+    buf[len++] = check;
+    return len;
+}
+
+void adclog_handler(struct command_result* res) {
+    if (bp_cmd_help_check(&adclog_def, res->help_flag)) {
+        return;
+    }
+
+    char channels[32];
+    if (!bp_cmd_get_string(&adclog_def, 'c', channels, sizeof(channels))) {
+        strcpy(channels, "01234567vi");
+    }
+    if (!adclog_parse_channels(channels)) {
+        bp_cmd_help_show(&adclog_def);
+        res->error = true;
+        return;
+    }
+
+    uint32_t rate, window;
+    if (bp_cmd_flag(&adclog_def, 'r', &rate) == BP_CMD_INVALID ||
+        bp_cmd_flag(&adclog_def, 'w', &window) == BP_CMD_INVALID) {
+        res->error = true;
+        return;
+    }
+    // each channel after the first needs a mux change and settle time
+    uint32_t scan_us = (ch.count > 1) ? (ch.count * (AMUX_SETTLE_US + 5)) : 20;
+    uint32_t period_us = 1000000 / rate;
+    if (period_us < scan_us) {
+        printf("Error: %d channels can be scanned at most %dHz\r\n", ch.count, 1000000 / scan_us);
+        res->error = true;
+        return;
+    }
+
+    bool binary = bp_cmd_find_flag(&adclog_def, 'b');
+    char filename[13];
+    bool to_file = bp_cmd_get_string(&adclog_def, 'f', filename, sizeof(filename));
+    if (binary && to_file) {
+        printf("Error: use -f or -b, not both\r\n");
+        res->error = true;
+        return;
+    }
+    if (binary && system_config.binmode_usb_paused) {
+        printf("Error: the binary USB port is streaming scope frames\r\n");
+        res->error = true;
+        return;
+    }
+
+    FIL file;
+    if (to_file && file_open(&file, filename, FA_WRITE | FA_CREATE_ALWAYS)) {
+        res->error = true;
+        return;
+    }
+
+    bool binmode_tx = system_config.binmode_usb_tx_queue_enable;
+    if (binary) {
+        system_config.binmode_usb_tx_queue_enable = true;
+    }
+
+    printf("%s%d channels, %dHz, %d scan windows. %s%s\r\n",
+           ui_term_color_info(),
+           ch.count,
+           rate,
+           window,
+           GET_T(T_PRESS_ANY_KEY_TO_EXIT),
+           ui_term_color_reset());
+
+    // CSV is collected in a sector sized chunk before each file write
+    static char out[768];
+    uint32_t out_len = 0;
+    if (!binary) {
+        out_len = adclog_csv_header(out, sizeof(out));
+        if (!to_file) {
+            printf("%s", out);
+            out_len = 0;
+        }
+    }
+
+    uint32_t seq = 0, scans = 0, overruns = 0, dropped = 0;
+    uint8_t flags = 0;
+    uint16_t raw[ADCLOG_MAX_CHANNELS];
+    bool error = false;
+    adclog_window_reset();
+
+    uint64_t start = time_us_64();
+    uint64_t next = start;
+    char c;
+    while (!rx_fifo_try_get(&c)) {
+        uint64_t now = time_us_64();
+        if ((int64_t)(now - next) < 0) {
+            continue;
+        }
+        if (now - next >= period_us) {
+            // missed a whole scan (file write, USB), restart the schedule from now
+            overruns++;
+            flags |= ADCLOG_FLAG_OVERRUN;
+            next = now;
+        }
+        next += period_us;
+
+        amux_scan(ch.amux, ch.count, raw);
+        for (uint8_t i = 0; i < ch.count; i++) {
+            if (raw[i] < ch.min[i]) {
+                ch.min[i] = raw[i];
+            }
+            if (raw[i] > ch.max[i]) {
+                ch.max[i] = raw[i];
+            }
+            ch.sum[i] += raw[i];
+        }
+        if (++scans < window) {
+            continue;
+        }
+
+        uint32_t ms = (now - start) / 1000;
+        if (binary) {
+            uint8_t frame[15 + 6 * ADCLOG_MAX_CHANNELS];
+            uint32_t len = adclog_frame(frame, seq, ms, scans, flags);
+            if (bin_tx_fifo_try_write(frame, len)) {
+                flags = 0;
+            } else {
+                dropped++;
+                flags |= ADCLOG_FLAG_DROPPED;
+            }
+        } else if (to_file) {
+            out_len += adclog_csv_record(&out[out_len], sizeof(out) - out_len, ms, scans);
+            if (out_len >= 512) {
+                UINT bw;
+                if (f_write(&file, out, out_len, &bw) != FR_OK || bw != out_len) {
+                    printf("Error: Failed to write file %s\r\n", filename);
+                    error = true;
+                    break;
+                }
+                out_len = 0;
+            }
+        } else {
+            adclog_csv_record(out, sizeof(out), ms, scans);
+            printf("%s", out);
+        }
+        seq++;
+        scans = 0;
+        adclog_window_reset();
+    }
+
+    if (to_file) {
+        UINT bw;
+        if (!error && out_len) {
+            f_write(&file, out, out_len, &bw);
+        }
+        file_close(&file);
+    }
+    if (binary) {
+        // let core1 send the last frames before handing the port back
+        uint64_t timeout = time_us_64() + 100000;
+        while (bin_tx_not_empty() && time_us_64() < timeout) {
+            tight_loop_contents();
+        }
+        system_config.binmode_usb_tx_queue_enable = binmode_tx;
+    }
+
+    printf("%s%d records, %d late scans", ui_term_color_info(), seq, overruns);
+    if (binary) {
+        printf(", %d frames dropped", dropped);
+    }
+    printf("%s\r\n", ui_term_color_reset());
+    res->error = error;
+}
@@ -0,0 +1,13 @@
+/**
+ * @file adclog.h
+ * @brief Multi-channel ADC data logger command interface.
+ * @details Logs min/mean/max per window of selected AMUX channels to the
+ *          terminal, a CSV file or binary frames on the binary USB port.
+ */
+
+/**
+ * @brief Handler for adclog command.
+ * @param res  Command result structure
+ */
+void adclog_handler(struct command_result* res);
+extern const struct bp_command_def adclog_def;
@@ -0,0 +1,79 @@
+/**
+ * @file cmd_perf.c
+ * @brief Hot path timing probe command.
+ * @details Lists the timing probes (pirate/perf.c) placed around the
+ *          bytecode dispatch, the BPIO stages, the USB service and the LCD
+ *          update with their sample count and min/avg/max time, then the
+ *          pixel bytes the LCD update sends to the screen and the glyph
+ *          cache hit rate.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "system_config.h"
+#include "command_struct.h"
+#include "lib/bp_args/bp_cmd.h"
+#include "ui/ui_help.h"
+#include "ui/ui_term.h"
+#include "pirate/perf.h"
+#include "ui/ui_lcd.h"
+
+static const char* const usage[] = {
+    "perf [-r]",
+    "Show hot path timing:%s perf",
+    "Show and reset the probes:%s perf -r",
+};
+
+static const bp_command_opt_t cmd_perf_opts[] = {
+    { "reset", 'r', BP_ARG_NONE, NULL, T_HELP_GCMD_PERF_RESET },
+    { 0 }
+};
+
+const bp_command_def_t cmd_perf_def = {
+    .name         = "perf",
+    .description  = T_HELP_GCMD_PERF,
+    .actions      = NULL,
+    .action_count = 0,
+    .opts         = cmd_perf_opts,
+    .usage        = usage,
+    .usage_count  = count_of(usage),
+};
+
+void cmd_perf_handler(struct command_result* res) {
+    if (bp_cmd_help_check(&cmd_perf_def, res->help_flag)) {
+        return;
+    }
+
+    if (!perf_enabled()) {
+        printf("Timing probes are not compiled in, build with BP_PERF_PROBES\r\n");
+    } else {
+        printf("%sProbe             Count  Min us  Avg us  Max us%s\r\n",
+               ui_term_color_info(),
+               ui_term_color_reset());
+        for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+            struct perf_stats stats;
+            const char* name = perf_get(i, &stats);
+            printf("%-12s  %9lu  %6lu  %6lu  %6lu\r\n", name, stats.count, stats.min_us, stats.avg_us, stats.max_us);
+        }
+    }
+
+    // the LCD counters are always kept, they cost an add per cell
+    printf("\r\n%sLCD update%s\r\n", ui_term_color_info(), ui_term_color_reset());
+    printf("Frames: %lu\r\n", lcd_update_stats.frames);
+    printf("Bytes: %lu last frame, %lu avg\r\n",
+           lcd_update_stats.frame_bytes,
+           lcd_update_stats.frames ? lcd_update_stats.total_bytes / lcd_update_stats.frames : 0);
+    printf("Cells: %lu drawn, %lu skipped\r\n", lcd_update_stats.cells_drawn, lcd_update_stats.cells_skipped);
+    uint32_t glyphs = lcd_update_stats.glyph_hits + lcd_update_stats.glyph_misses;
+    printf("Glyph cache: %lu hits, %lu misses, %lu%% hit rate\r\n",
+           lcd_update_stats.glyph_hits,
+           lcd_update_stats.glyph_misses,
+           glyphs ? (uint32_t)((uint64_t)lcd_update_stats.glyph_hits * 100 / glyphs) : 0);
+
+    if (bp_cmd_find_flag(&cmd_perf_def, 'r')) {
+        perf_reset();
+        lcd_update_stats = (struct lcd_update_stats){ 0 };
+        printf("Probes reset\r\n");
+    }
+}
@@ -0,0 +1,13 @@
+/**
+ * @file cmd_perf.h
+ * @brief Hot path timing probe command interface.
+ * @details Shows the count, minimum, average and maximum time of each
+ *          timing probe in pirate/perf.c.
+ */
+
+/**
+ * @brief Handler for perf command.
+ * @param res  Command result structure
+ */
+void cmd_perf_handler(struct command_result* res);
+extern const struct bp_command_def cmd_perf_def;
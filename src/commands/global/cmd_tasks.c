@@ -0,0 +1,79 @@
+/**
+ * @file cmd_tasks.c
+ * @brief Core0 task statistics command.
+ * @details Lists the tasks in the core0 task table (pirate/tasks.c) with
+ *          their period, budget, run count, CPU share, average and longest
+ *          run, longest wait past their due time and budget overruns.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "system_config.h"
+#include "command_struct.h"
+#include "lib/bp_args/bp_cmd.h"
+#include "ui/ui_help.h"
+#include "ui/ui_term.h"
+#include "pirate/tasks.h"
+
+static const char* const usage[] = {
+    "tasks [-r]",
+    "Show task run time and latency:%s tasks",
+    "Show and reset the statistics:%s tasks -r",
+};
+
+static const bp_command_opt_t cmd_tasks_opts[] = {
+    { "reset", 'r', BP_ARG_NONE, NULL, T_HELP_GCMD_TASKS_RESET },
+    { 0 }
+};
+
+const bp_command_def_t cmd_tasks_def = {
+    .name         = "tasks",
+    .description  = T_HELP_GCMD_TASKS,
+    .actions      = NULL,
+    .action_count = 0,
+    .opts         = cmd_tasks_opts,
+    .usage        = usage,
+    .usage_count  = count_of(usage),
+};
+
+void cmd_tasks_handler(struct command_result* res) {
+    if (bp_cmd_help_check(&cmd_tasks_def, res->help_flag)) {
+        return;
+    }
+
+    uint8_t count;
+    const struct task* tasks = tasks_get(&count);
+    uint64_t elapsed_us = tasks_stats_elapsed_us();
+
+    printf("%sTask      Period  Budget      Runs   CPU%%  Avg us  Max us  Max late us  Overruns%s\r\n",
+           ui_term_color_info(),
+           ui_term_color_reset());
+    for (uint8_t i = 0; i < count; i++) {
+        const struct task* t = &tasks[i];
+        char period[8] = "always";
+        if (t->period_us) {
+            snprintf(period, sizeof(period), "%lums", t->period_us / 1000);
+        }
+        uint32_t avg_us = t->runs ? (uint32_t)(t->total_us / t->runs) : 0;
+        // tenths of a percent
+        uint32_t cpu = elapsed_us ? (uint32_t)((t->total_us * 1000) / elapsed_us) : 0;
+        printf("%-8s  %-6s  %4luus  %8lu  %3lu.%lu  %6lu  %6lu  %11lu  %8lu\r\n",
+               t->name,
+               period,
+               t->budget_us,
+               t->runs,
+               cpu / 10,
+               cpu % 10,
+               avg_us,
+               t->max_us,
+               t->max_latency_us,
+               t->overruns);
+    }
+    printf("Over %llums\r\n", elapsed_us / 1000);
+
+    if (bp_cmd_find_flag(&cmd_tasks_def, 'r')) {
+        tasks_stats_reset();
+        printf("Statistics reset\r\n");
+    }
+}
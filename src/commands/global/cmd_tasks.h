@@ -0,0 +1,13 @@
+/**
+ * @file cmd_tasks.h
+ * @brief Core0 task statistics command interface.
+ * @details Shows run time, CPU share and worst case latency of each task
+ *          in the core0 task table.
+ */
+
+/**
+ * @brief Handler for tasks command.
+ * @param res  Command result structure
+ */
+void cmd_tasks_handler(struct command_result* res);
+extern const struct bp_command_def cmd_tasks_def;
@@ -170,6 +170,7 @@ void process_bitmap(FIL* file_handle, bool draw) {
     uint8_t image_data_sorted[256]; // buffer for sorted image data
     uint32_t remaining_data = image_data_length;
     lcd_set_bounding_box(0, 240, 0, 320);
+    lcd_shadow_invalidate();
     while (remaining_data > 0) {
         // align to pixel boundary
         uint32_t chunk_size = (remaining_data > sizeof(image_data))
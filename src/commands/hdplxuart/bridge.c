@@ -16,6 +16,7 @@
 #include "pirate/bio.h"
 #include "pirate/hwuart_pio.h"
 #include "lib/bp_args/bp_cmd.h"
+#include "pirate/tasks.h"
 
 static const char* const usage[] = { "bridge\t[-h(elp)]",
                                      "Transparent UART bridge:%s bridge",
@@ -74,6 +75,8 @@ void hduart_bridge_handler(struct command_result* res) {
         if (hwuart_pio_read(&raw, &cooked)) {
             char c = (char)cooked;
             tx_fifo_put(&c);
+        } else {
+            tasks_yield(); // nothing waiting from the PIO UART, let the background tasks run
         }
         // exit when button pressed.
         if (button_get(0)) {
@@ -15,13 +15,15 @@
 #include "binmode/fala.h"
 
 static const char* const usage[] = {
-    "scan\t[-v(erbose)] [-h(elp)]",
+    "scan\t[-v(erbose)] [-f(ast)] [-h(elp)]",
     "Scan I2C address space:%s scan",
     "Scan, list possible part numbers:%s scan -v",
+    "Scan, skip reserved addresses:%s scan -f",
 };
 
 static const bp_command_opt_t scan_i2c_opts[] = {
     { "verbose", 'v', BP_ARG_NONE, NULL, T_HELP_I2C_SCAN_VERBOSE },
+    { "fast",    'f', BP_ARG_NONE, NULL, T_HELP_I2C_SCAN_FAST },
     { 0 }
 };
 
@@ -49,6 +51,10 @@ void i2c_search_addr(struct command_result* res) {
     }
 
     bool verbose = bp_cmd_find_flag(&scan_i2c_def, 'v');
+    // 7 bit 0x00-0x07 and 0x78-0x7f are reserved (general call, CBUS, HS mode, 10 bit)
+    uint8_t first = bp_cmd_find_flag(&scan_i2c_def, 'f') ? (0x08 << 1) : 0x00;
+    uint8_t last = bp_cmd_find_flag(&scan_i2c_def, 'f') ? ((0x77 << 1) | 1) : 0xff;
+    uint32_t ack_map[8];
     bool color = false;
     uint16_t device_count = 0;
     uint16_t device_pairs = 0;
@@ -58,9 +64,20 @@ void i2c_search_addr(struct command_result* res) {
     //we manually control any FALA capture
     fala_start_hook();
 
-    for (uint16_t i = 0; i < 256; i = i + 2) {
-        bool i2c_w = i2c_search_check_addr(i);
-        bool i2c_r = i2c_search_check_addr(i + 1);
+    // all addresses in one pass, fall back to one at a time if the bus gets stuck
+    if (pio_i2c_scan_timeout(first, last, ack_map, 0xffff) != HWI2C_OK) {
+        for (uint16_t i = first; i <= last; i++) {
+            if (i2c_search_check_addr(i)) {
+                ack_map[i >> 5] |= 1u << (i & 0x1f);
+            } else {
+                ack_map[i >> 5] &= ~(1u << (i & 0x1f));
+            }
+        }
+    }
+
+    for (uint16_t i = first; i <= last; i = i + 2) {
+        bool i2c_w = ack_map[i >> 5] & (1u << (i & 0x1f));
+        bool i2c_r = ack_map[i >> 5] & (1u << ((i + 1) & 0x1f));
 
         if (i2c_w || i2c_r) {
             device_count += (i2c_w + i2c_r); // add any new devices
@@ -17,6 +17,7 @@
 #include "usb_rx.h"
 #include "usb_tx.h"
 #include "lib/bp_args/bp_cmd.h"    // New command definition system
+#include "pirate/tasks.h"
 
 static const char pin_labels[][5] = {
     "SDA",
@@ -196,6 +197,10 @@ void i2c_sniff(struct command_result* res){
                 }            
             }
 
+            if (!new_val) {
+                tasks_yield(); // bus is quiet, let the background tasks run
+            }
+
             // x to exit
             char c;
             if(rx_fifo_try_get(&c)){
@@ -258,6 +263,10 @@ void i2c_sniff(struct command_result* res){
                 }            
             }
 
+            if (!new_val) {
+                tasks_yield(); // bus is quiet, let the background tasks run
+            }
+
             // x to exit
             char c;
             if(rx_fifo_try_get(&c)){
@@ -19,6 +19,7 @@
 #include "ui/ui_term.h"
 #include "ui/ui_help.h"
 #include "pirate/irio_pio.h"
+#include "pirate/ir_pack.h"
 #include "usb_rx.h"
 
 static const char* const usage_tx[] = {
@@ -26,6 +27,7 @@ static const char* const usage_tx[] = {
 	"aIR format:%s $<modulation freq (kHz)>:<MARK1>,<SPACE1>,...<MARKn>,<SPACEn>,;",
 	"Transmit:%s irtx $38:900,1800,900,65535,;",
 	"Transmit from file:%s irtx -f example.air",
+	"Transmit from compressed file:%s irtx -f example.irz",
 };
 
 static const bp_command_opt_t irtx_opts[] = {
@@ -55,6 +57,7 @@ static const char* const usage_rx[] = {
 	"aIR format:%s $<modulation freq (kHz)>:<MARK1>,<SPACE1>,...<MARKn>,<SPACEn>,;",
 	"Receive (interactive):%s irrx",
 	"Receive, save to file (interactive):%s irrx -f example.air",
+	"Receive, save compressed (interactive):%s irrx -f example.irz",
 	"Receive, specify sensor (interactive):%s irrx -s 56D",
 	"Sensors:%s 38kHz barrier (38B), 36-40kHz/56kHz demodulator (38D*/56D)",
 	"*default",
@@ -161,6 +164,48 @@ bool irtx_transmit(char* buffer){
 	return true;
 }
 
+//replay an .irz file, frames are decoded from a window as the file is read
+static bool irtx_transmit_packed(FIL *file_handle){
+	static uint8_t window[IR_PACK_MAX_FRAME];
+	static uint32_t pairs[IR_PACK_MAX_PAIRS];
+	struct ir_pack_frame frame;
+	uint32_t fill=0, frames=0;
+	UINT bytes_read;
+
+	if(f_read(file_handle, window, IR_PACK_MAGIC_LEN, &bytes_read)!=FR_OK || bytes_read!=IR_PACK_MAGIC_LEN || memcmp(window, IR_PACK_MAGIC, IR_PACK_MAGIC_LEN)){
+		printf("Not an IRZ file\r\n");
+		return false;
+	}
+
+	bool ok=true;
+	while(true){
+		if(f_read(file_handle, &window[fill], sizeof(window)-fill, &bytes_read)!=FR_OK){
+			printf("Error reading file\r\n");
+			ok=false;
+			break;
+		}
+		fill+=bytes_read;
+		if(fill==0) break;
+		uint32_t used=ir_pack_decode(window, fill, &frame, pairs, count_of(pairs));
+		if(!used){
+			printf("Frame %d is damaged\r\n", frames+1);
+			ok=false;
+			break;
+		}
+		//the carrier is 0 if it wasn't measured
+		uint32_t carrier = frame.carrier_hz ? frame.carrier_hz : 38000;
+		printf("Frame %d: modulation frequency %dHz, %d MARK/SPACE pairs\r\n", frames+1, carrier, frame.count);
+		irio_pio_tx_set_tick(frame.tick_us ? (float)frame.tick_us : 1.0f);
+		irio_pio_tx_frame_write((float)carrier, frame.count, pairs);
+		frames++;
+		fill-=used;
+		memmove(window, &window[used], fill);
+	}
+	irio_pio_tx_set_tick(1.0f);
+	printf("Transmitted %d frames\r\n", frames);
+	return ok;
+}
+
 void irtx_handler(struct command_result *res){
     if (bp_cmd_help_check(&irtx_def, res->help_flag)) {
         return;
@@ -188,7 +233,11 @@ void irtx_handler(struct command_result *res){
 		//result = f_read(&file_handle, buffer, sizeof(buffer), &bytes_read);
 		infrared_cleanup_temp(); //tear down current IR PIO programs
 		irio_pio_tx_init(bio2bufiopin[BIO4], 38000); //setup IR PIO programs, actual freq will be set in irtx_packet
-		while(f_gets(buffer, sizeof(buffer), &file_handle)){
+		if(ir_pack_file_name(file)){
+			if(!irtx_transmit_packed(&file_handle)){
+				res->error = true;
+			}
+		}else while(f_gets(buffer, sizeof(buffer), &file_handle)){
 			/*if(bufptr ==0) {
 				printf("Error reading file %s\r\n", file);
 				res->error = true;
@@ -256,12 +305,18 @@ void irrx_handler(struct command_result *res){
 	FIL file_handle;
 	FRESULT result;
 	bool save_file=false;
+	bool save_packed=false;
 	char file[13];
 	if(bp_cmd_get_string(&irrx_def, 'f', file, sizeof(file))){
 		printf("Saving to file %s\r\n", file);
 		save_file=true;
+		save_packed=ir_pack_file_name(file);
 		//open file
 		result = f_open(&file_handle, file, FA_WRITE | FA_CREATE_ALWAYS);
+		if (result == FR_OK && save_packed) {
+			UINT bytes_written;
+			result = f_write(&file_handle, IR_PACK_MAGIC, IR_PACK_MAGIC_LEN, &bytes_written);
+		}
 		if (result != FR_OK) {
 			printf("Error opening file %s for writing\r\n", file);
 			res->error = true;
@@ -307,6 +362,8 @@ void irrx_handler(struct command_result *res){
 	//setup IR PIO programs
 	irio_pio_rx_init(bio2bufiopin[ir_rx_pins[rx_sensor].bio]);
 	irio_pio_tx_init(bio2bufiopin[BIO4], 36000);
+	//DMA capture rings, or read the PIO FIFOs directly if the big buffer is taken
+	bool capture = irio_pio_rx_capture_start();
 
 	while(true){
 		uint32_t buffer[128];
@@ -318,9 +375,12 @@ void irrx_handler(struct command_result *res){
 		printf("\r\nListening for IR packets (x to exit)...\r\n");
 		//drain the FIFO so we can sync and not get garbage
 		irio_pio_rxtx_drain_fifo();
+		irio_pio_rx_capture_drain();
 		//display captured packet
 		while(true){
-			if(irio_pio_rx_frame_buf(&mod_freq, &us, &pairs, buffer)) break;
+			if(capture){
+				if(irio_pio_rx_capture_frame(&mod_freq, &us, &pairs, buffer, count_of(buffer))) break;
+			}else if(irio_pio_rx_frame_buf(&mod_freq, &us, &pairs, buffer)) break;
 			// any key to exit
 			char c;
 		    if (rx_fifo_try_get(&c)) {
@@ -381,7 +441,15 @@ menu_irrx_handler:
 				printf("Saving to file %s\r\n", file);
 				//write the data to the file
 				UINT bytes_written; // somewhere to store the number of bytes written
-				result = f_write(&file_handle, air_buffer, strlen(air_buffer), &bytes_written); // write the data to the file
+				if(save_packed){
+					static uint8_t packed[IR_PACK_MAX_FRAME];
+					struct ir_pack_frame frame = { .carrier_hz = (uint32_t)roundf(mod_freq), .tick_us = 1, .count = pairs };
+					uint32_t packed_len = ir_pack_encode(&frame, buffer, packed);
+					result = f_write(&file_handle, packed, packed_len, &bytes_written);
+					printf("%d bytes, %d as aIR text\r\n", packed_len, strlen(air_buffer));
+				}else{
+					result = f_write(&file_handle, air_buffer, strlen(air_buffer), &bytes_written); // write the data to the file
+				}
 				if (result != FR_OK) {
 					printf("Error writing to file %s\r\n", file);
 					res->error = true; // set the error flag
@@ -401,6 +469,7 @@ menu_irrx_handler:
 			case 'x':
 exit_irrx_handler:
 				//resume IR PIO programs
+				irio_pio_rx_capture_stop();
 				irio_pio_rx_deinit(bio2bufiopin[ir_rx_pins[rx_sensor].bio]);
 				irio_pio_tx_deinit(bio2bufiopin[BIO4]);
 				infrared_setup_resume();
@@ -39,80 +39,12 @@ Ported to RP2040 by Ian Lesnet 2024 (see you in another 15 years?)
 #include "command_struct.h"
 #include "mode/infrared-struct.h"
 #include "mode/infrared.h"
-#include "hardware/pwm.h"
-#include "hardware/gpio.h"
-#include "hardware/clocks.h"
 #include "pirate/bio.h"
+#include "pirate/irio_pio.h"
+#include "pirate/ir_pack.h"
 #include "ui/ui_help.h"
 #include "lib/bp_args/bp_cmd.h"
 
-
-const unsigned char num_NAcodes = NUM_NA_CODES; //NUM_ELEM(NApowerCodes);
-
-//These are all the variables we need to 
-// slurp down the TVBGONE POWER codes and get 
-// the actuall delay values.
-static struct _tvbgoneparser{
-	unsigned char codecnt;
-	unsigned char paircnt;
-	unsigned char samplebitcnt;
-	unsigned char samplebytecnt;
-	unsigned char bittracker;
-	unsigned char timetableindex;	
-	unsigned int onTime;
-	unsigned int offTime;
-	unsigned char numpairs;
-}tvbg;
-
-volatile void delayint10US(unsigned int delay);
-
-
-// return 0 success, 1 too low, 2 too high
-static uint8_t pwm_freq_find(
-    float* freq_hz_value, float* pwm_hz_actual, float* pwm_ns_actual, uint32_t* pwm_divider, uint32_t* pwm_top) {
-// calculate PWM values
-// reverse calculate actual frequency/period
-// from: https://forums.raspberrypi.com/viewtopic.php?t=317593#p1901340
-#define TOP_MAX 65534
-#define DIV_MIN ((0x01 << 4) + 0x0) // 0x01.0
-#define DIV_MAX ((0xFF << 4) + 0xF) // 0xFF.F
-    uint32_t clock = clock_get_hz(clk_sys);
-    // Calculate a div value for frequency desired
-    uint32_t div = (clock << 4) / *freq_hz_value / (TOP_MAX + 1);
-    if (div < DIV_MIN) {
-        div = DIV_MIN;
-    }
-    // Determine what period that gives us
-    uint32_t period = (clock << 4) / div / *freq_hz_value;
-    // We may have had a rounding error when calculating div so it may
-    // be lower than it should be, which in turn causes the period to
-    // be higher than it should be, higher than can be used. In which
-    // case we increase the div until the period becomes usable.
-    while ((period > (TOP_MAX + 1)) && (div <= DIV_MAX)) {
-        period = (clock << 4) / ++div / *freq_hz_value;
-    }
-    // Check if the result is usable
-    if (period <= 1) {
-        return 2; // too high
-    } else if (div > DIV_MAX) {
-        return 1; // too low
-    } else {
-        // Determine the top value we will be setting
-        uint32_t top = period - 1;
-        // Determine what output frequency that will generate
-        *pwm_hz_actual = (float)(clock << 4) / div / (top + 1);
-        *pwm_ns_actual = ((float)1 / (float)(*pwm_hz_actual)) * (float)1000000000;
-        *pwm_divider = div;
-        *pwm_top = top;
-        // Report the results
-        // printf("Freq = %f\t",         freq);
-        // printf("Top = %ld\t",         top);
-        // printf("Div = 0x%02lX.%lX\t", div >> 4, div & 0xF);
-    }
-
-    return 0;
-}
-
 static const char* const usage[] = {
     "tvbgone",
 	"Turn off TVs:%s tvbgone",
@@ -134,127 +66,48 @@ void tvbgone_player(struct command_result *res){
         return;
     }
 
-	//clean up the PIO stuff:
-	infrared_cleanup_temp();
-
-	uint slice_num = pwm_gpio_to_slice_num(bio2bufiopin[BIO4]); 
-	uint chan_num = pwm_gpio_to_channel(bio2bufiopin[BIO4]);
-	pwm_set_enabled(slice_num, false);
-	gpio_set_function(bio2bufiopin[BIO4], GPIO_FUNC_PWM);
+	static uint32_t pairs[IR_PACK_MAX_PAIRS];
+	struct ir_pack_frame frame;
+	uint32_t offset=0;
 
-	printf("TVBGONE player\r\nPlaying %d TV off codes:\r\n", num_NAcodes);
+	//clean up the PIO stuff, the codes play through the IR TX PIO program
+	infrared_cleanup_temp();
+	irio_pio_tx_init(bio2bufiopin[BIO4], 38000);
 
-	for(tvbg.codecnt=0; tvbg.codecnt<num_NAcodes; tvbg.codecnt++){
-		//setup indicator LED
+	printf("TVBGONE player\r\nPlaying %d TV off codes:\r\n", NUM_NA_CODES);
 
+	for(uint32_t code=0; code<NUM_NA_CODES; code++){
 		//show some kind of progress indicator
-		printf("\r%d", tvbg.codecnt);
+		printf("\r%d", code);
 
-		//get and set PWM frequency
-		if(NApowerCodes[tvbg.codecnt]->timer_val>0){ //setup PWM with this value
-			//calculate PWM value from raw frequency
-			float pwm_hz_reqest_temp=(float)NApowerCodes[tvbg.codecnt]->timer_val;
-			float pwm_hz_actual_temp;
-			float pwm_ns_actual;
-			uint32_t pwm_divider;
-			uint32_t pwm_top;
-			if (pwm_freq_find(
-				&pwm_hz_reqest_temp,
-				&pwm_hz_actual_temp,
-				&pwm_ns_actual,
-				&pwm_divider,
-				&pwm_top)) {
-				printf("Error: PWM frequency too high or too low\r\n");
-				continue;
-			}
-			//set PWM
-			pwm_set_clkdiv_int_frac(slice_num, pwm_divider >> 4, pwm_divider & 0b1111);
-			pwm_set_wrap(slice_num, pwm_top);
-			pwm_set_chan_level(slice_num, chan_num, pwm_top>>1); //50%
-			// enable output
-			gpio_set_function(bio2bufiopin[BIO4], GPIO_FUNC_PWM);
-			pwm_set_enabled(slice_num, true);
-		}else{//some don't use PWM, setup for direct on/off
-			//these don't exist in our dataset...
-			continue;
+		//codes are packed back to back, see tools/tvbgone_pack.py
+		uint32_t used=ir_pack_decode(&tvbgone_na_codes[offset], sizeof(tvbgone_na_codes)-offset, &frame, pairs, count_of(pairs));
+		if(!used){
+			printf("\r\nError: code %d is damaged\r\n", code);
+			break;
+		}
+		offset+=used;
+
+		//the TX program adds a tick to each MARK and SPACE
+		for(uint32_t i=0; i<frame.count; i++){
+			uint16_t mark=pairs[i]>>16;
+			uint16_t space=pairs[i]&0xffff;
+			if(mark>1) mark--;
+			if(space>1) space--;
+			pairs[i]=(mark<<16)|space;
 		}
 
-		//setup the bit tracker and sample counter offset
-		tvbg.bittracker=0b10000000;	
-		tvbg.samplebytecnt=0;
-
-		//there are numpairs pairs of bitcompression length in *samples that refer to value pairs in *times
-		for(tvbg.paircnt=0; tvbg.paircnt<NApowerCodes[tvbg.codecnt]->numpairs; tvbg.paircnt++){
-			
-			//get the next index to the the times table values
-			tvbg.timetableindex=0;	
-			for(tvbg.samplebitcnt=0; tvbg.samplebitcnt<NApowerCodes[tvbg.codecnt]->bitcompression; tvbg.samplebitcnt++){
-				tvbg.timetableindex=(tvbg.timetableindex<<1);
-				if((NApowerCodes[tvbg.codecnt]->samples[tvbg.samplebytecnt] & tvbg.bittracker)!=0) 
-					tvbg.timetableindex|=0b1; //set first bit
-				tvbg.bittracker=(tvbg.bittracker>>1);
-				if(tvbg.bittracker==0){
-					tvbg.bittracker=0b10000000;
-					tvbg.samplebytecnt++;
-				}				
-			}
-		
-			//adjust the index, there are two variables for each entry
-			tvbg.timetableindex*=2; //multiply by two, the compiler knows each is an int (2 bytes)
-
-			//PWM for ON time
-			//IRTX_TRIS&=(~IRTX_PIN);//IR LED output
-			//make GPIO output
-			//gpio_set_dir(bio2bufiopin[BIO4], GPIO_OUT);
-			pwm_set_enabled(slice_num, true);
-			delayint10US(NApowerCodes[tvbg.codecnt]->times[tvbg.timetableindex]);//on time is first table entry
-
-			//pause PWM for OFF time
-			//IRTX_TRIS|=IRTX_PIN;//IR LED input (no PWM)
-			//make GPIO input
-			//gpio_set_dir(bio2bufiopin[BIO4], GPIO_IN);
-			pwm_set_enabled(slice_num, false);
-			delayint10US(NApowerCodes[tvbg.codecnt]->times[(tvbg.timetableindex+1)]);//off time is next entry
-
-		}//for pairs loop
-		
-		//LEDon();//blink LED
-		delayint10US(25000);//delay 250ms between codes
-		//LEDoff();
+		irio_pio_tx_set_tick((float)frame.tick_us);
+		irio_pio_tx_frame_write((float)frame.carrier_hz, frame.count, pairs);
 
+		busy_wait_ms(250);//delay 250ms between codes
 	}//for codes loop
 
 	printf("\r\nDone!\r\n");
-    
-	pwm_set_enabled(slice_num, false);
-	//gpio_set_function(bio2bufiopin[BIO4], GPIO_FUNC_SIO);
-    //gpio_set_dir(bio2bufiopin[BIO4], GPIO_IN);
+
+	irio_pio_tx_set_tick(1.0f);
+	irio_pio_tx_deinit(bio2bufiopin[BIO4]);
 
 	//resume normal IR mode
 	infrared_setup_resume();
-
-
-}
-
-//
-//
-//	Simple blocking delay using Timer1
-//	Polls interrupt to see when 10us have passed, repeats.
-//	Hand tune T1_10usOffset in HardwareProfile.h
-//
-//
-//volatile void delayint10US(unsigned int delay);
-volatile void delayint10US(unsigned int delay){
-	busy_wait_us(delay*10);
 }
-
-//the hardest part of this project is keeping the pointers straight
-//this is a test that shows how to get the actual values from each element
-//volatile static unsigned char timer, pairs, bits, sample;
-//volatile static unsigned int times;
-//timer=NApowerCodes[i]->timer_val;
-//pairs=NApowerCodes[i]->numpairs;
-//bits=NApowerCodes[i]->bitcompression;
-//sample=NApowerCodes[i]->samples[0];
-//times=NApowerCodes[i]->times[0];
-
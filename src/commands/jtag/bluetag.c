@@ -24,15 +24,17 @@
 #include "lib/bluetag/src/blueTag.h"
 #include "usb_rx.h"
 #include "mode/jtag.h"
+#include "commands/jtag/bluetag_pio.h"
 #include "ui/ui_prompt.h"
 
 // This array of strings is used to display help USAGE examples for the dummy command
-static const char* const usage[] = { "bluetag [jtag|swd] [-c <channels>] [-v(ersion)] [-d(isable pulsing)]",
+static const char* const usage[] = { "bluetag [jtag|swd] [-c <channels>] [-v(ersion)] [-d(isable pulsing)] [-l(egacy scan)]",
                                      "blueTag interactive interface:%s bluetag",
                                      "JTAG scan, 6 channels:%s bluetag jtag -c 6",
                                      "SWD scan, 4 channels:%s bluetag swd -c 4",
                                      "Show version:%s bluetag -v",
                                      "Disable JTAG pin pulsing:%s bluetag jtag -c 6 -d",
+                                     "blueTag permutation scan, 6 channels:%s bluetag jtag -c 6 -l",
                                      "",
                                      "blueTag by @Aodrulez https://github.com/Aodrulez/blueTag" };
 
@@ -50,6 +52,7 @@ static const bp_command_opt_t bluetag_opts[] = {
     { "channels", 'c', BP_ARG_REQUIRED, "count", T_JTAG_BLUETAG_CHANNELS },
     { "version",  'v', BP_ARG_NONE,     NULL,      T_JTAG_BLUETAG_VERSION },
     { "disable",  'd', BP_ARG_NONE,     NULL,      T_JTAG_BLUETAG_DISABLE },
+    { "legacy",   'l', BP_ARG_NONE,     NULL,      T_JTAG_BLUETAG_LEGACY },
     { 0 }
 };
 
@@ -65,6 +68,13 @@ const bp_command_def_t bluetag_def = {
 
 static void bluetag_cli(void);
 
+static void bluetag_print_speed(uint32_t permutations, uint32_t start) {
+    uint32_t us = time_us_32() - start;
+    uint32_t per_second = us ? (uint32_t)(((uint64_t)permutations * 1000000u) / us) : 0;
+    printf("\tScanned %d permutations in %d.%03ds (%d permutations/s)\r\n",
+           permutations, us / 1000000u, (us / 1000u) % 1000u, per_second);
+}
+
 void bluetag_handler(struct command_result* res) {
     if (bp_cmd_help_check(&bluetag_def, res->help_flag)) {
         return;
@@ -96,6 +106,10 @@ void bluetag_handler(struct command_result* res) {
             printf("Number of channels set to: %d\r\n", channels);
         }
 
+        bool legacy = bp_cmd_find_flag(&bluetag_def, 'l');
+        struct bluetag_pio_stats stats;
+        uint32_t start;
+
         // lets do jtag!
         if(action == BLUETAG_JTAG){
             if(channels < 4 || channels > 8){
@@ -104,14 +118,27 @@ void bluetag_handler(struct command_result* res) {
             }
 
             jtag_cleanup();
+            if(!legacy){
+                start = time_us_32();
+                if(!bluetag_pio_jtag_scan(channels, !disable_pulse, &stats)){
+                    printf("\r\n\tNo JTAG devices found. Please try again.\r\n");
+                }
+                printf("\t%d of %d TCK/TMS passes pruned after 12 IDCODE bits\r\n", stats.pruned, stats.passes);
+                bluetag_print_speed(stats.permutations, start);
+                return;
+            }
             struct jtagScan_t jtag;
             jtag.channelCount = channels;
             jtag.jPulsePins = !disable_pulse;
-            if(!jtagScan(&jtag)){
+            start = time_us_32();
+            bool found = jtagScan(&jtag);
+            if(!found){
                 bluetag_progressbar_cleanup(jtag.maxPermutations);
                 printf("\r\n\r\n");
                 printf("\tNo JTAG devices found. Please try again.\r\n");
-            }else{
+            }
+            bluetag_print_speed(jtag.progressCount, start);
+            if(found){
                 //char jtag_pin_labels[][5] = { "TRST", "TCK", "TDI", "TDO", "TMS" }; 
                 /*system_bio_update_purpose_and_label(true, (jtag.xTCK-8), BP_PIN_MODE, jtag_pin_labels[1]);
                 system_bio_update_purpose_and_label(true, (jtag.xTDI-8), BP_PIN_MODE, jtag_pin_labels[2]);
@@ -129,13 +156,25 @@ void bluetag_handler(struct command_result* res) {
                 return;
             }
             jtag_cleanup();
+            if(!legacy){
+                start = time_us_32();
+                if(!bluetag_pio_swd_scan(channels, &stats)){
+                    printf("\r\n\tNo SWD devices found. Please try again.\r\n");
+                }
+                bluetag_print_speed(stats.permutations, start);
+                return;
+            }
             struct swdScan_t swd;
             swd.channelCount = channels;         
-            if(!swdScan(&swd)){
+            start = time_us_32();
+            bool found = swdScan(&swd);
+            if(!found){
                 bluetag_progressbar_cleanup(swd.maxPermutations);
                 printf("\r\n\r\n");
                 printf("\tNo SWD devices found. Please try again.\r\n");
-            }else{
+            }
+            bluetag_print_speed(swd.progressCount, start);
+            if(found){
                 /*char swd_pin_labels[][5] = { "SCLK", "SDIO" };
                 system_bio_update_purpose_and_label(true, (swd.xSwdClk-8), BP_PIN_MODE, swd_pin_labels[0]);
                 system_bio_update_purpose_and_label(true, (swd.xSwdIO-8), BP_PIN_MODE, swd_pin_labels[1]);*/
@@ -0,0 +1,374 @@
+/**
+ * @file bluetag_pio.c
+ * @brief Parallel JTAG/SWD pinout discovery using the pin scan PIO engine.
+ * @details blueTag tries every TDI/TDO/TCK/TMS permutation one at a time.
+ *          Here each pass drives one TCK/TMS (or SWCLK) candidate and
+ *          samples every other pin on every clock, so all TDO (or SWDIO)
+ *          candidates are tested together:
+ *
+ *          JTAG: Test-Logic-Reset loads IDCODE (or BYPASS) into DR, so
+ *          Shift-DR shows an IDCODE on TDO without knowing TDI. The first
+ *          12 bits (marker and JEDEC manufacturer) prune the candidates,
+ *          the remaining 20 are only clocked if a pin survives. TDI is
+ *          found in one more pass: every remaining pin drives its own
+ *          pseudo random pattern into DR and the pattern that comes out
+ *          of TDO after the chain names the pin.
+ *
+ *          SWD: the wake up, JTAG to SWD and DPIDR read sequences go out
+ *          on every pin but the clock candidate, then ACK, DPIDR and parity
+ *          are sampled on all of them.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "pirate/pinscan_pio.h"
+#include "lib/jep106/jep106.h"
+#include "commands/jtag/bluetag_pio.h"
+
+#define BTAG_PIO_STEP_HZ 2000000 // 1MHz TCK
+#define BTAG_PIO_MAX_STEPS 1024
+#define BTAG_PIO_MAX_CHAIN 256 // TDO bits before TDI comes through, 8 devices with IDCODE
+#define BTAG_PIO_TDI_MATCH 64  // pattern bits that must match
+#define BTAG_PIO_MAX_DEVICES 8
+
+static uint8_t step_out[BTAG_PIO_MAX_STEPS];
+static uint8_t step_in[BTAG_PIO_MAX_STEPS];
+static uint32_t step_count;
+static uint8_t clock_mask;
+
+static void wave_start(uint8_t clock_pin) {
+    step_count = 0;
+    clock_mask = 1u << clock_pin;
+}
+
+// one clock: data with the clock low, then the clock high
+static void wave_clock(uint8_t data) {
+    step_out[step_count++] = data;
+    step_out[step_count++] = data | clock_mask;
+}
+
+static void wave_bits(uint32_t value, uint32_t bits, uint8_t mask) {
+    for (uint32_t i = 0; i < bits; i++) {
+        wave_clock((value >> i) & 1 ? mask : 0);
+    }
+}
+
+static void wave_run(void) {
+    pinscan_pio_run(step_out, step_in, step_count);
+}
+
+// pin level while the clock was high, like a TCK/SWCLK rising edge read
+static inline bool wave_sample(uint32_t clock, uint8_t pin) {
+    return (step_in[clock * 2 + 1] >> pin) & 1;
+}
+
+static void pulse_pins(uint8_t all) {
+    static const uint8_t low = 0x00, high = 0xff;
+    uint8_t discard;
+    pinscan_pio_outputs(all);
+    pinscan_pio_run(&low, &discard, 1);
+    sleep_ms(2);
+    pinscan_pio_run(&high, &discard, 1);
+    sleep_ms(2);
+}
+
+static bool idcode_marker_valid(uint32_t idcode) {
+    uint32_t id = (idcode >> 1) & 0x7f;
+    uint32_t bank = (idcode >> 8) & 0x0f;
+    return (idcode & 1) && id > 1 && id <= 126 && bank <= 8;
+}
+
+static void print_device(uint32_t n, uint32_t idcode) {
+    printf("     [ Device %d ]  0x%08X ", n, idcode);
+    if (idcode_marker_valid(idcode)) {
+        printf("(mfg: '%s', part: 0x%x, ver: 0x%x)",
+               jep106_table_manufacturer((idcode >> 8) & 0x0f, (idcode >> 1) & 0x7f),
+               (idcode >> 12) & 0xffff,
+               idcode >> 28);
+    }
+    printf("\r\n");
+}
+
+//-------------------------------------JTAG-------------------------------------
+
+// Test-Logic-Reset, Run-Test/Idle, Select-DR, Capture-DR, Shift-DR
+static void wave_jtag_shift_dr(uint8_t tms_mask, uint8_t other) {
+    for (uint8_t i = 0; i < 6; i++) {
+        wave_clock(tms_mask | other);
+    }
+    wave_clock(other);
+    wave_clock(tms_mask | other);
+    wave_clock(other);
+    wave_clock(other);
+}
+
+// 8 bit pseudo random pattern for each clock, one bit per TDI candidate
+static uint8_t tdi_pattern(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (uint8_t)x;
+}
+
+// Find TDI and the chain length with TCK, TMS and TDO known, -1 if no pin matched
+static int jtag_find_tdi(uint8_t tck, uint8_t tms, uint8_t tdo, uint8_t all, uint32_t* chain) {
+    uint8_t tdi_mask = all & ~((1u << tck) | (1u << tms) | (1u << tdo));
+    uint8_t tms_mask = 1u << tms;
+    uint32_t clocks = BTAG_PIO_MAX_CHAIN + BTAG_PIO_TDI_MATCH;
+    uint8_t pattern[BTAG_PIO_MAX_CHAIN + BTAG_PIO_TDI_MATCH];
+    uint32_t seed = 0x2545f491;
+
+    pinscan_pio_outputs((1u << tck) | tms_mask | tdi_mask);
+    wave_start(tck);
+    wave_jtag_shift_dr(tms_mask, tdi_mask);
+    uint32_t first = step_count / 2;
+    for (uint32_t i = 0; i < clocks; i++) {
+        pattern[i] = tdi_pattern(&seed) & tdi_mask;
+        wave_clock(pattern[i]);
+    }
+    wave_run();
+
+    // TDO bit L + j is TDI bit j for a chain of L bits
+    for (uint32_t length = 1; length <= BTAG_PIO_MAX_CHAIN; length++) {
+        for (uint8_t pin = 0; pin < 8; pin++) {
+            if (!(tdi_mask & (1u << pin))) {
+                continue;
+            }
+            uint32_t j;
+            for (j = 0; j < BTAG_PIO_TDI_MATCH; j++) {
+                if (wave_sample(first + length + j, tdo) != ((pattern[j] >> pin) & 1)) {
+                    break;
+                }
+            }
+            if (j == BTAG_PIO_TDI_MATCH) {
+                *chain = length;
+                return pin;
+            }
+        }
+    }
+    return -1;
+}
+
+// IDCODEs (or 1 bit BYPASS) in the first chain bits of the TDI pass
+static uint32_t jtag_chain_devices(uint8_t tdo, uint32_t chain, uint32_t* idcodes) {
+    uint32_t first = 10; // clocks of wave_jtag_shift_dr()
+    uint32_t devices = 0;
+    uint32_t i = 0;
+    while (i < chain && devices < BTAG_PIO_MAX_DEVICES) {
+        if (!wave_sample(first + i, tdo)) {
+            idcodes[devices++] = 0; // BYPASS
+            i++;
+            continue;
+        }
+        uint32_t idcode = 0;
+        for (uint32_t b = 0; b < 32 && i + b < chain; b++) {
+            idcode |= (uint32_t)wave_sample(first + i + b, tdo) << b;
+        }
+        idcodes[devices++] = idcode;
+        i += 32;
+    }
+    return devices;
+}
+
+bool bluetag_pio_jtag_scan(uint32_t channels, bool pulse, struct bluetag_pio_stats* stats) {
+    uint8_t all = (1u << channels) - 1;
+    memset(stats, 0, sizeof(*stats));
+    pinscan_pio_start(channels, BTAG_PIO_STEP_HZ);
+
+    for (uint8_t tck = 0; tck < channels; tck++) {
+        for (uint8_t tms = 0; tms < channels; tms++) {
+            if (tms == tck) {
+                continue;
+            }
+            uint8_t tms_mask = 1u << tms;
+            uint8_t candidates = all & ~((1u << tck) | tms_mask);
+            stats->passes++;
+            stats->permutations += (channels - 2) * (channels - 3);
+
+            if (pulse) {
+                pulse_pins(all);
+            }
+            pinscan_pio_outputs((1u << tck) | tms_mask);
+
+            // marker bit and manufacturer, 12 bits
+            wave_start(tck);
+            wave_jtag_shift_dr(tms_mask, 0);
+            uint32_t first = step_count / 2;
+            for (uint8_t i = 0; i < 12; i++) {
+                wave_clock(0);
+            }
+            wave_run();
+
+            uint32_t idcode[8] = { 0 };
+            for (uint8_t pin = 0; pin < channels; pin++) {
+                if (!(candidates & (1u << pin))) {
+                    continue;
+                }
+                for (uint8_t b = 0; b < 12; b++) {
+                    idcode[pin] |= (uint32_t)wave_sample(first + b, pin) << b;
+                }
+                if (!idcode_marker_valid(idcode[pin])) {
+                    candidates &= ~(1u << pin);
+                }
+            }
+            if (!candidates) {
+                stats->pruned++;
+                continue;
+            }
+
+            // part and version, 20 more bits
+            wave_start(tck);
+            for (uint8_t i = 0; i < 20; i++) {
+                wave_clock(0);
+            }
+            wave_run();
+
+            for (uint8_t tdo = 0; tdo < channels; tdo++) {
+                if (!(candidates & (1u << tdo))) {
+                    continue;
+                }
+                for (uint8_t b = 0; b < 20; b++) {
+                    idcode[tdo] |= (uint32_t)wave_sample(b, tdo) << (b + 12);
+                }
+
+                uint32_t chain = 0;
+                int tdi = jtag_find_tdi(tck, tms, tdo, all, &chain);
+
+                printf("\r\n\r\n");
+                if (tdi >= 0) {
+                    printf("     [  Pinout  ]  TDI=IO%d", tdi);
+                } else {
+                    printf("     [  Pinout  ]  TDI=N/A");
+                }
+                printf(" TDO=IO%d TCK=IO%d TMS=IO%d TRST=N/A\r\n\r\n", tdo, tck, tms);
+
+                if (tdi >= 0) {
+                    uint32_t idcodes[BTAG_PIO_MAX_DEVICES];
+                    uint32_t devices = jtag_chain_devices(tdo, chain, idcodes);
+                    for (uint32_t d = 0; d < devices; d++) {
+                        print_device(d, idcodes[d]);
+                    }
+                } else {
+                    print_device(0, idcode[tdo]);
+                }
+                printf("\r\n");
+
+                pinscan_pio_stop();
+                return true;
+            }
+        }
+    }
+
+    pinscan_pio_stop();
+    return false;
+}
+
+//-------------------------------------SWD--------------------------------------
+
+#define SWD_LINE_RESET_CLOCKS 62
+#define SWD_JTAG_TO_SWD 0xE79E
+#define SWD_SWD_TO_JTAG 0xE73C
+#define SWD_ACTIVATION_CODE 0x1A
+#define SWD_READ_DPIDR 0xA5
+
+// dormant wake up, JTAG to SWD and a DPIDR read request on the io pins
+static void wave_swd_read_dpidr(uint8_t io) {
+    // selection alert sequence 0x19BC0EA2 E3DDAFE9 86852D95 6209F392
+    static const uint32_t alert[] = { 0x6209F392, 0x86852D95, 0xE3DDAFE9, 0x19BC0EA2 };
+
+    wave_bits(0xff, 8, io);
+    for (uint8_t i = 0; i < count_of(alert); i++) {
+        wave_bits(alert[i], 32, io);
+    }
+    wave_bits(0x00, 4, io);
+    wave_bits(SWD_ACTIVATION_CODE, 8, io);
+
+    wave_bits(0xffffffff, 32, io);
+    wave_bits(0xffffffff, SWD_LINE_RESET_CLOCKS - 32, io);
+    wave_bits(SWD_JTAG_TO_SWD, 16, io);
+    wave_bits(0xffffffff, 32, io);
+    wave_bits(0xffffffff, SWD_LINE_RESET_CLOCKS - 32, io);
+    wave_bits(0x00, 4, io);
+    wave_bits(SWD_READ_DPIDR, 8, io);
+}
+
+static void swd_to_jtag(uint8_t swclk, uint8_t swdio) {
+    uint8_t io = 1u << swdio;
+    pinscan_pio_outputs((1u << swclk) | io);
+    wave_start(swclk);
+    wave_bits(0xffffffff, 32, io);
+    wave_bits(0xffffffff, SWD_LINE_RESET_CLOCKS - 32, io);
+    wave_bits(SWD_SWD_TO_JTAG, 16, io);
+    wave_run();
+}
+
+bool bluetag_pio_swd_scan(uint32_t channels, struct bluetag_pio_stats* stats) {
+    uint8_t all = (1u << channels) - 1;
+    memset(stats, 0, sizeof(*stats));
+    pinscan_pio_start(channels, BTAG_PIO_STEP_HZ);
+
+    for (uint8_t swclk = 0; swclk < channels; swclk++) {
+        uint8_t io = all & ~(1u << swclk);
+        stats->passes++;
+        stats->permutations += channels - 1;
+
+        pinscan_pio_outputs(all);
+        wave_start(swclk);
+        wave_swd_read_dpidr(io);
+        wave_run();
+
+        // turnaround, ACK, DPIDR, parity and the turnaround back
+        pinscan_pio_outputs(1u << swclk);
+        wave_start(swclk);
+        wave_bits(0, 37, 0);
+        wave_run();
+
+        int found = -1;
+        uint32_t dpidr = 0;
+        for (uint8_t pin = 0; pin < channels; pin++) {
+            if (!(io & (1u << pin))) {
+                continue;
+            }
+            // ACK OK is 1, 0, 0
+            if (!wave_sample(0, pin) || wave_sample(1, pin) || wave_sample(2, pin)) {
+                continue;
+            }
+            uint32_t value = 0;
+            for (uint8_t b = 0; b < 32; b++) {
+                value |= (uint32_t)wave_sample(3 + b, pin) << b;
+            }
+            if ((uint32_t)__builtin_parity(value) != wave_sample(35, pin)) {
+                continue;
+            }
+            found = pin;
+            dpidr = value;
+            break;
+        }
+
+        // idle clocks with the io pins driving again
+        pinscan_pio_outputs(all);
+        wave_start(swclk);
+        wave_bits(0, 8, io);
+        wave_run();
+
+        if (found < 0) {
+            stats->pruned++;
+            continue;
+        }
+
+        printf("\r\n\r\n");
+        printf("     [  Pinout  ]  SWDIO=IO%d SWCLK=IO%d\r\n\r\n", found, swclk);
+        print_device(0, dpidr);
+        printf("\r\n");
+        swd_to_jtag(swclk, found);
+        pinscan_pio_stop();
+        return true;
+    }
+
+    pinscan_pio_stop();
+    return false;
+}
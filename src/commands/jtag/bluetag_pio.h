@@ -0,0 +1,36 @@
+/**
+ * @file bluetag_pio.h
+ * @brief Parallel JTAG/SWD pinout discovery using the pin scan PIO engine.
+ */
+
+#ifndef _BLUETAG_PIO_H
+#define _BLUETAG_PIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct bluetag_pio_stats {
+    uint32_t passes;       // clock/mode pin candidates driven
+    uint32_t pruned;       // passes rejected without any further clocks
+    uint32_t permutations; // pin permutations covered, comparable to blueTag
+};
+
+/**
+ * @brief Find TCK, TMS, TDO and TDI on IO0 to IO(channels - 1).
+ * @param channels  Number of IO pins, 4 to 8
+ * @param pulse     Pulse all pins low then high before each pass
+ * @param[out] stats  Scan statistics
+ * @return true if a device was found, the pinout and IDCODEs are printed
+ * @note TRST is not searched.
+ */
+bool bluetag_pio_jtag_scan(uint32_t channels, bool pulse, struct bluetag_pio_stats* stats);
+
+/**
+ * @brief Find SWCLK and SWDIO on IO0 to IO(channels - 1).
+ * @param channels  Number of IO pins, 2 to 8
+ * @param[out] stats  Scan statistics
+ * @return true if a device was found, the pinout and DPIDR are printed
+ */
+bool bluetag_pio_swd_scan(uint32_t channels, struct bluetag_pio_stats* stats);
+
+#endif
@@ -19,16 +19,21 @@
 #include "binmode/fala.h"
 #include "ui/ui_hex.h"
 #include "lib/bp_args/bp_cmd.h"
+#include "pirate/hash.h"
 
 static const char* const usage[] = {
-    "flash [probe|dump|erase|write|read|verify|test]\r\n\t[-f <file>] [-e(rase)] [-v(verify)] [-h(elp)]",
+    "flash [probe|dump|erase|write|read|verify|test|hash]\r\n\t[-f <file>] [-e(rase)] [-v(verify)] [-d(iff)] [-l <lines>] [-h(elp)]",
     "Initialize and probe:%s flash probe",
     "Show flash contents (x to exit):%s flash dump",
     "Show 16 bytes starting at address 0x60:%s flash dump -s 0x60 -b 16",
     "Erase and program, with verify:%s flash write -f example.bin -e -v",
+    "Program only changed sectors, with verify:%s flash write -f example.bin -d -v",
     "Read to file:%s flash read -f example.bin",
+    "Read to file with quad read (IO2=BIO2, IO3=BIO3):%s flash read -f example.bin -l 4",
     "Verify with file:%s flash verify -f example.bin",
     "Test chip (full erase/write/verify):%s flash test",
+    "CRC32/SHA-256 of the chip:%s flash hash",
+    "CRC32/SHA-256 of the first 64K:%s flash hash -b 0x10000",
     "Force dump:%s flash read -o -b <bytes> -f <file>"
 };
 
@@ -39,7 +44,8 @@ enum flash_actions {
     FLASH_WRITE,
     FLASH_READ,
     FLASH_VERIFY,
-    FLASH_TEST
+    FLASH_TEST,
+    FLASH_HASH
 };
 
 static const bp_command_action_t flash_action_defs[] = {
@@ -50,12 +56,15 @@ static const bp_command_action_t flash_action_defs[] = {
     { FLASH_READ,   "read",   T_HELP_FLASH_READ },
     { FLASH_VERIFY, "verify", T_HELP_FLASH_VERIFY },
     { FLASH_TEST,   "test",   T_HELP_FLASH_TEST },
+    { FLASH_HASH,   "hash",   T_HELP_FLASH_HASH },
 };
 
 static const bp_command_opt_t flash_opts[] = {
     { "file",     'f', BP_ARG_REQUIRED, "file",    T_HELP_FLASH_FILE_FLAG },
     { "erase",    'e', BP_ARG_NONE,     NULL,        T_HELP_FLASH_ERASE_FLAG },
     { "verify",   'v', BP_ARG_NONE,     NULL,        T_HELP_FLASH_VERIFY_FLAG },
+    { "diff",     'd', BP_ARG_NONE,     NULL,        T_HELP_FLASH_DIFF_FLAG },
+    { "lines",    'l', BP_ARG_REQUIRED, "1|2|4",   T_HELP_FLASH_LINES_FLAG },
     { "start",    's', BP_ARG_REQUIRED, "addr",    UI_HEX_HELP_START },
     { "bytes",    'b', BP_ARG_REQUIRED, "count",   UI_HEX_HELP_BYTES },
     { "quiet",    'q', BP_ARG_NONE,     NULL,        UI_HEX_HELP_QUIET },
@@ -95,6 +104,8 @@ void flash(struct command_result* res) {
     bool erase_flag = bp_cmd_find_flag(&flash_def, 'e');
     // verify_flag
     bool verify_flag = bp_cmd_find_flag(&flash_def, 'v');
+    // diff_flag: skip chip erase, only erase/program sectors that differ from the file
+    bool diff_flag = bp_cmd_find_flag(&flash_def, 'd');
     // file to read/write/verify
     char file[13];
     if((flash_action == FLASH_WRITE || flash_action == FLASH_READ || flash_action == FLASH_VERIFY)) {
@@ -103,12 +114,22 @@ void flash(struct command_result* res) {
         }
     }
 
-    // error if read/verify and erase flag is set, doesn't make sense to erase if just reading or verifying
-    if((flash_action == FLASH_READ || flash_action == FLASH_VERIFY) && erase_flag) {
-        printf("Erase flag (-e) cannot be used with read or verify actions\r\n");
+    // error if read/verify/hash and erase flag is set, doesn't make sense to erase if just reading or verifying
+    if((flash_action == FLASH_READ || flash_action == FLASH_VERIFY || flash_action == FLASH_HASH) && erase_flag) {
+        printf("Erase flag (-e) cannot be used with read, verify or hash actions\r\n");
         return;
     }
 
+    if (diff_flag && flash_action != FLASH_WRITE) {
+        printf("Diff flag (-d) can only be used with the write action\r\n");
+        return;
+    }
+
+    if (diff_flag && erase_flag) {
+        printf("Diff flag (-d) erases sectors as needed, ignoring erase flag (-e)\r\n");
+        erase_flag = false;
+    }
+
     // prompt yes/no for destructive action: erase, write, test (override with -y)
     if((flash_action == FLASH_ERASE || flash_action == FLASH_WRITE || flash_action == FLASH_TEST)) {
         if(!bp_cmd_confirm(&flash_def, "This action may modify the SPI flash contents. Do you want to continue?")) {
@@ -118,6 +139,16 @@ void flash(struct command_result* res) {
 
     bool override_flag = bp_cmd_find_flag(&flash_def, 'o');
 
+    // data lines for read, default auto (dual if the chip supports it)
+    uint32_t data_lines = 0;
+    if (bp_cmd_find_flag(&flash_def, 'l')) {
+        if (!bp_cmd_get_uint32(&flash_def, 'l', &data_lines) ||
+            (data_lines != 1 && data_lines != 2 && data_lines != 4)) {
+            printf("Data lines (-l) must be 1, 2 or 4\r\n");
+            return;
+        }
+    }
+
     // start and end rage? bytes to write/dump???
     sfud_flash flash_info = { .name = "SPI_FLASH", .spi.name = "SPI1" };
     uint8_t data[256];
@@ -154,7 +185,7 @@ void flash(struct command_result* res) {
         goto flash_cleanup; // no need to continue
     }
 
-    if (flash_action == FLASH_ERASE || (erase_flag && FLASH_WRITE) || flash_action == FLASH_TEST) {
+    if (flash_action == FLASH_ERASE || (erase_flag && flash_action == FLASH_WRITE) || flash_action == FLASH_TEST) {
         if (!spiflash_erase(&flash_info)) {
             goto flash_cleanup;
         }
@@ -175,7 +206,11 @@ void flash(struct command_result* res) {
     }
 
     if (flash_action == FLASH_WRITE) {
-        if (!spiflash_load(start_address, end_address, sizeof(data), data, &flash_info, file)) {
+        if (diff_flag) {
+            if (!spiflash_load_diff(start_address, end_address, sizeof(data), data, data2, &flash_info, file)) {
+                goto flash_cleanup;
+            }
+        } else if (!spiflash_load(start_address, end_address, sizeof(data), data, &flash_info, file)) {
             goto flash_cleanup;
         }
         if (verify_flag) {
@@ -186,7 +221,7 @@ void flash(struct command_result* res) {
     }
 
     if (flash_action == FLASH_READ) {
-        if (!spiflash_dump(start_address, end_address, sizeof(data), data, &flash_info, file)) {
+        if (!spiflash_dump(start_address, end_address, sizeof(data), data, &flash_info, file, data_lines)) {
             goto flash_cleanup;
         }
     }
@@ -197,6 +232,28 @@ void flash(struct command_result* res) {
         }
     }
 
+    if (flash_action == FLASH_HASH) {
+        // whole chip by default, or a range with -s and -b
+        uint32_t hash_start = 0;
+        uint32_t hash_bytes;
+        bp_cmd_get_uint32(&flash_def, 's', &hash_start);
+        if (hash_start >= end_address) {
+            printf("Start address (-s) is past the end of the flash\r\n");
+            goto flash_cleanup;
+        }
+        if (!bp_cmd_get_uint32(&flash_def, 'b', &hash_bytes) || hash_bytes > (end_address - hash_start)) {
+            hash_bytes = end_address - hash_start;
+        }
+        hash_ctx_t hash;
+        uint8_t digest[HASH_SHA256_BYTES];
+        hash_init(&hash, true);
+        if (!spiflash_hash(hash_start, hash_start + hash_bytes, sizeof(data), data, &flash_info, data_lines, &hash, false)) {
+            goto flash_cleanup;
+        }
+        hash_final(&hash, digest);
+        hash_print(&hash, digest);
+    }
+
 flash_cleanup:
     //we manually control any FALA capture
     fala_stop_hook();
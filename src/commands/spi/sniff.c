@@ -22,6 +22,7 @@
 #include "spisnif.pio.h"
 #include "usb_rx.h"
 #include "pio_config.h"
+#include "pirate/tasks.h"
 
 static struct _pio_config pio_config;
 static struct _pio_config pio_config_d1;
@@ -101,11 +102,17 @@ void sniff_handler(struct command_result* res) {
     system_bio_update_purpose_and_label(true, BIO3, BP_PIN_MODE, pin_labels[3]);
     printf("Any key to exit\r\n");
     while (true) {
+        bool new_val = false;
         if (pio_read(&value)) {
             printf("%d ", value);
+            new_val = true;
         }
         if (pio_read_d1(&value)) {
             printf("(%d) ", value);
+            new_val = true;
+        }
+        if (!new_val) {
+            tasks_yield(); // bus is quiet, let the background tasks run
         }
         char c;
         if (rx_fifo_try_get(&c)) {
@@ -18,6 +18,9 @@
 #include "spiflash.h"
 #include "pirate/mem.h"
 #include "pirate/hwspi.h"
+#include "pirate/spiflash_read_pio.h"
+#include "pirate/hash.h"
+#include "mode/hwspi.h"
 #include "fatfs/ff.h"
 #include "ui/ui_hex.h"
 #include "lib/bp_args/bp_cmd.h"
@@ -249,17 +252,183 @@ bool spiflash_show_hex(const bp_command_def_t *def,
     return true;
 }
 
+// data bytes per DMA chunk, a dual read needs 4x this in raw samples (x2 for double buffering)
+#define SPIFLASH_FAST_CHUNK 8192
+
+// flash reads are streamed to a sink: a file for dumps, a running hash for hash
+typedef bool (*spiflash_sink_t)(void* sink_ctx, const uint8_t* data, uint32_t count);
+
+static bool spiflash_sfdp_fast_read(uint8_t data_lines, spiflash_read_pio_cmd_t* cmd);
+
+// read the start of the range with the fast engine and compare to a 1 bit read
+// catches chips that need a QE bit, missing IO2/IO3 wires, or bad SFDP data
+static bool spiflash_fast_read_check(
+    const spiflash_read_pio_cmd_t* cmd, uint32_t start_address, uint8_t* buf, uint8_t* big_buf, sfud_flash* flash_info) {
+    uint8_t* raw = big_buf;
+    uint8_t* data = big_buf + spiflash_read_pio_raw_size(256);
+    if (sfud_read(flash_info, start_address, 256, buf) != SFUD_SUCCESS) {
+        return false;
+    }
+    spiflash_read_pio_start(cmd, start_address, flash_info->addr_in_4_byte);
+    spiflash_read_pio_dma_start(raw, 256);
+    spiflash_read_pio_dma_wait();
+    spiflash_read_pio_stop();
+    spiflash_read_pio_decode(raw, data, 256);
+    return (memcmp(buf, data, 256) == 0);
+}
+
+static bool spiflash_read_fast(uint32_t start_address,
+                               uint32_t end_address,
+                               const spiflash_read_pio_cmd_t* cmd,
+                               uint8_t* big_buf,
+                               sfud_flash* flash_info,
+                               spiflash_sink_t sink,
+                               void* sink_ctx,
+                               bool quiet) {
+    uint32_t bytes_total = (end_address - start_address);
+    uint32_t current_address = start_address;
+    uint32_t raw_size = spiflash_read_pio_raw_size(SPIFLASH_FAST_CHUNK);
+    uint8_t* raw[2] = { big_buf, big_buf + raw_size };
+    uint8_t* data = big_buf + (2 * raw_size);
+    uint8_t raw_idx = 0;
+    bool ok = true;
+
+    ui_term_progress_bar_t progress_bar;
+    if (!quiet) {
+        ui_term_progress_bar_draw(&progress_bar);
+    }
+    uint32_t start_time = time_us_32();
+
+    // one continuous read command, DMA fills one raw buffer while the CPU unpacks and sinks the other
+    spiflash_read_pio_start(cmd, start_address, flash_info->addr_in_4_byte);
+    uint32_t read_count = spiflash_next_count(current_address, end_address, SPIFLASH_FAST_CHUNK);
+    spiflash_read_pio_dma_start(raw[raw_idx], read_count);
+    while (true) {
+        if (!quiet) {
+            ui_term_progress_bar_update(bytes_total - (end_address - current_address), bytes_total, &progress_bar);
+        }
+        spiflash_read_pio_dma_wait();
+        uint32_t next_address = current_address + read_count;
+        uint32_t next_count = 0;
+        if (next_address < end_address) {
+            next_count = spiflash_next_count(next_address, end_address, SPIFLASH_FAST_CHUNK);
+            spiflash_read_pio_dma_start(raw[raw_idx ^ 1], next_count);
+        }
+
+        spiflash_read_pio_decode(raw[raw_idx], data, read_count);
+        if (!sink(sink_ctx, data, read_count)) {
+            ok = false;
+            break;
+        }
+
+        current_address = next_address;
+        if (current_address >= end_address) {
+            break; // done!
+        }
+        read_count = next_count;
+        raw_idx ^= 1;
+    }
+    spiflash_read_pio_stop();
+
+    uint32_t elapsed_ms = (time_us_32() - start_time) / 1000;
+    if (!quiet) {
+        ui_term_progress_bar_cleanup(&progress_bar);
+    }
+    if (ok && !quiet) {
+        printf("Read %d bytes in %dms\r\n", bytes_total, elapsed_ms);
+    }
+    return ok;
+}
+
+// read a range through the fastest path available and pass it to a sink
+// try a dual/quad fast read from the SFDP table, fall back to 1 bit reads
+// auto (0) stops at dual, quad needs IO2/IO3 wired up so it must be requested
+static bool spiflash_read_stream(uint32_t start_address,
+                                 uint32_t end_address,
+                                 uint32_t buf_size,
+                                 uint8_t* buf,
+                                 sfud_flash* flash_info,
+                                 uint8_t data_lines,
+                                 spiflash_sink_t sink,
+                                 void* sink_ctx,
+                                 bool quiet) {
+    uint32_t bytes_total = (end_address - start_address);
+    uint32_t current_address = start_address;
+
+    spiflash_read_pio_cmd_t fast_cmd;
+    if (data_lines != 1 && buf_size >= 256 && bytes_total >= 256 &&
+        spiflash_sfdp_fast_read(data_lines ? data_lines : 2, &fast_cmd)) {
+        uint8_t* big_buf = mem_alloc(BIG_BUFFER_SIZE, BP_BIG_BUFFER_SPIFLASH);
+        if (big_buf) {
+            bool fast_ok = false, fast_done = false;
+            if (spiflash_read_pio_init(fast_cmd.data_lines, spi_get_speed())) {
+                if (spiflash_fast_read_check(&fast_cmd, start_address, buf, big_buf, flash_info)) {
+                    if (!quiet) {
+                        printf("Using 1-1-%d fast read (0x%02x)\r\n", fast_cmd.data_lines, fast_cmd.instruction);
+                    }
+                    fast_ok = spiflash_read_fast(
+                        start_address, end_address, &fast_cmd, big_buf, flash_info, sink, sink_ctx, quiet);
+                    fast_done = true;
+                } else if (!quiet) {
+                    printf("1-1-%d fast read check failed, using 1 bit reads\r\n", fast_cmd.data_lines);
+                }
+                spiflash_read_pio_cleanup();
+            }
+            mem_free(big_buf);
+            if (fast_done) {
+                return fast_ok;
+            }
+        }
+    }
+
+    ui_term_progress_bar_t progress_bar;
+    if (!quiet) {
+        ui_term_progress_bar_draw(&progress_bar);
+    }
+    bool ok = true;
+    while (current_address < end_address) {
+        if (!quiet) {
+            ui_term_progress_bar_update(bytes_total - (end_address - current_address), bytes_total, &progress_bar);
+        }
+        uint32_t read_count = spiflash_next_count(current_address, end_address, buf_size);
+        if (sfud_read(flash_info, current_address, read_count, buf) != SFUD_SUCCESS) {
+            if (!quiet) {
+                ui_term_progress_bar_cleanup(&progress_bar);
+                printf("\r\nError: read failed\r\n");
+            }
+            return false;
+        }
+        if (!sink(sink_ctx, buf, read_count)) {
+            ok = false;
+            break;
+        }
+        current_address += read_count;
+    }
+    if (!quiet) {
+        ui_term_progress_bar_cleanup(&progress_bar);
+    }
+    return ok;
+}
+
+static bool spiflash_file_sink(void* sink_ctx, const uint8_t* data, uint32_t count) {
+    UINT bw;
+    FRESULT fr = f_write((FIL*)sink_ctx, data, count, &bw);
+    if (fr != FR_OK || bw != count) {
+        storage_file_error(fr);
+        return false;
+    }
+    return true;
+}
+
 bool spiflash_dump(uint32_t start_address,
                    uint32_t end_address,
                    uint32_t buf_size,
                    uint8_t* buf,
                    sfud_flash* flash_info,
-                   const char* file_name) {
-    uint32_t bytes_total = (end_address - start_address);
-    uint32_t current_address = start_address;
+                   const char* file_name,
+                   uint8_t data_lines) {
     FIL fil;    /* File object needed for each open file */
     FRESULT fr; /* FatFs return code */
-    UINT bw;
 
     printf("Dumping to %s...\r\n", file_name);
 
@@ -270,34 +439,36 @@ bool spiflash_dump(uint32_t start_address,
         return false;
     }
 
-    ui_term_progress_bar_t progress_bar;
-    ui_term_progress_bar_draw(&progress_bar);
-    while (true) {
-        ui_term_progress_bar_update(bytes_total - (end_address - current_address), bytes_total, &progress_bar);
-        uint32_t read_count = spiflash_next_count(current_address, end_address, buf_size);
-        if (sfud_read(flash_info, current_address, read_count, buf) != SFUD_SUCCESS) {
-            ui_term_progress_bar_cleanup(&progress_bar);
-            printf("\r\nError: read failed\r\n");
-            return false;
-        }
-        f_write(&fil, buf, read_count, &bw);
-        if (fr != FR_OK || bw != read_count) {
-            ui_term_progress_bar_cleanup(&progress_bar);
-            storage_file_error(fr);
-            return false;
-        }
-        current_address += read_count;
-        if (current_address == end_address) {
-            break; // done!
-        }
-    }
+    bool ok = spiflash_read_stream(
+        start_address, end_address, buf_size, buf, flash_info, data_lines, spiflash_file_sink, &fil, false);
     f_close(&fil);
-
-    ui_term_progress_bar_cleanup(&progress_bar);
+    if (!ok) {
+        return false;
+    }
     printf("Dump OK\r\n");
     return true;
 }
 
+static bool spiflash_hash_sink(void* sink_ctx, const uint8_t* data, uint32_t count) {
+    hash_update((hash_ctx_t*)sink_ctx, data, count);
+    return true;
+}
+
+bool spiflash_hash(uint32_t start_address,
+                   uint32_t end_address,
+                   uint32_t buf_size,
+                   uint8_t* buf,
+                   sfud_flash* flash_info,
+                   uint8_t data_lines,
+                   struct hash_ctx* hash,
+                   bool quiet) {
+    if (!quiet) {
+        printf("Hashing 0x%08X-0x%08X...\r\n", start_address, end_address - 1);
+    }
+    return spiflash_read_stream(
+        start_address, end_address, buf_size, buf, flash_info, data_lines, spiflash_hash_sink, hash, quiet);
+}
+
 bool spiflash_load(uint32_t start_address,
                    uint32_t end_address,
                    uint32_t buf_size,
@@ -368,6 +539,160 @@ bool spiflash_load(uint32_t start_address,
     return true;
 }
 
+// scan one chunk of file data against the flash contents
+// differs: at least one byte is different
+// needs_erase: at least one bit must go from 0 to 1, only an erase can do that
+// blank: file data is all 0xff, nothing to program after an erase
+static void spiflash_diff_chunk(
+    const uint8_t* file_buf, const uint8_t* flash_buf, uint32_t count, bool* differs, bool* needs_erase, bool* blank) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (file_buf[i] != flash_buf[i]) {
+            *differs = true;
+            if ((flash_buf[i] & file_buf[i]) != file_buf[i]) {
+                *needs_erase = true;
+            }
+        }
+        if (file_buf[i] != 0xff) {
+            *blank = false;
+        }
+    }
+}
+
+// read a chunk from the file, pad with 0xff past the end of the file (same as spiflash_load)
+static bool spiflash_diff_file_read(FIL* fil, uint8_t* buf, uint32_t count) {
+    UINT file_read_count;
+    FRESULT fr = f_read(fil, buf, count, &file_read_count);
+    if (fr != FR_OK) {
+        storage_file_error(fr);
+        return false;
+    }
+    if (file_read_count < count) {
+        memset(buf + file_read_count, 0xff, count - file_read_count);
+    }
+    return true;
+}
+
+bool spiflash_load_diff(uint32_t start_address,
+                        uint32_t end_address,
+                        uint32_t buf_size,
+                        uint8_t* buf,
+                        uint8_t* buf2,
+                        sfud_flash* flash_info,
+                        const char* file_name) {
+    FIL fil;    /* File object needed for each open file */
+    FRESULT fr; /* FatFs return code */
+
+    uint32_t sector_size = flash_info->chip.erase_gran;
+    if (sector_size == 0 || (sector_size % buf_size) != 0 || (start_address % sector_size) != 0) {
+        printf("Error: erase size %d not supported for differential write\r\n", sector_size);
+        return false;
+    }
+
+    printf("Differential load from %s...\r\n", file_name);
+
+    // open file
+    fr = f_open(&fil, file_name, FA_READ);
+    if (fr != FR_OK) {
+        storage_file_error(fr);
+        return false;
+    }
+
+    // only sectors covered by the file are touched, the rest of the chip is left as-is
+    uint32_t file_size = f_size(&fil);
+    printf("File size: %d, chip size: %d, sector size: %d\r\n", file_size, end_address - start_address, sector_size);
+    if (file_size > (end_address - start_address)) {
+        printf("Warning: file too large, writing first %d bytes\r\n", end_address - start_address);
+    } else if (file_size < (end_address - start_address)) {
+        end_address = start_address + file_size;
+    }
+
+    uint32_t bytes_total = (end_address - start_address);
+    uint32_t sectors_total = 0, sectors_unchanged = 0, sectors_blank = 0, sectors_erased = 0, pages_programmed = 0;
+    bool ok = false;
+
+    ui_term_progress_bar_t progress_bar;
+    ui_term_progress_bar_draw(&progress_bar);
+    for (uint32_t sector_address = start_address; sector_address < end_address; sector_address += sector_size) {
+        ui_term_progress_bar_update(sector_address - start_address, bytes_total, &progress_bar);
+        sectors_total++;
+
+        // pass 1: compare the sector to the file, decide what needs to be done
+        bool differs = false, needs_erase = false, blank = true;
+        for (uint32_t offset = 0; offset < sector_size; offset += buf_size) {
+            if (!spiflash_diff_file_read(&fil, buf, buf_size)) {
+                goto load_diff_cleanup;
+            }
+            if (sfud_read(flash_info, sector_address + offset, buf_size, buf2) != SFUD_SUCCESS) {
+                printf("\r\nError: read failed at 0x%06x\r\n", sector_address + offset);
+                goto load_diff_cleanup;
+            }
+            spiflash_diff_chunk(buf, buf2, buf_size, &differs, &needs_erase, &blank);
+        }
+
+        if (!differs) {
+            sectors_unchanged++;
+            continue;
+        }
+
+        if (needs_erase) {
+            if (sfud_erase(flash_info, sector_address, sector_size) != SFUD_SUCCESS) {
+                printf("\r\nError: erase failed at 0x%06x\r\n", sector_address);
+                goto load_diff_cleanup;
+            }
+            sectors_erased++;
+            if (blank) {
+                sectors_blank++; // erased is all we need
+                continue;
+            }
+        }
+
+        // pass 2: rewind the file and program only the pages that still differ
+        fr = f_lseek(&fil, sector_address - start_address);
+        if (fr != FR_OK) {
+            storage_file_error(fr);
+            goto load_diff_cleanup;
+        }
+        for (uint32_t offset = 0; offset < sector_size; offset += buf_size) {
+            if (!spiflash_diff_file_read(&fil, buf, buf_size)) {
+                goto load_diff_cleanup;
+            }
+            bool page_differs = false, page_needs_erase = false, page_blank = true;
+            if (needs_erase) {
+                // sector was just erased, no need to read it back
+                memset(buf2, 0xff, buf_size);
+            } else if (sfud_read(flash_info, sector_address + offset, buf_size, buf2) != SFUD_SUCCESS) {
+                printf("\r\nError: read failed at 0x%06x\r\n", sector_address + offset);
+                goto load_diff_cleanup;
+            }
+            spiflash_diff_chunk(buf, buf2, buf_size, &page_differs, &page_needs_erase, &page_blank);
+            if (!page_differs) {
+                continue;
+            }
+            if (sfud_write(flash_info, sector_address + offset, buf_size, buf) != SFUD_SUCCESS) {
+                printf("\r\nError: write failed at 0x%06x\r\n", sector_address + offset);
+                goto load_diff_cleanup;
+            }
+            pages_programmed++;
+        }
+        // file position is at the start of the next sector again
+    }
+    ok = true;
+
+load_diff_cleanup:
+    f_close(&fil);
+    ui_term_progress_bar_cleanup(&progress_bar);
+    printf("Sectors: %d, unchanged (skipped): %d, erased: %d (blank, not programmed: %d)\r\n",
+           sectors_total,
+           sectors_unchanged,
+           sectors_erased,
+           sectors_blank);
+    printf("Pages programmed: %d (%d bytes)\r\n", pages_programmed, pages_programmed * buf_size);
+    if (ok) {
+        printf("Program OK\r\n");
+    }
+    return ok;
+}
+
 bool spiflash_verify(uint32_t start_address,
                      uint32_t end_address,
                      uint32_t buf_size,
@@ -459,6 +784,8 @@ typedef struct __attribute__((packed)) ptp_record_struct {
     uint32_t address : 24;
 } ptp_record_t;
 
+#define PTP_JEDEC 0
+
 typedef struct __attribute__((packed)) ptp_jedec_struct {
     // table part 1
     uint8_t erase_size : 2;     // Block / Sector Erase sizes, 01:4KB erase, 11:not supported 4KB erase, other reserve.
@@ -556,6 +883,50 @@ uint32_t flash_erase_size(uint32_t size, char* unit) {
     return erase_size;
 }
 
+// find a 1-1-2 or 1-1-4 fast read in the JEDEC basic flash parameter table
+// parsed from the raw DWORDs, wait states are 5 bits and mode clocks 3 bits (JESD216)
+static bool spiflash_sfdp_fast_read(uint8_t data_lines, spiflash_read_pio_cmd_t* cmd) {
+    uint8_t sfdp[64];
+    hwspi_select();
+    hwspi_write_32(0x5a000000, 4);
+    hwspi_write(0xff); // dummy byte
+    hwspi_read_n(sfdp, 16);
+    hwspi_deselect();
+
+    ptp_head_t* ptp_head = (ptp_head_t*)&sfdp;
+    ptp_record_t* ptp_rec = (ptp_record_t*)&sfdp[8]; // first parameter header is always JEDEC basic
+    if (ptp_head->signature != 0x50444653 || ptp_rec->id != PTP_JEDEC || ptp_rec->length_dwords < 4) {
+        return false;
+    }
+
+    hwspi_select();
+    hwspi_write_32(0x5a000000 + ptp_rec->address, 4);
+    hwspi_write(0xff); // dummy byte
+    hwspi_read_n(sfdp, 16);
+    hwspi_deselect();
+
+    bool has_114 = (sfdp[2] >> 6) & 0b1;
+    bool has_112 = sfdp[2] & 0b1;
+    if (data_lines >= 4 && has_114) {
+        cmd->data_lines = 4;
+        cmd->instruction = sfdp[11];
+        cmd->dummy_clocks = (sfdp[10] & 0x1f) + (sfdp[10] >> 5);
+    } else if (data_lines >= 2 && has_112) {
+        cmd->data_lines = 2;
+        cmd->instruction = sfdp[13];
+        cmd->dummy_clocks = (sfdp[12] & 0x1f) + (sfdp[12] >> 5);
+    } else {
+        return false;
+    }
+
+    // dummy clocks are sent as whole bytes by the SPI peripheral
+    if (cmd->dummy_clocks == 0 || (cmd->dummy_clocks % 8) != 0) {
+        printf("1-1-%d fast read needs %d dummy clocks, not supported\r\n", cmd->data_lines, cmd->dummy_clocks);
+        return false;
+    }
+    return true;
+}
+
 bool flash_read_resid(uint8_t* res_id) {
     // DP 0xB9: deep power down and then RDP 0xAB, 3 dummy bytes, 1 RES ID byte (release and read ID)
     // deep sleep command
@@ -674,7 +1045,6 @@ void spiflash_probe(void) {
         uint8_t ptp_id = ptp_rec->id;
         uint8_t ptp_length = ptp_rec->length_dwords * 4;
         uint32_t ptp_address = ptp_rec->address;
-#define PTP_JEDEC 0
         printf("\t\tType\t\tVer.\tLength\tAddress\r\n");
         printf("Table %d\t\t%s (0x%02x)\t%d.%d\t%d\t0x%06x\r\n",
                i,
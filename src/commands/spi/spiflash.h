@@ -68,6 +68,7 @@ bool spiflash_write_verify(
  * @param buf            Buffer
  * @param flash_info     Flash information structure
  * @param file_name      Output filename
+ * @param data_lines     0 = auto (1-1-2 fast read if SFDP has it), 1 = single bit, 2 = 1-1-2, 4 = 1-1-4
  * @return true on success
  */
 bool spiflash_dump(uint32_t start_address,
@@ -75,7 +76,32 @@ bool spiflash_dump(uint32_t start_address,
                    uint32_t buf_size,
                    uint8_t* buf,
                    sfud_flash* flash_info,
-                   const char* file_name);
+                   const char* file_name,
+                   uint8_t data_lines);
+
+/**
+ * @brief Hash a range of SPI flash without transferring it.
+ * @details Reads through the same fast read path as spiflash_dump() and feeds
+ *          the data to a running CRC32/SHA-256.
+ * @param start_address  Start address
+ * @param end_address    End address
+ * @param buf_size       Buffer size
+ * @param buf            Buffer
+ * @param flash_info     Flash information structure
+ * @param data_lines     0 = auto, 1 = single bit, 2 = 1-1-2, 4 = 1-1-4
+ * @param hash           Hash context, initialized with hash_init()
+ * @param quiet          No progress bar or messages (for BPIO)
+ * @return true on success
+ */
+struct hash_ctx;
+bool spiflash_hash(uint32_t start_address,
+                   uint32_t end_address,
+                   uint32_t buf_size,
+                   uint8_t* buf,
+                   sfud_flash* flash_info,
+                   uint8_t data_lines,
+                   struct hash_ctx* hash,
+                   bool quiet);
 
 /**
  * @brief Load file to SPI flash.
@@ -94,6 +120,29 @@ bool spiflash_load(uint32_t start_address,
                    sfud_flash* flash_info,
                    const char* file_name);
 
+/**
+ * @brief Load file to SPI flash, programming only what differs.
+ * @details Compares each erase sector against the file. Unchanged sectors are
+ *          skipped, sectors that need 0->1 bits are erased, and only pages that
+ *          differ (and are not blank after erase) are programmed. Sectors past
+ *          the end of the file are not touched.
+ * @param start_address  Start address (must be sector aligned)
+ * @param end_address    End address
+ * @param buf_size       Buffer size (must divide the sector size)
+ * @param buf            Buffer 1
+ * @param buf2           Buffer 2
+ * @param flash_info     Flash information structure
+ * @param file_name      Input filename
+ * @return true on success
+ */
+bool spiflash_load_diff(uint32_t start_address,
+                        uint32_t end_address,
+                        uint32_t buf_size,
+                        uint8_t* buf,
+                        uint8_t* buf2,
+                        sfud_flash* flash_info,
+                        const char* file_name);
+
 /**
  * @brief Verify SPI flash against file.
  * @param start_address  Start address
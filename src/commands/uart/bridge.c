@@ -15,13 +15,18 @@
 #include "usb_rx.h"
 #include "usb_tx.h"
 #include "lib/bp_args/bp_cmd.h"
+#include "pirate/tasks.h"
+#include "pirate/hwuart_rx.h"
+#include "pirate/uart_dma_bridge.h"
 
-static const char* const usage[] = { "bridge\t[-h(elp)] [-t(oolbar)]",
+static const char* const usage[] = { "bridge\t[-h(elp)] [-t(oolbar)] [-d(ma)]",
                                      "Transparent UART bridge:%s bridge",
+                                     "DMA bridge for 1Mbaud and up:%s bridge -d",
                                      "Exit:%s press Bus Pirate button" };
 
 static const bp_command_opt_t bridge_opts[] = {
     { "toolbar", 't', BP_ARG_NONE, NULL, T_HELP_UART_BRIDGE_TOOLBAR },
+    { "dma",     'd', BP_ARG_NONE, NULL, T_HELP_UART_BRIDGE_DMA },
     { 0 }
 };
 
@@ -35,6 +40,55 @@ const bp_command_def_t uart_bridge_def = {
     .usage_count = count_of(usage),
 };
 
+static void uart_bridge_polled(void) {
+    bio_put(M_UART_RTS, 0);
+    while (true) {
+        char c;
+        if (rx_fifo_try_get(&c)) {
+            uart_putc_raw(M_UART_PORT, c);
+        }
+        if (uart_is_readable(M_UART_PORT)) {
+            c = uart_getc(M_UART_PORT);
+            tx_fifo_put(&c);
+        } else {
+            tasks_yield(); // nothing waiting in the UART FIFO, let the background tasks run
+        }
+        // exit when button pressed.
+        if (button_get(0)) {
+            break;
+        }
+    }
+    bio_put(M_UART_RTS, 1);
+}
+
+// core1 moves the data, core0 only waits for the button
+static void uart_bridge_dma(void) {
+    while (!button_get(0)) {
+        tasks_yield();
+    }
+    struct uart_dma_bridge_stats stats;
+    uart_dma_bridge_stop(&stats);
+
+    uint32_t ms = stats.elapsed_us / 1000;
+    if (!ms) {
+        ms = 1;
+    }
+    // kB/s at the line rate for comparison, 10 bit periods per byte at 8N1
+    printf("\r\n%s%s:%s %lu baud (%lu kB/s max), UART->USB %lu bytes %lu kB/s, USB->UART %lu bytes %lu kB/s, "
+           "%lu dropped, RTS stopped %lu times\r\n",
+           ui_term_color_info(),
+           GET_T(T_UART_BRIDGE_DMA_STATS),
+           ui_term_color_reset(),
+           stats.baud,
+           stats.baud / 10 / 1000,
+           stats.rx_bytes,
+           (uint32_t)((uint64_t)stats.rx_bytes / ms),
+           stats.tx_bytes,
+           (uint32_t)((uint64_t)stats.tx_bytes / ms),
+           stats.dropped,
+           stats.rts_stops);
+}
+
 void uart_bridge_handler(struct command_result* res) {
     if (bp_cmd_help_check(&uart_bridge_def, res->help_flag)) {
         return;
@@ -42,6 +96,7 @@ void uart_bridge_handler(struct command_result* res) {
     if (!ui_help_check_vout_vref()) {
         return;
     }
+    hwuart_rx_stop(); // read the UART directly, async print picks it up again after
 
     bool toolbar_state = system_config.terminal_ansi_statusbar_pause;
     bool pause_toolbar = !bp_cmd_find_flag(&uart_bridge_def, 't');
@@ -50,22 +105,20 @@ void uart_bridge_handler(struct command_result* res) {
     }
 
     printf("%s%s%s\r\n", ui_term_color_notice(), GET_T(T_HELP_UART_BRIDGE_EXIT), ui_term_color_reset());
-    bio_put(M_UART_RTS, 0);
-    while (true) {
-        char c;
-        if (rx_fifo_try_get(&c)) {
-            uart_putc_raw(M_UART_PORT, c);
+    if (!bp_cmd_find_flag(&uart_bridge_def, 'd')) {
+        uart_bridge_polled();
+    } else {
+        // the DMA bridge writes CDC 0 directly, let the terminal output go first
+        while (tx_fifo_not_empty()) {
+            tasks_yield();
         }
-        if (uart_is_readable(M_UART_PORT)) {
-            c = uart_getc(M_UART_PORT);
-            tx_fifo_put(&c);
-        }
-        // exit when button pressed.
-        if (button_get(0)) {
-            break;
+        if (uart_dma_bridge_start()) {
+            uart_bridge_dma();
+        } else {
+            printf("%s%s%s\r\n", ui_term_color_warning(), GET_T(T_UART_BRIDGE_DMA_UNAVAILABLE), ui_term_color_reset());
+            uart_bridge_polled();
         }
     }
-    bio_put(M_UART_RTS, 1);
 
     if (pause_toolbar) {
         system_config.terminal_ansi_statusbar_pause = toolbar_state;
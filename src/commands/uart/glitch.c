@@ -53,6 +53,7 @@
 #include "lib/bp_args/bp_cmd.h"
 #include "bytecode.h"
 #include "pirate/button.h"
+#include "pirate/hwuart_rx.h"
 
 #include "hardware/pio.h"
 #include "pio_config.h"
@@ -411,6 +412,8 @@ void uart_glitch_handler(struct command_result* res) {
         return;
     }
 
+    hwuart_rx_stop(); // read the UART directly, async print picks it up again after
+
     // Go get/set up config for glitching
     if (!uart_glitch_setup()) {
         printf("%s%s%s\r\n", ui_term_color_error(), GET_T(T_UART_GLITCH_SETUP_ERR), ui_term_color_reset());
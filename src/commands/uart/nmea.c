@@ -12,6 +12,7 @@
 #include "lib/bp_args/bp_cmd.h"
 #include "bytecode.h"
 #include "mode/hwuart.h"
+#include "pirate/hwuart_rx.h"
 #include "usb_rx.h"
 #include "usb_tx.h"
 
@@ -34,6 +35,7 @@ void nmea_decode_handler(struct command_result* res) {
     if (!ui_help_check_vout_vref()) {
         return;
     }
+    hwuart_rx_stop(); // read the UART directly, async print picks it up again after
 
     printf("%s%s%s\r\n%s",
            ui_term_color_notice(),
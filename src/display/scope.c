@@ -35,6 +35,9 @@
 #include "hardware/adc.h"
 #include "hardware/irq.h"
 #include "hardware/spi.h"
+#include "hardware/sync.h"
+#include "tusb.h"
+#include "usb_tx.h"
 #include "font/font.h"
 // #include "font/hunter-23pt-24h24w.h"
 // #include "font/hunter-20pt-21h21w.h"
@@ -50,12 +53,17 @@ extern const FONT_INFO hunter_12ptFontInfo;
 #include "ui/ui_cmdln.h"
 #include "usb_rx.h"
 #include "pirate/amux.h"
+#include "pirate/lcd_blit.h"
+#include "display/scope.h"
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
 
 static int convert_trigger_position(int pos);
 
 #define VS 240
 #define HS 320
-const uint32_t V5 = 0x0c05; // 5V
+const uint32_t V5 = SCOPE_COUNTS_5V; // 5V
 
 #define CAPTURE_DEPTH 64
 #define BUFFERS (5 * 10 * 2 + 1) // 320x10 = standard samples rate (10 samples/pixel) 4x screen width
@@ -65,6 +73,13 @@ static volatile uint32_t sample_first = 0, sample_last = BUFFERS * CAPTURE_DEPTH
 static uint32_t display_sample_first = 0, display_sample_last = BUFFERS * CAPTURE_DEPTH - 1;
 static volatile uint16_t* capture_buffer = 0;
 static uint16_t* display_buffer = 0;
+// min/max of each CAPTURE_DEPTH block, filled in the DMA IRQ and swapped with the buffers
+typedef struct {
+    uint16_t min, max;
+} scope_block_t;
+static scope_block_t block_summary[2][BUFFERS];
+static scope_block_t* capture_blocks = block_summary[0];
+static scope_block_t* display_blocks = block_summary[1];
 static int offset = 0;
 static uint dma_chan;
 static volatile unsigned short stop_capture;
@@ -114,6 +129,23 @@ static uint16_t samples = 1; // samples/pixel at the current timebase
 static uint16_t xoffset = 0; // x offset in dy units
 static bool auto_wakeup_triggered = 0;
 
+// displayed frame for the remote interfaces, frame_seq is odd while switch_buffers() replaces it
+static volatile uint32_t frame_seq = 0;
+static uint32_t frame_sample_rate;
+static int32_t frame_trigger_index = -1;
+
+// binary frame stream on the binary USB port, serviced from scope_lcd_update() on core1,
+// the binmode is paused while the stream has the port
+#define SCOPE_STREAM_HEADER 24
+static struct {
+    bool enabled;
+    uint32_t sent_seq; // last frame_seq streamed
+    uint32_t pos;      // bytes of the frame sent, 0 when idle
+    uint32_t len;      // frame length in bytes
+    uint32_t last_us;  // last time the host accepted data
+    uint8_t header[SCOPE_STREAM_HEADER];
+} stream;
+
 // b0   RRRr rGGG
 // b1   gggB BBbb
 unsigned short clr[] = {
@@ -190,6 +222,7 @@ void scope_help(void) {
     printf("	a - auto\r\n");
     printf("\r\n");
     printf("ss - stop - button if running\r\n");
+    printf("sb - binary frame stream on the binary USB port on/off\r\n");
 }
 
 void scope_cleanup(void) {
@@ -198,6 +231,8 @@ void scope_cleanup(void) {
         scope_shutdown(1);
     }
     scope_subsystem_stopped = 1;
+    stream.enabled = false;
+    system_config.binmode_usb_paused = false;
     mem_free(fb);
     fb = 0;
     capture_buffer = 0;
@@ -262,6 +297,59 @@ uint32_t scope_setup_exc(void) {
     return 1;
 }
 
+// min and max of a completed block for the trigger search and the trace renderer
+static void scope_block_summarize(const uint16_t* block, scope_block_t* s) {
+    const uint32_t* w = (const uint32_t*)block; // blocks are CAPTURE_DEPTH * 2 byte aligned
+#if defined(__ARM_FEATURE_SIMD32)
+    // two samples per word, USUB16 sets the GE flags per half word and SEL picks per half word
+    uint32_t lo = 0xffffffff, hi = 0;
+    for (int i = 0; i < CAPTURE_DEPTH / 2; i++) {
+        uint32_t v = w[i];
+        __usub16(v, lo);
+        lo = __sel(lo, v);
+        __usub16(v, hi);
+        hi = __sel(v, hi);
+    }
+    uint16_t lo0 = lo & 0xffff, lo1 = lo >> 16, hi0 = hi & 0xffff, hi1 = hi >> 16;
+    s->min = lo0 < lo1 ? lo0 : lo1;
+    s->max = hi0 > hi1 ? hi0 : hi1;
+#else
+    // one load per two samples
+    uint16_t lo = 0xffff, hi = 0;
+    for (int i = 0; i < CAPTURE_DEPTH / 2; i++) {
+        uint32_t v = w[i];
+        uint16_t a = v & 0xffff, b = v >> 16;
+        if (a > b) {
+            uint16_t t = a;
+            a = b;
+            b = t;
+        }
+        if (a < lo) {
+            lo = a;
+        }
+        if (b > hi) {
+            hi = b;
+        }
+    }
+    s->min = lo;
+    s->max = hi;
+#endif
+}
+
+// can the samples from last_value through this block cross the trigger level?
+static bool scope_block_may_trigger(const scope_block_t* s) {
+    uint16_t lo = s->min < last_value ? s->min : last_value;
+    uint16_t hi = s->max > last_value ? s->max : last_value;
+    if (search_rising) {
+        return lo <= trigger_level && s->max > trigger_level;
+    } else if (search_falling) {
+        return hi >= trigger_level && s->min < trigger_level;
+    } else if (search_either) {
+        return (hi >= trigger_level && s->min < trigger_level) || (lo < trigger_level && s->max > trigger_level);
+    }
+    return false;
+}
+
 static void dma_handler(void) {
     int last_offset = offset;
 
@@ -274,6 +362,7 @@ static void dma_handler(void) {
         dma_channel_set_irq0_enabled(dma_chan, false);
         adc_run(false);
         dma_channel_abort(dma_chan);
+        scope_block_summarize((const uint16_t*)&capture_buffer[last_offset], &capture_blocks[last_offset / CAPTURE_DEPTH]);
         stop_capture = 0;
         scope_running = 0;
         scope_stop_waiting = 1;
@@ -288,6 +377,8 @@ static void dma_handler(void) {
         offset = 0;
     }
     dma_channel_set_write_addr(dma_chan, &capture_buffer[offset], true);
+    // the ADC FIFO is only a few samples deep, summarize once the next block is armed
+    scope_block_summarize((const uint16_t*)&capture_buffer[last_offset], &capture_blocks[last_offset / CAPTURE_DEPTH]);
     if (stop_capture) {
         stop_capture--;
     }
@@ -308,7 +399,10 @@ static void dma_handler(void) {
             }
             return;
         }
-        if (search_rising) {
+        if (!scope_block_may_trigger(&capture_blocks[last_offset / CAPTURE_DEPTH])) {
+            // no crossing possible, skip the sample by sample search
+            last_value = capture_buffer[last_offset + CAPTURE_DEPTH - 1];
+        } else if (search_rising) {
             unsigned short v, *tp = (unsigned short*)&capture_buffer[last_offset];
             for (int i = 0; i < CAPTURE_DEPTH; i++) {
                 v = *tp++;
@@ -669,7 +763,7 @@ uint32_t scope_commands(struct command_result* result) {
     char args[5];
     cmdln_args_string_by_position(0, sizeof(args), args);
     if (!(args[0] == 'x' || args[0] == 'y' || args[0] == 't' || (args[0] == 's' && args[1] == 'r') ||
-          (args[0] == 's' && args[1] == 's'))) {
+          (args[0] == 's' && args[1] == 's') || (args[0] == 's' && args[1] == 'b'))) {
         return 0;
     }
 
@@ -1290,6 +1384,16 @@ uint32_t scope_commands(struct command_result* result) {
         scope_shutdown(1);
         no_switch = 1;
         system_config.info_bar_changed = 1;
+    } else if (strcmp(args, "sb") == 0) {
+        // stream frames on the binary USB port
+        // the binmode writes the same port, only take it while nothing is going either way
+        if (!stream.enabled && (bin_tx_not_empty() || tud_cdc_n_available(1))) {
+            printf("Binary USB port busy, try again\r\n");
+            return 1;
+        }
+        stream.enabled = !stream.enabled;
+        system_config.binmode_usb_paused = stream.enabled;
+        printf("Binary USB frame stream %s\r\n", stream.enabled ? "on" : "off");
     } else {
         return 0;
     }
@@ -1406,9 +1510,69 @@ static void draw_text(int x, int y, const FONT_INFO* font, CLR c, char* cp) // s
     }
 }
 
+// screen row for a sample, -1 below and VS above the screen
+static int scope_sample_to_y(uint32_t y, int df) {
+    int d = (y * VS * 100 / V5 / dy) - df;
+    if (d < 0) {
+        d = -1;
+    } else {
+        if (d >= VS) {
+            d = VS;
+        }
+    }
+    return d;
+}
+
+// Min and max of n display samples from *offset, stopping at display_sample_last.
+// Whole blocks come from the block summary, so zoomed out views don't walk
+// every sample. Returns true if display_sample_last was reached.
+static bool scope_column_minmax(uint32_t* offset, uint32_t n, uint16_t* lo, uint16_t* hi) {
+    uint32_t o = *offset;
+    uint16_t mn = 0xffff, mx = 0;
+    bool last = false;
+    while (n) {
+        uint32_t blk = o / CAPTURE_DEPTH;
+        if ((o % CAPTURE_DEPTH) == 0 && n >= CAPTURE_DEPTH &&
+            (display_sample_last / CAPTURE_DEPTH != blk || display_sample_last == o + CAPTURE_DEPTH - 1)) {
+            if (display_blocks[blk].min < mn) {
+                mn = display_blocks[blk].min;
+            }
+            if (display_blocks[blk].max > mx) {
+                mx = display_blocks[blk].max;
+            }
+            if (display_sample_last == o + CAPTURE_DEPTH - 1) {
+                last = true;
+                break;
+            }
+            o += CAPTURE_DEPTH;
+            n -= CAPTURE_DEPTH;
+        } else {
+            uint16_t v = display_buffer[o];
+            if (v < mn) {
+                mn = v;
+            }
+            if (v > mx) {
+                mx = v;
+            }
+            if (o == display_sample_last) {
+                last = true;
+                break;
+            }
+            o++;
+            n--;
+        }
+        if (o >= (BUFFERS * CAPTURE_DEPTH)) {
+            o = 0;
+        }
+    }
+    *offset = o;
+    *lo = mn;
+    *hi = mx;
+    return last;
+}
+
 static void draw_trace(CLR c) {
     unsigned char* p = &fb[0];
-    uint16_t* b = (uint16_t*)&display_buffer[0]; // only called when not volatile
     int16_t v1[HS];
     int16_t v2[HS];
     int x;
@@ -1421,7 +1585,6 @@ static void draw_trace(CLR c) {
     if (offset >= (BUFFERS * CAPTURE_DEPTH)) {
         offset -= BUFFERS * CAPTURE_DEPTH;
     }
-    b += offset;
     int xlast = HS;
     if (display_sample_first <= display_sample_last) {
         if (offset > display_sample_last || offset < display_sample_first) {
@@ -1433,41 +1596,16 @@ static void draw_trace(CLR c) {
         }
     }
     for (x = 0; x < HS;) {
-        for (int i = 0; i < display_samples; i++) {
-            uint32_t y = *b++;
-
-            int d = (y * VS * 100 / V5 / dy) - df;
-            if (d < 0) {
-                d = -1;
-            } else {
-                if (d >= VS) {
-                    d = VS;
-                }
-            }
-            if (i == 0) {
-                v1[x] = d;
-                v2[x] = d;
-            } else {
-                if (d < v1[x]) {
-                    v1[x] = d;
-                }
-                if (d > v2[x]) {
-                    v2[x] = d;
-                }
-            }
-            if (offset == display_sample_last) {
-                x += display_zoom;
-                goto xdone;
-            }
-            offset++;
-            if (offset >= (BUFFERS * CAPTURE_DEPTH)) {
-                offset = 0;
-                b = (uint16_t*)&display_buffer[0];
-            }
-        }
+        uint16_t lo, hi;
+        bool last = scope_column_minmax(&offset, display_samples, &lo, &hi);
+        // sample to row is monotonic, the column extremes map to the row extremes
+        v1[x] = scope_sample_to_y(lo, df);
+        v2[x] = scope_sample_to_y(hi, df);
         x += display_zoom;
+        if (last) {
+            break;
+        }
     }
-xdone:
     xlast = x;
     y1 = v1[0];
     y2 = v2[0];
@@ -2061,14 +2199,14 @@ static void scope_write() {
     gpio_put(DISPLAY_DP, 1);
     gpio_put(DISPLAY_CS, 0);
 
-    for (uint32_t b = 0; b < (HS * VS / 2); b += 1) {
-        unsigned char x = fb[b];
-        spi_write_blocking(BP_SPI_PORT, (unsigned char*)&clr[x & 0xf], 2);
-        spi_write_blocking(BP_SPI_PORT, (unsigned char*)&clr[(x >> 4) & 0xf], 2);
-    }
+    // expand the 4 bit framebuffer a line at a time while DMA sends the previous line
+    lcd_blit_start();
+    lcd_blit_4bpp(fb, HS * VS, clr);
+    lcd_blit_end();
 
     gpio_put(DISPLAY_CS, 1);
     spi_busy_wait(false);
+    lcd_shadow_invalidate();
 }
 
 static int64_t auto_wakeup(alarm_id_t id, void* user_data) {
@@ -2081,9 +2219,16 @@ static void switch_buffers(void) {
     if (no_switch) {
         no_switch = 0;
     } else {
+        frame_seq++; // odd: remote readers retry
+        __dmb();
+        frame_sample_rate = timebase * samples / zoom;
+        frame_trigger_index = triggered ? trigger_offset : -1;
         x = display_buffer;
         display_buffer = (uint16_t*)capture_buffer;
         capture_buffer = x;
+        scope_block_t* s = display_blocks;
+        display_blocks = capture_blocks;
+        capture_blocks = s;
         display_sample_first = sample_first;
         display_sample_last = sample_last;
         display_zoom = zoom;
@@ -2286,13 +2431,181 @@ static void switch_buffers(void) {
             display_trigger_position = trigger_position;
         }
         caught = 1;
+        __dmb();
+        frame_seq++;
+    }
+}
+
+static uint32_t scope_frame_samples(void) {
+    if (display_sample_last >= display_sample_first) {
+        return display_sample_last - display_sample_first + 1;
+    }
+    return display_sample_last + (BUFFERS * CAPTURE_DEPTH) - display_sample_first + 1;
+}
+
+bool scope_frame_get_info(scope_frame_info_t* info) {
+    uint32_t seq = frame_seq;
+    __dmb();
+    if (scope_subsystem_stopped || !caught || (seq & 1)) {
+        return false;
+    }
+    info->sequence = seq >> 1;
+    info->samples = scope_frame_samples();
+    info->trigger_index = frame_trigger_index;
+    info->sample_rate_hz = frame_sample_rate;
+    info->trigger_level_mv = (trigger_level * 5000) / V5;
+    info->trigger_type = trigger_type;
+    info->pin = scope_pin;
+    info->running = !scope_stopped;
+    __dmb();
+    return seq == frame_seq;
+}
+
+uint32_t scope_frame_pack(uint32_t first, uint32_t count, uint8_t* out) {
+    uint32_t o = display_sample_first + first;
+    if (o >= (BUFFERS * CAPTURE_DEPTH)) {
+        o -= BUFFERS * CAPTURE_DEPTH;
+    }
+    uint32_t len = 0;
+    for (uint32_t i = 0; i < count; i += 2) {
+        uint16_t a = display_buffer[o] & 0xfff;
+        if (++o >= (BUFFERS * CAPTURE_DEPTH)) {
+            o = 0;
+        }
+        out[len++] = a;
+        if (i + 1 == count) {
+            out[len++] = a >> 8;
+            break;
+        }
+        uint16_t b = display_buffer[o] & 0xfff;
+        if (++o >= (BUFFERS * CAPTURE_DEPTH)) {
+            o = 0;
+        }
+        out[len++] = (a >> 8) | (b << 4);
+        out[len++] = b >> 4;
+    }
+    return len;
+}
+
+bool scope_frame_read(uint32_t sequence, uint32_t first, uint32_t count, uint8_t* out) {
+    uint32_t seq = frame_seq;
+    __dmb();
+    if ((seq & 1) || (seq >> 1) != sequence || first + count > scope_frame_samples()) {
+        return false;
+    }
+    scope_frame_pack(first, count, out);
+    __dmb();
+    return seq == frame_seq; // replaced while packing, the host asks again
+}
+
+bool scope_remote_run(int pin, uint8_t mode) {
+    if (scope_subsystem_stopped) {
+        return false;
+    }
+    if (pin >= 0 && pin < 8) {
+        scope_pin = pin;
+    }
+    if (mode <= SMODE_AUTO) {
+        scope_mode = mode;
+    }
+    scope_stopped = 0;
+    scope_restart(scope_pin);
+    return true;
+}
+
+bool scope_remote_stop(void) {
+    if (scope_subsystem_stopped) {
+        return false;
+    }
+    scope_stopped = 1;
+    scope_shutdown(1);
+    no_switch = 1;
+    system_config.info_bar_changed = 1;
+    return true;
+}
+
+static void put_le(uint8_t* p, uint32_t v, uint8_t bytes) {
+    while (bytes--) {
+        *p++ = v;
+        v >>= 8;
+    }
+}
+
+// Send the displayed frame on the binary USB port a piece at a time.
+// Returns true while a frame is in flight, the caller holds the frame until it is sent.
+static bool scope_stream_service(void) {
+    if (!stream.enabled) {
+        stream.pos = 0;
+        return false;
+    }
+    if (stream.pos == 0) {
+        if (!caught || frame_seq == stream.sent_seq || !tud_cdc_n_connected(1)) {
+            return false;
+        }
+        scope_frame_info_t info;
+        scope_frame_get_info(&info); // core1 owns switch_buffers(), can't change under us
+        memcpy(stream.header, "BPSC", 4);
+        put_le(&stream.header[4], info.sequence, 4);
+        put_le(&stream.header[8], info.samples, 4);
+        put_le(&stream.header[12], (uint32_t)info.trigger_index, 4);
+        put_le(&stream.header[16], info.sample_rate_hz, 4);
+        put_le(&stream.header[20], info.trigger_level_mv, 2);
+        stream.header[22] = info.trigger_type;
+        stream.header[23] = info.pin;
+        stream.len = SCOPE_STREAM_HEADER + (info.samples * 3 + 1) / 2;
+        stream.sent_seq = frame_seq;
+        stream.last_us = time_us_32();
     }
+
+    uint32_t avail = tud_cdc_n_write_available(1);
+    while (avail && stream.pos < stream.len) {
+        uint8_t buf[48];
+        uint32_t n;
+        if (stream.pos < SCOPE_STREAM_HEADER) {
+            n = SCOPE_STREAM_HEADER - stream.pos;
+            if (n > avail) {
+                n = avail;
+            }
+            memcpy(buf, &stream.header[stream.pos], n);
+        } else {
+            // whole 3 byte sample pairs, or the 2 byte odd sample at the end
+            uint32_t p = stream.pos - SCOPE_STREAM_HEADER;
+            uint32_t first = (p / 3) * 2;
+            uint32_t count = (avail < sizeof(buf) ? avail : sizeof(buf)) / 3 * 2;
+            uint32_t left = scope_frame_samples() - first;
+            if (count >= left) {
+                count = left;
+            }
+            if (count == 0) {
+                break;
+            }
+            n = scope_frame_pack(first, count, buf);
+        }
+        tud_cdc_n_write(1, buf, n);
+        stream.pos += n;
+        avail -= n;
+        stream.last_us = time_us_32();
+    }
+    tud_cdc_n_write_flush(1);
+
+    if (stream.pos >= stream.len) {
+        stream.pos = 0;
+        return false;
+    }
+    if (time_us_32() - stream.last_us > 250000) {
+        stream.pos = 0; // host stopped reading, it resyncs on the next BPSC header
+        return false;
+    }
+    return true;
 }
 
 void scope_lcd_update(uint32_t flags) {
     if (scope_subsystem_stopped) {
         return;
     }
+    if (scope_stream_service()) {
+        return; // finish streaming the frame before it can be replaced
+    }
     if (!scope_running) {
         if (scope_stop_waiting) {
             scope_stop_waiting = 0;
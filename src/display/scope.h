@@ -10,4 +10,29 @@ void scope_periodic(void);
 void scope_lcd_update(uint32_t flags);
 extern volatile uint8_t scope_running;
 
+// Displayed scope frame for hosts (BPIO ScopeRequest, sb binary stream)
+#define SCOPE_COUNTS_5V 0x0c05 // ADC counts at 5V on the scope input
+
+typedef struct scope_frame_info {
+    uint32_t sequence;         // new frame number, changes when the display gets a new capture
+    uint32_t samples;          // samples in the frame
+    int32_t trigger_index;     // sample index of the trigger point, -1 if not triggered
+    uint32_t sample_rate_hz;   // capture sample rate
+    uint32_t trigger_level_mv; // trigger level
+    uint8_t trigger_type;      // 0 rising, 1 falling, 2 none, 3 either
+    uint8_t pin;               // IO pin
+    bool running;              // capturing more frames
+} scope_frame_info_t;
+
+// false if the scope has no frame yet or is replacing it, try again
+bool scope_frame_get_info(scope_frame_info_t* info);
+// pack count samples from first as 12 bit little endian pairs (3 bytes per 2 samples)
+uint32_t scope_frame_pack(uint32_t first, uint32_t count, uint8_t* out);
+// scope_frame_pack() from any core, false if the frame is not sequence (any more)
+bool scope_frame_read(uint32_t sequence, uint32_t first, uint32_t count, uint8_t* out);
+// start capturing, pin -1 and mode 0xff keep the current setting. mode 0 once, 1 normal, 2 auto
+// false if the scope display is not active
+bool scope_remote_run(int pin, uint8_t mode);
+bool scope_remote_stop(void);
+
 #endif
@@ -145,6 +145,10 @@ void hw2wire_tick_clock(struct _bytecode* result, struct _bytecode* next) {
     pio_hw2wire_clock_tick();
 }
 
+uint32_t hw2wire_pin_sequence(const struct _bytecode* code, uint32_t count) {
+    return pio_hw2wire_pin_sequence(code, count);
+}
+
 void hw2wire_set_clk_high(struct _bytecode* result, struct _bytecode* next) {
     pio_hw2wire_set_mask(1 << M_2WIRE_SCL, 1 << M_2WIRE_SCL);
     result->out_data = 1;
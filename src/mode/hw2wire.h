@@ -16,6 +16,7 @@ void hw2wire_set_clk_low(struct _bytecode* result, struct _bytecode* next);
 void hw2wire_set_dat_high(struct _bytecode* result, struct _bytecode* next);
 void hw2wire_set_dat_low(struct _bytecode* result, struct _bytecode* next);
 void hw2wire_read_bit(struct _bytecode* result, struct _bytecode* next);
+uint32_t hw2wire_pin_sequence(const struct _bytecode* code, uint32_t count);
 void hw2wire_macro(uint32_t macro);
 uint32_t hw2wire_setup(void);
 uint32_t hw2wire_setup_exc(void);
@@ -202,6 +202,10 @@ void hw3wire_tick_clock(struct _bytecode* result, struct _bytecode* next) {
     pio_hw3wire_clock_tick();
 }
 
+uint32_t hw3wire_pin_sequence(const struct _bytecode* code, uint32_t count) {
+    return pio_hw3wire_pin_sequence(code, count);
+}
+
 void hw3wire_set_clk_high(struct _bytecode* result, struct _bytecode* next) {
     pio_hw3wire_set_mask(0b10, 0b10);
     result->out_data = 1;
@@ -300,6 +300,20 @@ void hwi2c_settings(void) {
     //        (i2c_mode_config.clock_stretch ? GET_T(T_ON) : GET_T(T_OFF)));
     ui_help_setting_string(GET_T(T_HWI2C_CLOCK_STRETCH_MENU),
             (i2c_mode_config.clock_stretch ? GET_T(T_ON) : GET_T(T_OFF)), 0x00);
+
+    // bus use of the last array transfer, the rest is time between bytes
+    struct pio_i2c_bus_stats bus;
+    pio_i2c_get_bus_stats(&bus);
+    if (bus.bytes && bus.us) {
+        uint32_t percent = (uint32_t)(((uint64_t)bus.ideal_us * 100) / bus.us);
+        printf(" %s%s%s: %lu%% (%lu bytes, %luus)\r\n",
+               ui_term_color_info(),
+               GET_T(T_HWI2C_BUS_USE),
+               ui_term_color_reset(),
+               percent > 100 ? 100 : percent,
+               bus.bytes,
+               bus.us);
+    }
 }
 
 void hwi2c_help(void) {
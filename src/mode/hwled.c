@@ -13,6 +13,7 @@
 #include "ws2812.pio.h"
 #include "apa102.pio.h"
 #include "pirate/rgb.h"
+#include "pirate/led_frame.h"
 #include "pirate/storage.h"
 #include "ui/ui_term.h"
 #include "ui/ui_help.h"
@@ -280,6 +281,7 @@ bool hwled_preflight_sanity_check(void){
 }
 
 void hwled_start(struct _bytecode* result, struct _bytecode* next) {
+    led_frame_wait();
     led_devices[hwled_mode_config.device].start();
     result->data_message = GET_T(led_devices[hwled_mode_config.device].data_message_start);
 }
@@ -305,6 +307,7 @@ void hwled_write(struct _bytecode* result, struct _bytecode* next) {
     //       As a hack, callers can likely use RGBW by packing
     //       three pixels' data into four 24-bit values:
     //       0x00R1G1B1 0x00W1R2G2 0x00B2W2R3 0x00G3B3W3
+    led_frame_wait();
     led_devices[hwled_mode_config.device].write(result->out_data);
 }
 
@@ -320,6 +323,7 @@ void hwled_macro(uint32_t macro) {
 }
 
 void hwled_cleanup(void) {
+    led_frame_stop();
     led_devices[device_cleanup].cleanup();
     system_config.subprotocol_name = 0x00;
     system_config.num_bits = 8;
@@ -358,3 +362,16 @@ bool hwled_bpio_configure(bpio_mode_configuration_t *bpio_mode_config) {
     
     return true;
 }
+
+bool hwled_frame_start(void) {
+    switch (hwled_mode_config.device) {
+        case M_LED_WS2812:
+            led_frame_start(pio_config.pio, pio_config.sm, LED_FRAME_WS2812);
+            return true;
+        case M_LED_APA102:
+            led_frame_start(pio_config.pio, pio_config.sm, LED_FRAME_APA102);
+            return true;
+        default:
+            return false; // the onboard LEDs belong to the RGB driver
+    }
+}
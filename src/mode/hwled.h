@@ -19,6 +19,7 @@ uint32_t hwled_get_speed(void);
 void hwled_wait_idle(void);
 bool hwled_preflight_sanity_check(void);
 bool hwled_bpio_configure(bpio_mode_configuration_t *bpio_mode_config);
+bool hwled_frame_start(void);
 
 enum M_LED_DEVICE_TYPE {
     M_LED_WS2812,
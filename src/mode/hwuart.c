@@ -43,9 +43,13 @@
 #include "commands/uart/monitor.h"
 #include "commands/uart/glitch.h"
 #include "lib/bp_args/bp_cmd.h"
+#include "pirate/hwuart_rx.h"
 
 static struct _uart_mode_config mode_config;
 static struct command_attributes periodic_attributes;
+static bool rx_ring_unavailable; // UART interrupt in use, poll the FIFO
+static bool async_first;         // no byte printed since async print started
+static uint32_t async_last_us;
 
 bool bpio_hwuart_configure(bpio_mode_configuration_t *bpio_mode_config){
     if(bpio_mode_config->debug) printf("[UART] Configuring - Speed %d baud, %d%c%d\r\n", 
@@ -62,6 +66,8 @@ bool bpio_hwuart_configure(bpio_mode_configuration_t *bpio_mode_config){
     mode_config.invert = bpio_mode_config->signal_inversion ? 1 : 0;
     mode_config.async_print = false; // Disabled by default, async data handled via BPIO packets
     mode_config.blocking = 0; // Non-blocking
+    mode_config.rx_gap_us = 0;
+    mode_config.rx_timestamps = false;
     
     return true;  
 }
@@ -162,6 +168,13 @@ static const bp_val_constraint_t uart_invert_choice = {
     .prompt = T_UART_INVERT_MENU,
 };
 
+// Async print packet gap — flag -g / --gap (us, 0 = off)
+static const bp_val_constraint_t uart_gap_range = {
+    .type = BP_VAL_UINT32,
+    .u = { .min = 0, .max = 10000000, .def = 0 },
+    .prompt = T_UART_RX_GAP,
+};
+
 static const bp_command_opt_t uart_setup_opts[] = {
     { "baud",     'b', BP_ARG_REQUIRED, "1-7372800",     0, &uart_baud_range },
     { "databits", 'd', BP_ARG_REQUIRED, "5-8",           0, &uart_databits_range },
@@ -169,6 +182,8 @@ static const bp_command_opt_t uart_setup_opts[] = {
     { "stopbits", 's', BP_ARG_REQUIRED, "1|2",           0, &uart_stopbits_choice },
     { "flow",     'f', BP_ARG_REQUIRED, "off|rts",       0, &uart_flow_choice },
     { "invert",   'i', BP_ARG_REQUIRED, "normal|invert", 0, &uart_invert_choice },
+    { "gap",      'g', BP_ARG_REQUIRED, "us",            T_UART_RX_GAP, &uart_gap_range },
+    { "time",     't', BP_ARG_NONE,     NULL,            T_UART_RX_TIMESTAMPS },
     { 0 },
 };
 
@@ -202,6 +217,11 @@ uint32_t hwuart_setup(void) {
         // clang-format off
     };
 
+    // async print framing, command line only
+    mode_config.rx_gap_us = 0;
+    mode_config.rx_timestamps = bp_cmd_find_flag(&uart_setup_def, 't');
+    if (bp_cmd_flag(&uart_setup_def, 'g', &mode_config.rx_gap_us) == BP_CMD_INVALID) return 0;
+
     // Check if any flag is present — if so, command-line mode; otherwise wizard
     bp_cmd_status_t st = bp_cmd_flag(&uart_setup_def, 'b', &mode_config.baudrate);
     if (st == BP_CMD_INVALID) return 0;
@@ -329,17 +349,57 @@ bool hwuart_preflight_sanity_check(void){
     return ui_help_sanity_check(true, 0x00);
 }
 
+static inline uint8_t hwuart_bits_per_char(void) {
+    return 1 + mode_config.data_bits + (mode_config.parity != UART_PARITY_NONE) + mode_config.stop_bits;
+}
+
+// start the interrupt fed RX ring for async printing, once per async start
+static void hwuart_rx_ring_start(void) {
+    if (hwuart_rx_active() || rx_ring_unavailable) {
+        return;
+    }
+    rx_ring_unavailable = !hwuart_rx_start(mode_config.baudrate_actual, hwuart_bits_per_char(), mode_config.flow_control);
+}
+
+static void hwuart_async_print(uint32_t c, uint32_t timestamp_us) {
+    uint32_t gap_us = timestamp_us - async_last_us;
+    bool new_packet = !async_first && mode_config.rx_gap_us && gap_us > mode_config.rx_gap_us;
+    if (new_packet) {
+        printf("\r\n");
+    }
+    // with framing the time is shown once per packet, otherwise for every byte
+    if (mode_config.rx_timestamps && (async_first || new_packet || !mode_config.rx_gap_us)) {
+        printf("%s+%luus%s ", ui_term_color_info(), async_first ? 0 : gap_us, ui_term_color_reset());
+    }
+    async_first = false;
+    async_last_us = timestamp_us;
+    ui_format_print_number_2(&periodic_attributes, &c);
+}
+
 void hwuart_periodic(void) {
-    if (mode_config.async_print && uart_is_readable(M_UART_PORT)) {
-        // printf("ASYNC: %d\r\n", uart_getc(M_UART_PORT));
+    if (!mode_config.async_print) {
+        return;
+    }
+    hwuart_rx_ring_start(); // restarts after a command (bridge etc) took the UART
+    if (hwuart_rx_active()) {
+        uint8_t c;
+        uint32_t timestamp_us;
+        // a few per pass, the ring holds the rest while they print
+        for (uint8_t i = 0; i < 16 && hwuart_rx_get(&c, &timestamp_us); i++) {
+            hwuart_async_print(c, timestamp_us);
+        }
+        return;
+    }
+    if (uart_is_readable(M_UART_PORT)) {
         if(mode_config.flow_control) bio_put(M_UART_RTS, 0);
         uint32_t temp = uart_getc(M_UART_PORT);
         if(mode_config.flow_control) bio_put(M_UART_RTS, 1);
-        ui_format_print_number_2(&periodic_attributes, &temp);
+        hwuart_async_print(temp, time_us_32());
     }
 }
 
 void hwuart_open(struct _bytecode* result, struct _bytecode* next) {    
+    hwuart_rx_stop();
     // clear FIFO and enable UART
     if(mode_config.flow_control) bio_put(M_UART_RTS, 0);
     while (uart_is_readable(M_UART_PORT)) {
@@ -353,11 +413,15 @@ void hwuart_open(struct _bytecode* result, struct _bytecode* next) {
 
 void hwuart_open_read(struct _bytecode* result, struct _bytecode* next) { // start with read
     mode_config.async_print = true;
+    async_first = true;
+    rx_ring_unavailable = false;
+    hwuart_rx_ring_start();
     result->data_message = GET_T(T_UART_OPEN_WITH_READ);
 }
 
 void hwuart_close(struct _bytecode* result, struct _bytecode* next) {
     mode_config.async_print = false;
+    hwuart_rx_stop();
     result->data_message = GET_T(T_UART_CLOSE);
 }
 
@@ -370,18 +434,34 @@ void hwuart_write(struct _bytecode* result, struct _bytecode* next) {
 }
 
 void hwuart_read(struct _bytecode* result, struct _bytecode* next) {
-    uint32_t timeout = 0xfff;
-
-    while (!uart_is_readable(M_UART_PORT)) {
-        timeout--;
-        if (!timeout) {
-            result->error = SERR_ERROR;
-            result->error_message = GET_T(T_UART_NO_DATA_READ);
-            return;
+    // wait up to 10 character times for the byte to arrive
+    uint32_t timeout_us = mode_config.baudrate_actual ? ((uint32_t)hwuart_bits_per_char() * 10 * 1000000u) / mode_config.baudrate_actual : 0;
+    if (timeout_us < 100) {
+        timeout_us = 100;
+    }
+
+    if (hwuart_rx_active()) {
+        uint8_t c;
+        absolute_time_t deadline = make_timeout_time_us(timeout_us);
+        while (!hwuart_rx_get(&c, NULL)) {
+            if (time_reached(deadline)) {
+                result->error = SERR_ERROR;
+                result->error_message = GET_T(T_UART_NO_DATA_READ);
+                return;
+            }
         }
+        result->in_data = c;
+        return;
     }
 
     if(mode_config.flow_control) bio_put(M_UART_RTS, 0);
+    if (!uart_is_readable_within_us(M_UART_PORT, timeout_us)) {
+        if(mode_config.flow_control) bio_put(M_UART_RTS, 1);
+        result->error = SERR_ERROR;
+        result->error_message = GET_T(T_UART_NO_DATA_READ);
+        return;
+    }
+
     if (uart_is_readable(M_UART_PORT)) {
         result->in_data = uart_getc(M_UART_PORT);
     } else {
@@ -407,6 +487,8 @@ void hwuart_macro(uint32_t macro) {
 }
 
 void hwuart_cleanup(void) {
+    hwuart_rx_stop();
+    mode_config.async_print = false;
     // disable peripheral
     uart_deinit(M_UART_PORT);
     system_bio_update_purpose_and_label(false, M_UART_TX, BP_PIN_MODE, 0);
@@ -431,6 +513,27 @@ void hwuart_settings(void) {
             !mode_config.flow_control ? GET_T(T_UART_FLOW_CONTROL_MENU_1) : GET_T(T_UART_FLOW_CONTROL_MENU_2), 0x00);
     ui_help_setting_string(GET_T(T_UART_INVERT_MENU),
             !mode_config.invert ? GET_T(T_UART_INVERT_MENU_1) : GET_T(T_UART_INVERT_MENU_2), 0x00);
+    if (mode_config.rx_gap_us) {
+        ui_help_setting_int(GET_T(T_UART_RX_GAP), mode_config.rx_gap_us, "us");
+    }
+    if (mode_config.rx_timestamps) {
+        ui_help_setting_string(GET_T(T_UART_RX_TIMESTAMPS), GET_T(T_ON), 0x00);
+    }
+
+    // RX ring of the last async print session
+    struct hwuart_rx_stats rx;
+    hwuart_rx_get_stats(&rx);
+    if (rx.bytes || rx.overruns || rx.dropped) {
+        printf(" %s%s%s: %lu bytes, %lu FIFO overruns, %lu dropped, %lu errors, max %lu waiting\r\n",
+               ui_term_color_info(),
+               GET_T(T_UART_RX_RING),
+               ui_term_color_reset(),
+               rx.bytes,
+               rx.overruns,
+               rx.dropped,
+               rx.errors,
+               rx.max_fill);
+    }
 }
 
 void hwuart_printerror(void) {
@@ -20,6 +20,8 @@ typedef struct _uart_mode_config {
     bool async_print;          ///< Enable automatic printing of received data
     uint32_t flow_control;     ///< Hardware flow control (0=disabled, 1=RTS/CTS)
     uint32_t invert;           ///< Signal inversion (0=normal, 1=inverted)
+    uint32_t rx_gap_us;        ///< Async print starts a new line after this much idle (0=off)
+    bool rx_timestamps;        ///< Async print shows the time since the previous byte/packet
 } _uart_mode_config;
 
 /**
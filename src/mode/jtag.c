@@ -15,6 +15,8 @@
 #include "pirate/hwspi.h"
 #include "usb_rx.h"
 #include "commands/jtag/bluetag.h"
+#include "pirate/jtag_pio.h"
+#include "mode/jtag.h"
 
 // command configuration
 const struct _mode_command_struct jtag_commands[] = {
@@ -28,7 +30,10 @@ const uint32_t jtag_commands_count = count_of(jtag_commands);
 
 static const char pin_labels[][5] = { "TRST", "SRST", "TCK", "TDI", "TDO", "TMS" };
 
-//static struct _spi_mode_config mode_config;
+static struct {
+    uint32_t speed; // TCK Hz
+    bool swd;
+} mode_config = { .speed = 1000000 };
 
 uint32_t jtag_setup(void) {
  
@@ -46,6 +51,7 @@ uint32_t jtag_setup_exc(void) {
 }
 
 void jtag_cleanup(void) {
+    jtag_pio_stop();
     // release pin claims
     system_bio_update_purpose_and_label(false, BIO2, BP_PIN_MODE, 0);
     system_bio_update_purpose_and_label(false, BIO3, BP_PIN_MODE, 0);
@@ -75,5 +81,26 @@ void jtag_help(void) {
 }
 
 uint32_t jtag_get_speed(void) {
-    return 10000000;
+    return mode_config.speed;
+}
+
+void jtag_engine_start(void) {
+    jtag_pio_start(mode_config.speed, mode_config.swd);
+}
+
+bool jtag_engine_swd(void) {
+    return mode_config.swd;
+}
+
+//-----------------------------------------
+//
+// Flatbuffer/binary access functions
+//-----------------------------------------
+
+bool bpio_jtag_configure(bpio_mode_configuration_t *bpio_mode_config){
+    if(bpio_mode_config->debug) printf("[JTAG] TCK %d Hz, %s\r\n", bpio_mode_config->speed, bpio_mode_config->submode ? "SWD" : "JTAG");
+    mode_config.speed = bpio_mode_config->speed;
+    if(mode_config.speed > JTAG_PIO_MAX_FREQ) mode_config.speed = JTAG_PIO_MAX_FREQ;
+    mode_config.swd = (bpio_mode_config->submode == 1);
+    return true;
 }
\ No newline at end of file
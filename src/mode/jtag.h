@@ -13,6 +13,24 @@ void jtag_settings(void);
 void jtag_help(void);
 uint32_t jtag_get_speed(void);
 
+/**
+ * @brief Start the PIO shift engine with the mode speed and wiring.
+ * @note The engine starts on first use, so blueTag keeps the pins until then.
+ */
+void jtag_engine_start(void);
+
+/**
+ * @brief The mode is set up for SWD, SWDIO on TMS.
+ */
+bool jtag_engine_swd(void);
+
+/**
+ * @brief Configure JTAG mode from BPIO.
+ * @param bpio_mode_config  speed: TCK Hz, submode: 0 JTAG, 1 SWD
+ * @return true on success
+ */
+bool bpio_jtag_configure(bpio_mode_configuration_t *bpio_mode_config);
+
 
 extern const struct _mode_command_struct jtag_commands[];
 extern const uint32_t jtag_commands_count;
@@ -372,6 +372,7 @@ struct _mode modes[] = {
         .protocol_dats = nullfunc1_temp,                 // toggle dat (remove?)
         .protocol_tick_clock = hw2wire_tick_clock,       // tick clk
         .protocol_bitr = hw2wire_read_bit,               // read dat
+        .protocol_pin_sequence = hw2wire_pin_sequence, // run of clk/dat ops as one PIO stream
         .protocol_periodic = noperiodic,                 // service to regular poll whether a byte ahs arrived
         .protocol_macro = hw2wire_macro,                 // macro
         .protocol_setup = hw2wire_setup,                 // setup UI
@@ -401,6 +402,7 @@ struct _mode modes[] = {
         .protocol_dats = nullfunc1_temp,                 // toggle dat (remove?)
         .protocol_tick_clock = hw3wire_tick_clock,       // tick clk
         .protocol_bitr = hw3wire_read_bit,               // read dat
+        .protocol_pin_sequence = hw3wire_pin_sequence, // run of clk/dat ops as one PIO stream
         .protocol_periodic = noperiodic,                 // service to regular poll whether a byte ahs arrived
         .protocol_macro = hw3wire_macro,                 // macro
         .protocol_setup = hw3wire_setup,                 // setup UI
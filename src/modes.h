@@ -97,6 +97,7 @@ typedef struct _mode {
     void (*protocol_dats)(struct _bytecode* result, struct _bytecode* next);       // toggle dat (maybe remove?)
     void (*protocol_tick_clock)(struct _bytecode* result, struct _bytecode* next); // tick clk
     void (*protocol_bitr)(struct _bytecode* result, struct _bytecode* next);       // read dat pin
+    uint32_t (*protocol_pin_sequence)(const struct _bytecode* code, uint32_t count); // run consecutive clk/dat ops, returns ops done - ignored if 0
     void (*protocol_periodic)(void);                                               // service to poll for async data
     void (*protocol_macro)(uint32_t);                                              // macro
     uint32_t (*protocol_setup)(void);                                              // setup UI
@@ -39,6 +39,9 @@
 #include "displays.h"
 #include "system_monitor.h"
 #include "ui/ui_statusbar.h"
+#include "pirate/tasks.h"
+#include "pirate/perf.h"
+#include "pirate/uart_dma_bridge.h"
 #include "tusb.h"
 #include "hardware/sync.h"
 #include "pico/lock_core.h"
@@ -488,7 +491,9 @@ static void core0_infinite_loop(void) {
         // co-op multitask **when not actively doing anything**
         // core 2 handles USB and other sensitive stuff, so it's not critical to co-op multitask
         // but the terminal will not be responsive if the service is blocking
-        binmode_service();
+        // binmode, display and protocol services are in the task table (pirate/tasks.c),
+        // the protocol service only runs while waiting at the prompt
+        tasks_service(bp_state == BP_SM_GET_INPUT);
 
         if (tud_cdc_n_connected(0)) {
             if (!has_been_connected) {
@@ -564,10 +569,6 @@ static void core0_infinite_loop(void) {
                 bp_state = BP_SM_COMMAND_PROMPT;
                 break;
             case BP_SM_GET_INPUT:
-                // it seems like we need an array where we can add our function for periodic service?
-                displays[system_config.display].display_periodic();
-                modes[system_config.mode].protocol_periodic();
-
                 if (system_config.binmode_lock_terminal) {
                     break;
                 }
@@ -691,6 +692,11 @@ int main(void) {
 bool lcd_update_request = false;
 bool lcd_update_force = false;
 
+// core1 sleeps between events, this caps the sleep for the sources that can only be polled
+// (RTT input, PSU fuse, USB data left waiting while the RX FIFO was full)
+#define BP_CORE1_IDLE_TIMEOUT_US 1000
+uint64_t core1_idle_us = 0; // total time core1 spent asleep
+
 // begin of code execution for the second core (core1)
 static void core1_initialization(void) {
 
@@ -760,7 +766,9 @@ static void tud_cdc_rx_task() {
     BP_ASSERT_CORE1(); // RX FIFO (whether from UART, CDC, RTT, ...) should only be added to from core1 (deadlock risk)
 
     uint8_t buf[64];
-    bool enabled[2] = { system_config.terminal_usb_enable, system_config.binmode_usb_rx_queue_enable };
+    // the UART DMA bridge reads CDC 0 itself
+    bool enabled[2] = { system_config.terminal_usb_enable && !uart_dma_bridge_active(),
+                        system_config.binmode_usb_rx_queue_enable };
     uint32_t available = 0;
     for (uint8_t itf = 0; itf < 2; itf++) {
         if (enabled[itf] && (available = tud_cdc_n_available(itf))) {
@@ -778,6 +786,32 @@ static void tud_cdc_rx_task() {
     }
 
 }
+// true if core1 has something to do right now and should not sleep
+// everything else arrives with an interrupt or a doorbell (__sev) from core0:
+// USB and UART IRQs, the LCD refresh timer, intercore FIFO messages and TX FIFO writes
+static bool core1_has_work(void) {
+    // the AMUX sweep is timed by polling
+    if (lcd_update_request) {
+        return true;
+    }
+    if (multicore_fifo_rvalid()) {
+        return true;
+    }
+    // the DMA rings are polled
+    if (uart_dma_bridge_active()) {
+        return true;
+    }
+    // TX data waiting for a free USB buffer is woken by the USB IRQ
+    bool cdc_ready = !system_config.terminal_usb_enable || tud_cdc_n_write_available(0) >= 64;
+    if (cdc_ready && (tx_fifo_not_empty() || tx_sb_buf_ready)) {
+        return true;
+    }
+    if (system_config.binmode_usb_tx_queue_enable && bin_tx_not_empty() && tud_cdc_n_write_available(1) >= 64) {
+        return true;
+    }
+    return false;
+}
+
 static void core1_infinite_loop(void) {
 
     //uint32_t core0_requested_update_flags = 0;
@@ -785,16 +819,22 @@ static void core1_infinite_loop(void) {
 
         // service (thread safe) tinyusb tasks
         if (system_config.terminal_usb_enable || system_config.binmode_usb_rx_queue_enable) {
+            PERF_START(PERF_USB_TASK);
             tud_task(); // tinyusb device task
             tud_cdc_rx_task();
+            PERF_END(PERF_USB_TASK);
         }
 
+        PERF_START(PERF_USB_TX);
         // service the terminal TX queue
         tx_fifo_service();
+        // UART DMA bridge rings to and from CDC 0
+        uart_dma_bridge_service();
         // optionally service the binmode TX queue if requested
         if (system_config.binmode_usb_tx_queue_enable) {
             bin_tx_fifo_service();
         }
+        PERF_END(PERF_USB_TX);
         // also receive input from RTT, if available
         rx_from_rtt_terminal();
 
@@ -802,8 +842,10 @@ static void core1_infinite_loop(void) {
             psucmd_irq_callback();
         }
 
-        if (lcd_update_request) {
-            monitor(); // TODO: fix monitor to return bool up_volts and up_current
+        // the AMUX sweep runs a step at a time between USB service,
+        // the LCD is updated when a sweep completes
+        if (lcd_update_request && amux_sweep_poll()) {
+            monitor_update(); // TODO: fix monitor to return bool up_volts and up_current
             uint32_t update_flags = 0;//core0_requested_update_flags;
             //core0_requested_update_flags = 0;
             if (lcd_update_force) {
@@ -829,7 +871,9 @@ static void core1_infinite_loop(void) {
 
                 // BUGBUG -- comments describing intent here would be helpful
                 if (displays[system_config.display].display_lcd_update) {
+                    PERF_START(PERF_LCD_UPDATE);
                     displays[system_config.display].display_lcd_update(update_flags);
+                    PERF_END(PERF_LCD_UPDATE);
                 }
             }
 
@@ -837,7 +881,9 @@ static void core1_infinite_loop(void) {
                 system_config.terminal_ansi_statusbar &&
                 system_config.terminal_ansi_statusbar_update &&
                 !system_config.terminal_ansi_statusbar_pause) {
+                PERF_START(PERF_STATUSBAR);
                 ui_statusbar_update_from_core1(update_flags);
+                PERF_END(PERF_STATUSBAR);
             }
 
             #ifdef BP_HW_STORAGE_TFCARD
@@ -885,6 +931,12 @@ static void core1_infinite_loop(void) {
             icm_core1_notify_completion(raw_message);
         }
 
+        // nothing pending, sleep until the next event
+        if (!core1_has_work()) {
+            uint64_t idle_start = time_us_64();
+            best_effort_wfe_or_timeout(make_timeout_time_us(BP_CORE1_IDLE_TIMEOUT_US));
+            core1_idle_us += time_us_64() - idle_start;
+        }
     } // while(1)
 }
 void core1_entry(void) {
@@ -126,6 +126,7 @@
 
 void lcd_irq_enable(int16_t repeat_interval);
 void lcd_irq_disable(void);
+extern uint64_t core1_idle_us;
 
 #define spi_busy_wait(ENABLE) spi_busy_wait_internal(ENABLE, __FILE__, __LINE__)
 void spi_busy_wait_internal(bool enable, const char *file, int line);
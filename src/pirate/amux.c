@@ -37,6 +37,9 @@ uint adc_spin_lock_num;        /**< Spinlock number */
 
 bool reset_adc_average = false; /**< Flag to reset ADC averaging */
 
+static bool adc_busy = false;              /**< ADC in use, protected by adc_spin_lock */
+static volatile uint32_t adc_lock_count;   /**< Incremented each time the ADC is acquired */
+
 /**
  * @brief Provide protected access to ADC (core-safe)
  * 
@@ -49,22 +52,30 @@ bool reset_adc_average = false; /**< Flag to reset ADC averaging */
  * @warning Blocking call when enable=true
  */
 void adc_busy_wait(bool enable) {
-    static bool busy = false;
-
     if (!enable) {
-        busy = false;
+        adc_busy = false;
         return;
     }
-    do {
-        spin_lock_unsafe_blocking(adc_spin_lock);
-        if (busy) {
-            spin_unlock_unsafe(adc_spin_lock);
-        } else {
-            busy = true;
-            spin_unlock_unsafe(adc_spin_lock);
-            return;
-        }
-    } while (true);
+    while (!adc_busy_try()) {
+        tight_loop_contents();
+    }
+}
+
+/**
+ * @brief Try to acquire the ADC without blocking
+ * 
+ * @return true if acquired, release with adc_busy_wait(false)
+ */
+bool adc_busy_try(void) {
+    bool acquired = false;
+    spin_lock_unsafe_blocking(adc_spin_lock);
+    if (!adc_busy) {
+        adc_busy = true;
+        adc_lock_count++;
+        acquired = true;
+    }
+    spin_unlock_unsafe(adc_spin_lock);
+    return acquired;
 }
 
 /**
@@ -201,6 +212,25 @@ uint32_t amux_read_current(void) {
     return ret;
 }
 
+// convert a completed sweep to voltages and update the rolling averages
+static void amux_sweep_publish(void) {
+    for (int i = 0; i < HW_ADC_MUX_COUNT; i++) {
+        hw_adc_voltage[i] = hw_adc_to_volts_x2(i); // these are X2 because a resistor divider /2
+        
+        if (reset_adc_average)
+            hw_adc_avgsum_voltage[i] = hw_adc_voltage[i]*ADC_AVG_TIMES;
+        else
+        {
+            // calculate the rolling average
+            hw_adc_avgsum_voltage[i]-=get_adc_average(hw_adc_avgsum_voltage[i]);
+            hw_adc_avgsum_voltage[i]+=hw_adc_voltage[i];
+        }
+    }
+    if (reset_adc_average)
+        reset_adc_average = false;
+    hw_adc_voltage[HW_ADC_CURRENT_SENSE] = hw_adc_to_volts_x1(HW_ADC_CURRENT_SENSE);
+}
+
 // read all the AMUX channels and the current sense
 // place into the global arrays hw_adc_raw and hw_adc_voltage
 void amux_sweep(void) {
@@ -211,31 +241,138 @@ void amux_sweep(void) {
     adc_select_input(AMUX_OUT_ADC);
     for (int i = 0; i < HW_ADC_MUX_COUNT; i++) {
         amux_select_input(HW_ADC_MUX_GND); // to clear any charge from a floating pin
-        busy_wait_us(10);
+        busy_wait_us(AMUX_DISCHARGE_US);
         amux_select_input(i);
-        busy_wait_us(60);
+        busy_wait_us(AMUX_SETTLE_US);
         hw_adc_raw[i] = adc_read();
         // hw_adc_voltage[i]=hw_adc_to_volts_x2(i); //these are X2 because a resistor divider /2
     }
     amux_select_input(HW_ADC_MUX_GND); // to clear any charge from a floating pin
     adc_select_input(CURRENT_SENSE_ADC);
-    busy_wait_us(60);
+    busy_wait_us(AMUX_SETTLE_US);
     hw_adc_raw[HW_ADC_CURRENT_SENSE] = (adc_read() + hw_adc_raw[HW_ADC_CURRENT_SENSE]) / 2;
     adc_busy_wait(false);
     // do these outside the ADC spin lock
-    for (int i = 0; i < HW_ADC_MUX_COUNT; i++) {
-        hw_adc_voltage[i] = hw_adc_to_volts_x2(i); // these are X2 because a resistor divider /2
-        
-        if (reset_adc_average)
-            hw_adc_avgsum_voltage[i] = hw_adc_voltage[i]*ADC_AVG_TIMES;
-        else
-        {
-            // calculate the rolling average
-            hw_adc_avgsum_voltage[i]-=get_adc_average(hw_adc_avgsum_voltage[i]);
-            hw_adc_avgsum_voltage[i]+=hw_adc_voltage[i];
+    amux_sweep_publish();
+}
+
+enum amux_sweep_state {
+    AMUX_SWEEP_IDLE,
+    AMUX_SWEEP_DISCHARGE, // mux on GND, waiting to select the channel
+    AMUX_SWEEP_SETTLE,    // channel selected, waiting to convert
+    AMUX_SWEEP_CURRENT,   // ADC on current sense, waiting to convert
+};
+
+static struct {
+    enum amux_sweep_state state;
+    uint8_t channel;
+    uint32_t deadline_us;
+    uint32_t lock_count; // adc_lock_count after our last step, changes if someone else used the ADC
+    uint16_t raw[HW_ADC_COUNT]; // back buffer, copied to hw_adc_raw when the sweep completes
+} sweep;
+
+// put the mux on GND and start the discharge wait for the current channel
+static void amux_sweep_discharge(uint32_t now) {
+    adc_select_input(AMUX_OUT_ADC);
+    amux_select_input(HW_ADC_MUX_GND); // to clear any charge from a floating pin
+    sweep.deadline_us = now + AMUX_DISCHARGE_US;
+    sweep.state = AMUX_SWEEP_DISCHARGE;
+}
+
+// Non-blocking AMUX sweep for the core1 loop.
+// Each call does at most one mux or ADC step, the settle times pass while
+// core1 services USB. The ADC lock is only held during a step, if another
+// user took the ADC in between, the current channel is measured again.
+bool amux_sweep_poll(void) {
+    if (scope_running) { // scope is using the analog subsystem
+        sweep.state = AMUX_SWEEP_IDLE;
+        return true;
+    }
+
+    uint32_t now = time_us_32();
+    if (sweep.state != AMUX_SWEEP_IDLE && (int32_t)(now - sweep.deadline_us) < 0) {
+        return false; // still settling
+    }
+    if (!adc_busy_try()) {
+        return false; // try again next time around the loop
+    }
+    bool interrupted = (sweep.state != AMUX_SWEEP_IDLE && adc_lock_count != sweep.lock_count + 1);
+    sweep.lock_count = adc_lock_count;
+    bool complete = false;
+
+    if (sweep.state == AMUX_SWEEP_IDLE) {
+        sweep.channel = 0;
+        amux_sweep_discharge(now);
+    } else if (interrupted) {
+        // mux or ADC input may have changed, measure the current channel again
+        if (sweep.state == AMUX_SWEEP_CURRENT) {
+            amux_select_input(HW_ADC_MUX_GND);
+            adc_select_input(CURRENT_SENSE_ADC);
+            sweep.deadline_us = now + AMUX_SETTLE_US;
+        } else {
+            amux_sweep_discharge(now);
+        }
+    } else if (sweep.state == AMUX_SWEEP_DISCHARGE) {
+        amux_select_input(sweep.channel);
+        sweep.deadline_us = now + AMUX_SETTLE_US;
+        sweep.state = AMUX_SWEEP_SETTLE;
+    } else if (sweep.state == AMUX_SWEEP_SETTLE) {
+        sweep.raw[sweep.channel] = adc_read();
+        sweep.channel++;
+        if (sweep.channel < HW_ADC_MUX_COUNT) {
+            amux_sweep_discharge(now);
+        } else {
+            amux_select_input(HW_ADC_MUX_GND); // to clear any charge from a floating pin
+            adc_select_input(CURRENT_SENSE_ADC);
+            sweep.deadline_us = now + AMUX_SETTLE_US;
+            sweep.state = AMUX_SWEEP_CURRENT;
         }
+    } else { // AMUX_SWEEP_CURRENT
+        sweep.raw[HW_ADC_CURRENT_SENSE] = adc_read();
+        sweep.state = AMUX_SWEEP_IDLE;
+        complete = true;
     }
-    if (reset_adc_average)
-        reset_adc_average = false;
-    hw_adc_voltage[HW_ADC_CURRENT_SENSE] = hw_adc_to_volts_x1(HW_ADC_CURRENT_SENSE);
+    adc_busy_wait(false);
+
+    if (complete) {
+        for (int i = 0; i < HW_ADC_MUX_COUNT; i++) {
+            hw_adc_raw[i] = sweep.raw[i];
+        }
+        hw_adc_raw[HW_ADC_CURRENT_SENSE] = (sweep.raw[HW_ADC_CURRENT_SENSE] + hw_adc_raw[HW_ADC_CURRENT_SENSE]) / 2;
+        amux_sweep_publish();
+    }
+    return complete;
+}
+
+// Read a list of channels for the data logger in one ADC lock.
+// A single channel is left selected between calls, the mux and settle time
+// are skipped unless someone else used the ADC since the last call.
+void amux_scan(const uint8_t* channels, uint8_t count, uint16_t* raw) {
+    static uint32_t last_lock_count;
+    static uint8_t last_channel = 0xff; // channel left selected by a single channel scan
+
+    if (scope_running) { // scope is using the analog subsystem
+        for (uint8_t i = 0; i < count; i++) {
+            raw[i] = 0;
+        }
+        return;
+    }
+    adc_busy_wait(true);
+    bool selected = (count == 1 && channels[0] == last_channel && adc_lock_count == last_lock_count + 1);
+    for (uint8_t i = 0; i < count; i++) {
+        if (!selected) {
+            if (channels[i] == HW_ADC_CURRENT_SENSE) {
+                adc_select_input(CURRENT_SENSE_ADC);
+            } else {
+                adc_select_input(AMUX_OUT_ADC);
+                amux_select_input(HW_ADC_MUX_GND); // to clear any charge from a floating pin
+                amux_select_input(channels[i]);
+            }
+            busy_wait_us(AMUX_SETTLE_US);
+        }
+        raw[i] = adc_read();
+    }
+    last_channel = (count == 1) ? channels[0] : 0xff;
+    last_lock_count = adc_lock_count;
+    adc_busy_wait(false);
 }
@@ -64,12 +64,46 @@ uint32_t amux_read_current(void);
  */
 void amux_sweep(void);
 
+#define AMUX_DISCHARGE_US 10 /**< Mux on GND before each channel, clears a floating pin */
+#define AMUX_SETTLE_US 60    /**< Settle time before each conversion */
+
+/**
+ * @brief Step a background sweep of all AMUX channels and current sense
+ * 
+ * Non-blocking version of amux_sweep() for the core1 loop. Starts a sweep
+ * if none is running, otherwise does the next mux/ADC step once its settle
+ * time has passed. Results are collected in a back buffer and copied to
+ * hw_adc_raw[]/hw_adc_voltage[] only when the sweep completes.
+ * 
+ * @return true when a sweep completed on this call (or the scope owns the ADC)
+ */
+bool amux_sweep_poll(void);
+
+/**
+ * @brief Read a list of channels back to back for the data logger
+ * 
+ * All channels are read in one ADC lock. When a single channel is scanned
+ * repeatedly it stays selected, and the mux and settle time are skipped
+ * unless another ADC user changed the input in between.
+ * 
+ * @param channels AMUX channels, HW_ADC_CURRENT_SENSE for current sense
+ * @param count Number of channels
+ * @param raw 12-bit ADC values, same order as channels (0 if scope running)
+ */
+void amux_scan(const uint8_t* channels, uint8_t count, uint16_t* raw);
+
 /**
  * @brief Control ADC busy/lock state
  * @param enable true to acquire lock, false to release
  */
 void adc_busy_wait(bool enable);
 
+/**
+ * @brief Try to acquire the ADC lock without blocking
+ * @return true if acquired, release with adc_busy_wait(false)
+ */
+bool adc_busy_try(void);
+
 /**
  * @brief Flag to reset averaging
  * 
@@ -0,0 +1,136 @@
+/**
+ * @file bitbang_seq.c
+ * @brief Compile runs of pin bytecodes into PIO instruction sequences.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "bytecode.h"
+#include "pirate/bitbang_seq.h"
+
+enum {
+    BB_KEEP = 0,
+    BB_LOW,
+    BB_HIGH,
+};
+
+// what each pin bytecode does to the clock and data pins
+static const struct {
+    uint8_t valid : 1;
+    uint8_t tick : 1; // clock low if needed, then repeat x (high, low)
+    uint8_t clk : 2;
+    uint8_t dat : 2;
+} bb_seq_ops[] = {
+    [SYN_TICK_CLOCK] = { .valid = 1, .tick = 1 },
+    [SYN_SET_CLK_HIGH] = { .valid = 1, .clk = BB_HIGH },
+    [SYN_SET_CLK_LOW] = { .valid = 1, .clk = BB_LOW },
+    [SYN_SET_DAT_HIGH] = { .valid = 1, .dat = BB_HIGH },
+    [SYN_SET_DAT_LOW] = { .valid = 1, .dat = BB_LOW },
+};
+
+bool bb_seq_is_pin_op(uint8_t command) {
+    return command < (sizeof(bb_seq_ops) / sizeof(bb_seq_ops[0])) && bb_seq_ops[command].valid;
+}
+
+uint32_t bb_seq_run_length(const struct _bytecode* code, uint32_t count) {
+    uint32_t i = 0;
+    while (i < count && bb_seq_is_pin_op(code[i].command)) {
+        i++;
+    }
+    return i;
+}
+
+// instructions for one bytecode
+static uint32_t bb_seq_op_length(const struct _bytecode* op, const struct bb_seq_state* state) {
+    if (!bb_seq_ops[op->command].tick) {
+        return 1;
+    }
+    return (state->clk ? 1 : 0) + 2 * op->repeat;
+}
+
+struct bb_seq_writer {
+    const struct bb_seq_encoding* enc;
+    uint16_t* words;
+    uint32_t count;  // words written
+    uint32_t header; // index of the open escape word
+    uint32_t block;  // instructions after it, 0 = no open block
+};
+
+static void bb_seq_close(struct bb_seq_writer* w) {
+    if (!w->block) {
+        return;
+    }
+    if (w->block == 1) {
+        // pad in front so the pin change is still the last instruction
+        w->words[w->count] = w->words[w->count - 1];
+        w->words[w->count - 1] = w->enc->nop;
+        w->count++;
+        w->block++;
+    }
+    w->words[w->header] = (uint16_t)((w->block - 1) << w->enc->icount_lsb);
+    w->block = 0;
+}
+
+static void bb_seq_emit(struct bb_seq_writer* w, const struct bb_seq_state* state) {
+    if (w->block == BB_SEQ_BLOCK_MAX) {
+        bb_seq_close(w);
+    }
+    if (!w->block) {
+        w->header = w->count++;
+    }
+    uint16_t instr = w->enc->set;
+    if (state->clk) {
+        instr |= w->enc->clk;
+    }
+    if (state->dat) {
+        instr |= w->enc->dat;
+    }
+    w->words[w->count++] = instr;
+    w->block++;
+}
+
+uint32_t bb_seq_compile(const struct _bytecode* code,
+                        uint32_t count,
+                        const struct bb_seq_encoding* enc,
+                        struct bb_seq_state* state,
+                        uint16_t* words,
+                        uint32_t max_words,
+                        uint32_t* consumed) {
+    struct bb_seq_writer w = { .enc = enc, .words = words };
+    uint32_t i;
+
+    for (i = 0; i < count && bb_seq_is_pin_op(code[i].command); i++) {
+        // worst case: an escape word every block, a new block and a pad word
+        uint32_t n = bb_seq_op_length(&code[i], state);
+        if (w.count + n + n / BB_SEQ_BLOCK_MAX + 2 > max_words) {
+            break;
+        }
+
+        if (bb_seq_ops[code[i].command].tick) {
+            if (state->clk) {
+                state->clk = false;
+                bb_seq_emit(&w, state);
+            }
+            for (uint32_t j = 0; j < code[i].repeat; j++) {
+                state->clk = true;
+                bb_seq_emit(&w, state);
+                state->clk = false;
+                bb_seq_emit(&w, state);
+            }
+            continue;
+        }
+
+        if (bb_seq_ops[code[i].command].clk != BB_KEEP) {
+            state->clk = (bb_seq_ops[code[i].command].clk == BB_HIGH);
+        }
+        if (bb_seq_ops[code[i].command].dat != BB_KEEP) {
+            state->dat = (bb_seq_ops[code[i].command].dat == BB_HIGH);
+        }
+        bb_seq_emit(&w, state);
+    }
+    bb_seq_close(&w);
+
+    *consumed = i;
+    return w.count;
+}
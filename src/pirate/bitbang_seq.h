@@ -0,0 +1,70 @@
+/**
+ * @file bitbang_seq.h
+ * @brief Compile runs of pin bytecodes into PIO instruction sequences.
+ * @details The 2-wire and 3-wire PIO programs execute instructions streamed
+ *          through the TX FIFO after an escape word. A run of `/ \ - _ ^`
+ *          bytecodes becomes one such stream of `set pins ... side ...`
+ *          instructions, so the edges come out at the state machine clock
+ *          instead of one function call per edge.
+ *
+ *          Pure C with no SDK dependencies, see tests/test_bitbang_seq.c.
+ */
+
+#ifndef _BITBANG_SEQ_H
+#define _BITBANG_SEQ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bytecode.h"
+
+#define BB_SEQ_BLOCK_MAX 64u // instructions per escape word (6 bit count field)
+
+/**
+ * @brief How a PIO program encodes the pin states.
+ */
+struct bb_seq_encoding {
+    uint16_t set;       // instruction with clock and data low
+    uint16_t dat;       // bit that drives data high
+    uint16_t clk;       // bit that drives clock high
+    uint16_t nop;       // padding, an escape runs at least two instructions
+    uint8_t icount_lsb; // position of the instruction count in the escape word
+};
+
+/**
+ * @brief Pin levels at the end of the sequence so far.
+ */
+struct bb_seq_state {
+    bool clk;
+    bool dat;
+};
+
+/**
+ * @brief The bytecode only moves the clock and data pins.
+ */
+bool bb_seq_is_pin_op(uint8_t command);
+
+/**
+ * @brief Number of pin bytecodes at the start of code.
+ */
+uint32_t bb_seq_run_length(const struct _bytecode* code, uint32_t count);
+
+/**
+ * @brief Compile pin bytecodes into escape words and instructions.
+ * @param code       Bytecodes, compiling stops at the first one that isn't a pin op
+ * @param count      Number of bytecodes
+ * @param enc        Instruction encoding of the PIO program
+ * @param[in,out] state  Pin levels before the sequence, updated to the levels after
+ * @param[out] words     FIFO words to write
+ * @param max_words  Size of words
+ * @param[out] consumed  Bytecodes compiled, 0 if the first one doesn't fit
+ * @return Number of FIFO words
+ */
+uint32_t bb_seq_compile(const struct _bytecode* code,
+                        uint32_t count,
+                        const struct bb_seq_encoding* enc,
+                        struct bb_seq_state* state,
+                        uint16_t* words,
+                        uint32_t max_words,
+                        uint32_t* consumed);
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * @file hash.c
+ * @brief Streaming CRC32 and SHA-256 for on-device image checks.
+ * @details CRC32 uses a 256 entry table built in RAM on first use, one
+ *          lookup per byte. SHA-256 is a plain software implementation,
+ *          it is the slow half and can be turned off with hash_init().
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pirate/hash.h"
+
+static uint32_t crc32_table[256];
+static bool crc32_table_ready = false;
+
+static void hash_crc32_table_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (uint8_t j = 0; j < 8; j++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        crc32_table[i] = c;
+    }
+    crc32_table_ready = true;
+}
+
+uint32_t hash_crc32(uint32_t crc, const uint8_t* data, uint32_t len) {
+    if (!crc32_table_ready) {
+        hash_crc32_table_init();
+    }
+    crc = ~crc;
+    while (len--) {
+        crc = crc32_table[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void hash_sha256_block(hash_sha256_t* ctx, const uint8_t* block) {
+    uint32_t w[64];
+    for (uint8_t i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+               ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+    }
+    for (uint8_t i = 16; i < 64; i++) {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = ctx->state[0], b = ctx->state[1], c = ctx->state[2], d = ctx->state[3];
+    uint32_t e = ctx->state[4], f = ctx->state[5], g = ctx->state[6], h = ctx->state[7];
+    for (uint8_t i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+    ctx->state[5] += f;
+    ctx->state[6] += g;
+    ctx->state[7] += h;
+}
+
+void hash_sha256_init(hash_sha256_t* ctx) {
+    static const uint32_t sha256_h0[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                           0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    memcpy(ctx->state, sha256_h0, sizeof(ctx->state));
+    ctx->length = 0;
+    ctx->block_len = 0;
+}
+
+void hash_sha256_update(hash_sha256_t* ctx, const uint8_t* data, uint32_t len) {
+    ctx->length += len;
+    // top up a partial block first
+    if (ctx->block_len) {
+        uint32_t n = 64 - ctx->block_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&ctx->block[ctx->block_len], data, n);
+        ctx->block_len += n;
+        data += n;
+        len -= n;
+        if (ctx->block_len < 64) {
+            return;
+        }
+        hash_sha256_block(ctx, ctx->block);
+        ctx->block_len = 0;
+    }
+    // whole blocks straight from the caller's buffer
+    while (len >= 64) {
+        hash_sha256_block(ctx, data);
+        data += 64;
+        len -= 64;
+    }
+    memcpy(ctx->block, data, len);
+    ctx->block_len = len;
+}
+
+void hash_sha256_final(hash_sha256_t* ctx, uint8_t digest[HASH_SHA256_BYTES]) {
+    uint64_t bits = ctx->length * 8;
+    ctx->block[ctx->block_len++] = 0x80;
+    if (ctx->block_len > 56) {
+        memset(&ctx->block[ctx->block_len], 0, 64 - ctx->block_len);
+        hash_sha256_block(ctx, ctx->block);
+        ctx->block_len = 0;
+    }
+    memset(&ctx->block[ctx->block_len], 0, 56 - ctx->block_len);
+    for (uint8_t i = 0; i < 8; i++) {
+        ctx->block[63 - i] = (uint8_t)(bits >> (8 * i));
+    }
+    hash_sha256_block(ctx, ctx->block);
+    for (uint8_t i = 0; i < 8; i++) {
+        digest[i * 4] = ctx->state[i] >> 24;
+        digest[i * 4 + 1] = ctx->state[i] >> 16;
+        digest[i * 4 + 2] = ctx->state[i] >> 8;
+        digest[i * 4 + 3] = ctx->state[i];
+    }
+}
+
+void hash_init(hash_ctx_t* ctx, bool sha256) {
+    ctx->crc32 = 0;
+    ctx->bytes = 0;
+    ctx->sha256_enabled = sha256;
+    if (sha256) {
+        hash_sha256_init(&ctx->sha256);
+    }
+}
+
+void hash_update(hash_ctx_t* ctx, const uint8_t* data, uint32_t len) {
+    ctx->crc32 = hash_crc32(ctx->crc32, data, len);
+    if (ctx->sha256_enabled) {
+        hash_sha256_update(&ctx->sha256, data, len);
+    }
+    ctx->bytes += len;
+}
+
+void hash_final(hash_ctx_t* ctx, uint8_t digest[HASH_SHA256_BYTES]) {
+    if (ctx->sha256_enabled) {
+        hash_sha256_final(&ctx->sha256, digest);
+    }
+}
+
+void hash_print(const hash_ctx_t* ctx, const uint8_t digest[HASH_SHA256_BYTES]) {
+    printf("Bytes: %u (0x%08X)\r\n", ctx->bytes, ctx->bytes);
+    printf("CRC32: 0x%08X\r\n", ctx->crc32);
+    if (ctx->sha256_enabled) {
+        printf("SHA-256: ");
+        for (uint8_t i = 0; i < HASH_SHA256_BYTES; i++) {
+            printf("%02x", digest[i]);
+        }
+        printf("\r\n");
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * @file hash.h
+ * @brief Streaming CRC32 and SHA-256 for on-device image checks.
+ * @details Data is fed in chunks as it is read from the target, so a whole
+ *          chip can be checked without a buffer the size of the chip or a
+ *          transfer to the host. CRC32 is the common zlib/PNG/Ethernet
+ *          variant, compatible with crc32 and sha256sum on the host.
+ */
+
+#ifndef _HASH_H
+#define _HASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HASH_SHA256_BYTES 32
+
+typedef struct hash_sha256 {
+    uint32_t state[8];
+    uint64_t length;   // total bytes hashed
+    uint8_t block[64]; // partial block
+    uint8_t block_len;
+} hash_sha256_t;
+
+typedef struct hash_ctx {
+    uint32_t crc32;
+    uint32_t bytes;
+    bool sha256_enabled;
+    hash_sha256_t sha256;
+} hash_ctx_t;
+
+/**
+ * @brief Update a CRC32, start with 0 for a new calculation.
+ * @param crc   Previous CRC32 value
+ * @param data  Data
+ * @param len   Data length
+ * @return Updated CRC32
+ */
+uint32_t hash_crc32(uint32_t crc, const uint8_t* data, uint32_t len);
+
+void hash_sha256_init(hash_sha256_t* ctx);
+void hash_sha256_update(hash_sha256_t* ctx, const uint8_t* data, uint32_t len);
+void hash_sha256_final(hash_sha256_t* ctx, uint8_t digest[HASH_SHA256_BYTES]);
+
+/**
+ * @brief Start a CRC32 (and optionally SHA-256) calculation.
+ * @param ctx     Hash context
+ * @param sha256  Also calculate SHA-256, about 10x the CPU time of CRC32
+ */
+void hash_init(hash_ctx_t* ctx, bool sha256);
+
+/**
+ * @brief Add data to the running hashes.
+ * @param ctx   Hash context
+ * @param data  Data
+ * @param len   Data length
+ */
+void hash_update(hash_ctx_t* ctx, const uint8_t* data, uint32_t len);
+
+/**
+ * @brief Finish the calculation.
+ * @param ctx     Hash context, crc32 holds the final CRC32
+ * @param digest  SHA-256 output, ignored if SHA-256 is not enabled
+ */
+void hash_final(hash_ctx_t* ctx, uint8_t digest[HASH_SHA256_BYTES]);
+
+/**
+ * @brief Print the results of hash_final() to the terminal.
+ * @param ctx     Hash context
+ * @param digest  SHA-256 digest
+ */
+void hash_print(const hash_ctx_t* ctx, const uint8_t digest[HASH_SHA256_BYTES]);
+
+#endif
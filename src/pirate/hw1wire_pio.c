@@ -20,6 +20,7 @@
 // #include "hardware/pio.h"
 // #include "pico/binary_info.h"
 #include "hardware/clocks.h"
+#include "hardware/dma.h"
 #include "hw1wire.pio.h"
 #include "pirate/hw1wire_pio.h"
 
@@ -202,6 +203,82 @@ uint onewire_rx_byte(void) {
     return (pio_sm_get(pio, sm) >> 24) & 0xff;
 }
 
+/* Move a buffer through the state machine with two DMA channels,
+   one byte per FIFO word. tx_increment/rx_increment false repeat
+   or discard a single byte. Returns false if no DMA channels
+   are free. */
+static bool onewire_dma_transfer(const uint8_t* txbuf, bool tx_increment, uint8_t* rxbuf, bool rx_increment, uint32_t len) {
+    PIO pio = owobj.pio;
+    uint sm = owobj.sm;
+
+    int tx_chan = dma_claim_unused_channel(false);
+    int rx_chan = dma_claim_unused_channel(false);
+    if (tx_chan < 0 || rx_chan < 0) {
+        if (tx_chan >= 0) {
+            dma_channel_unclaim(tx_chan);
+        }
+        return false;
+    }
+
+    onewire_set_fifo_thresh(8);
+
+    /* Received byte is in 31..24 of RX fifo, read the top byte lane */
+    dma_channel_config c = dma_channel_get_default_config(rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, rx_increment);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    dma_channel_configure(rx_chan, &c, rxbuf, (io_rw_8*)&pio->rxf[sm] + 3, len, false);
+
+    /* byte writes are replicated to all lanes, the low 8 bits shift out */
+    c = dma_channel_get_default_config(tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, tx_increment);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(tx_chan, &c, &pio->txf[sm], txbuf, len, false);
+
+    dma_start_channel_mask((1u << rx_chan) | (1u << tx_chan));
+    dma_channel_wait_for_finish_blocking(rx_chan);
+
+    dma_channel_unclaim(tx_chan);
+    dma_channel_unclaim(rx_chan);
+    onewire_wait_for_idle();
+    return true;
+}
+
+/* Transmit a buffer */
+void onewire_tx_buf(const uint8_t* buf, uint32_t len) {
+    static uint8_t discard;
+
+    if (!len) {
+        return;
+    }
+    if (onewire_dma_transfer(buf, true, &discard, false, len)) {
+        return;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        onewire_tx_byte(buf[i]);
+    }
+    onewire_wait_for_idle();
+}
+
+/* Receive a buffer */
+void onewire_rx_buf(uint8_t* buf, uint32_t len) {
+    static const uint8_t read_slots = 0xff;
+
+    if (!len) {
+        return;
+    }
+    if (onewire_dma_transfer(&read_slots, false, buf, true, len)) {
+        return;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        buf[i] = onewire_rx_byte();
+    }
+    onewire_wait_for_idle();
+}
+
 /* Do a ROM search triplet.
    Receive two bits and store the read values to
    id_bit and cmp_id_bit respectively.
@@ -213,6 +290,10 @@ uint onewire_rx_byte(void) {
           1 |          1 |      1
     The actually transmitted bit is returned via search_direction.
 
+    The decision is made by the 'triplet' routine in the PIO, so
+    the three slots run back to back without changing the FIFO
+    thresholds (each change restarts the state machine).
+
     Refer to MAXIM APPLICATION NOTE 187 "1-Wire Search Algorithm"
  */
 void onewire_triplet(int* id_bit, int* cmp_id_bit, unsigned char* search_direction) {
@@ -220,29 +301,17 @@ void onewire_triplet(int* id_bit, int* cmp_id_bit, unsigned char* search_directi
     uint sm = owobj.sm;
     uint fiforx;
 
-    onewire_set_fifo_thresh(2);
-    pio->txf[sm] = 0x3;
-    while (pio_sm_get_rx_fifo_level(pio, sm) == 0)
-        /* wait */;
-
-    fiforx = pio_sm_get(pio, sm);
-    *id_bit = (fiforx >> 30) & 1;
-    *cmp_id_bit = (fiforx >> 31) & 1;
-    if ((*id_bit == 0) && (*cmp_id_bit == 1)) {
-        *search_direction = 0;
-    } else if ((*id_bit == 1) && (*cmp_id_bit == 0)) {
-        *search_direction = 1;
-    } else if ((*id_bit == 0) && (*cmp_id_bit == 0)) {
-        /* do not change search direction */
-    } else {
-        *search_direction = 1;
-    }
-
-    onewire_set_fifo_thresh(1);
+    onewire_set_fifo_thresh(8);
+    onewire_wait_for_idle(); // the jump must not cut the last bit short
+    pio_sm_exec(pio, sm, pio_encode_jmp(owobj.offset + onewire_offset_triplet));
     pio->txf[sm] = *search_direction;
     while (pio_sm_get_rx_fifo_level(pio, sm) == 0)
         /* wait */;
+
     fiforx = pio_sm_get(pio, sm);
+    *id_bit = (fiforx >> 29) & 1;
+    *cmp_id_bit = (fiforx >> 30) & 1;
+    *search_direction = (fiforx >> 31) & 1;
     return;
 }
 
@@ -269,17 +338,54 @@ unsigned char calc_crc8_buf(unsigned char* data, int len) {
 /* Select a device by ROM ID */
 int onewire_select(unsigned char* romid) {
     int i;
+    unsigned char buf[9];
 
     if (!onewire_reset()) {
         return 0;
     }
-    onewire_tx_byte(0x55); // Match ROM command
+    buf[0] = 0x55; // Match ROM command
     for (i = 0; i < 8; i++) {
-        onewire_tx_byte(romid[i]);
+        buf[i + 1] = romid[i];
     }
+    onewire_tx_buf(buf, sizeof(buf));
     return 1;
 }
 
+/* Start a temperature conversion on every device with one
+   Skip ROM, wait until the last one is done, then read the
+   scratchpad of each device in turn. Far quicker than
+   convert/wait/read per device on a long chain of sensors. */
+int onewire_convert_read_all(unsigned char (*romids)[8], int count, unsigned char (*scratchpads)[9], uint32_t timeout_ms) {
+    unsigned char cmd[2] = { 0xcc, 0x44 }; // Skip ROM, Convert T
+    int good = 0;
+
+    if (!onewire_reset()) {
+        return -1;
+    }
+    onewire_tx_buf(cmd, sizeof(cmd));
+
+    /* Devices hold the bus low in read slots while converting */
+    uint32_t start = time_us_32();
+    while (onewire_rx_byte() != 0xff) {
+        if (time_us_32() - start > timeout_ms * 1000) {
+            return -1;
+        }
+    }
+    onewire_wait_for_idle();
+
+    for (int i = 0; i < count; i++) {
+        if (!onewire_select(romids[i])) {
+            return -1;
+        }
+        onewire_tx_byte(0xbe); // Read Scratchpad
+        onewire_rx_buf(scratchpads[i], 9);
+        if (calc_crc8_buf(scratchpads[i], 8) == scratchpads[i][8]) {
+            good++;
+        }
+    }
+    return good;
+}
+
 /* This is code stolen from MAXIM AN3684, slightly modified
    to interface to the PIO onewire and to eliminate global
    variables. */
@@ -96,10 +96,26 @@ void onewire_end_spu(void);
 uint onewire_rx_byte(void);
 
 /**
- * @brief Perform search triplet operation.
+ * @brief Transmit a buffer on 1-Wire bus.
+ * @param buf  Bytes to transmit
+ * @param len  Number of bytes
+ * @note Moved by DMA when two channels are free, returns with the bus idle.
+ */
+void onewire_tx_buf(const uint8_t* buf, uint32_t len);
+
+/**
+ * @brief Receive a buffer from 1-Wire bus.
+ * @param[out] buf  Received bytes
+ * @param len       Number of bytes
+ * @note Moved by DMA when two channels are free, returns with the bus idle.
+ */
+void onewire_rx_buf(uint8_t* buf, uint32_t len);
+
+/**
+ * @brief Perform search triplet operation in the PIO.
  * @param[out] id_bit          First bit read from bus
  * @param[out] cmp_id_bit      Complement bit read from bus
- * @param[out] search_direction Direction bit written to bus
+ * @param[in,out] search_direction Direction for a discrepancy in, bit written to bus out
  */
 void onewire_triplet(int* id_bit, int* cmp_id_bit, unsigned char* search_direction);
 
@@ -118,6 +134,16 @@ unsigned char calc_crc8_buf(unsigned char* data, int len);
  */
 int onewire_select(unsigned char* romid);
 
+/**
+ * @brief Convert on all devices at once, then read each scratchpad.
+ * @param romids       ROM IDs of the devices to read
+ * @param count        Number of devices
+ * @param[out] scratchpads  9 byte scratchpad per device
+ * @param timeout_ms   Longest conversion time (750ms for 12 bit DS18B20)
+ * @return Number of scratchpads with a good CRC, -1 if the bus didn't answer
+ */
+int onewire_convert_read_all(unsigned char (*romids)[8], int count, unsigned char (*scratchpads)[9], uint32_t timeout_ms);
+
 /**
  * @brief Calculate Dallas/Maxim 1-Wire CRC8 for single byte.
  * @param data  Input byte
@@ -24,6 +24,7 @@
 #include "hardware/regs/io_bank0.h"
 #include "pirate.h"
 #include "pio_config.h"
+#include "pirate/bitbang_seq.h"
 
 #define PIO_PIN_0 1u << 0
 #define PIO_SIDE_0 1u << 11
@@ -183,6 +184,48 @@ void pio_hw2wire_clock_tick(void) {
     pio_hw2wire_put_instructions(tick_clock, count_of(tick_clock));
 }
 
+// streams the words without waiting for idle in between, so the FIFO stays
+// ahead of the state machine and the edges come out at the PIO clock
+uint32_t pio_hw2wire_pin_sequence(const struct _bytecode* code, uint32_t count) {
+    static const struct bb_seq_encoding enc = {
+        .set = 0xf700, // set pins, 0 side 0 [7]
+        .dat = PIO_PIN_0,
+        .clk = PIO_SIDE_0,
+        .nop = 0xa042,
+        .icount_lsb = PIO_HW2WIRE_ICOUNT_LSB,
+    };
+    struct bb_seq_state state = {
+        .dat = !(iobank0_hw->io[0].status & (1u << IO_BANK0_GPIO0_STATUS_OUTTOPAD_MSB)),
+        .clk = !(iobank0_hw->io[1].status & (1u << IO_BANK0_GPIO1_STATUS_OUTTOPAD_MSB)),
+    };
+    uint16_t words[128];
+    uint32_t done = 0;
+    pio_hw2wire_rx_enable(pio_config.pio, pio_config.sm, false);
+
+    while (done < count) {
+        uint32_t consumed;
+        uint32_t n = bb_seq_compile(&code[done], count - done, &enc, &state, words, count_of(words), &consumed);
+        if (!consumed) {
+            break; // too long for one buffer, the caller runs it op by op
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            while (pio_sm_is_tx_fifo_full(pio_config.pio, pio_config.sm))
+                ;
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+            *(io_rw_16*)&pio_config.pio->txf[pio_config.sm] = words[i];
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+        }
+        done += consumed;
+    }
+    pio_hw2wire_wait_idle(pio_config.pio, pio_config.sm);
+    return done;
+}
+
 void pio_hw2wire_start(void) {
     const uint16_t start[] = {
         1u << PIO_HW2WIRE_ICOUNT_LSB,                  // Escape code for 2 instruction sequence
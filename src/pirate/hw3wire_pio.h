@@ -13,6 +13,8 @@
 #ifndef _PIO_I2C_H
 #define _PIO_I2C_H
 
+#include "bytecode.h"
+
 /**
  * @brief Initialize 3-Wire (SPI) PIO and state machine.
  * @param mosi  GPIO pin for SPI MOSI (master out, slave in)
@@ -14,6 +14,8 @@
 #include "hwi2c_pio.h"
 
 static struct _pio_config pio_config;
+static uint32_t pio_i2c_khz;
+static struct pio_i2c_bus_stats bus_stats;
 
 #define PIO_I2C_ICOUNT_LSB 10
 #define PIO_I2C_FINAL_LSB 9
@@ -25,6 +27,8 @@ void pio_i2c_init(uint sda, uint scl, uint dir_sda, uint dir_scl, uint baudrate,
     // &pio_config.offset, dir_sda, 10, true); hard_assert(success);
     pio_config.pio = PIO_MODE_PIO;
     pio_config.sm = 0;
+    pio_i2c_khz = baudrate;
+    bus_stats = (struct pio_i2c_bus_stats){ 0 };
     if(clock_stretch) {
         pio_config.program = &i2c_clock_stretch_program;
         pio_config.offset = pio_add_program(pio_config.pio, pio_config.program);
@@ -212,8 +216,156 @@ hwi2c_status_t pio_i2c_read_timeout(uint8_t* in_data, bool ack, uint32_t timeout
 
 /*
 * functions for bulk I2C transactions
-* TODO: handle ACK NACK in a new way!
 */
+
+// words in flight (shifting + queued) while streaming
+// writes check the ACK of each byte, so after a NACK at most one more byte is clocked out
+#define PIO_I2C_WRITE_WINDOW 2
+// reads never stop early, fill the TX FIFO. The RX FIFO is as deep, the SM can't stall on it
+#define PIO_I2C_READ_WINDOW 4
+
+// Stream bytes through the PIO FIFOs. The next byte is queued while the current one
+// is on the bus, so the state machine pulls it right after the ACK clock instead of
+// waiting for a round trip through the CPU.
+// txbuf != NULL writes and returns HWI2C_NACK at the first byte not acknowledged,
+// txbuf == NULL reads into rxbuf and NACKs the last byte.
+static hwi2c_status_t pio_i2c_stream_timeout(const uint8_t* txbuf, uint8_t* rxbuf, uint len, uint32_t timeout) {
+    if (!len) return HWI2C_OK;
+    if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
+    while (!pio_sm_is_rx_fifo_empty(pio_config.pio, pio_config.sm)) {
+        (void)pio_i2c_get();
+    }
+
+    uint window = txbuf ? PIO_I2C_WRITE_WINDOW : PIO_I2C_READ_WINDOW;
+    uint tx_remain = len;
+    uint rx_remain = len;
+    uint sent = 0;
+    hwi2c_status_t i2c_result = HWI2C_OK;
+    uint32_t start_us = time_us_32();
+    uint32_t to = timeout;
+    while (rx_remain) {
+        if (tx_remain && (rx_remain - tx_remain) < window &&
+            !pio_sm_is_tx_fifo_full(pio_config.pio, pio_config.sm)) {
+            --tx_remain;
+            uint16_t word = txbuf ? (((uint16_t)*txbuf++ << PIO_I2C_DATA_LSB) | 1u)
+                                  : ((0xffu << PIO_I2C_DATA_LSB) | (tx_remain ? 0 : 1u)); // NACK the final byte of the read
+            pio_i2c_put_timeout(word, timeout);
+            sent++;
+            to = timeout;
+        }
+        if (!pio_sm_is_rx_fifo_empty(pio_config.pio, pio_config.sm)) {
+            --rx_remain;
+            uint32_t in_data = pio_i2c_get();
+            if (txbuf) {
+                if ((in_data & 0b1) && i2c_result == HWI2C_OK) {
+                    // stop queuing, collect the bytes already handed to the state machine
+                    i2c_result = HWI2C_NACK;
+                    rx_remain -= tx_remain;
+                    tx_remain = 0;
+                }
+            } else {
+                *rxbuf++ = (uint8_t)(in_data >> PIO_I2C_DATA_LSB);
+            }
+            to = timeout;
+        }
+        if (!--to) return HWI2C_TIMEOUT;
+    }
+
+    bus_stats.us = time_us_32() - start_us;
+    bus_stats.bytes = sent;
+    return i2c_result;
+}
+
+// Probe every address from first to last in one pass. Each address is a START,
+// the address byte and a STOP. Read addresses also clock one byte and NACK it, so
+// a device that answered releases SDA before the STOP. The sequence doesn't depend
+// on the ACK, the words for the next addresses are queued while the current one
+// is on the bus and the ACK bits are collected from the RX FIFO as they arrive.
+hwi2c_status_t pio_i2c_scan_timeout(uint8_t first, uint8_t last, uint32_t* ack_map, uint32_t timeout) {
+    const uint16_t start[] = {
+        1u << PIO_I2C_ICOUNT_LSB,
+        set_scl_sda_program_instructions[I2C_SC1_SD0],
+        set_scl_sda_program_instructions[I2C_SC0_SD0]
+    };
+    const uint16_t stop[] = {
+        2u << PIO_I2C_ICOUNT_LSB,
+        set_scl_sda_program_instructions[I2C_SC0_SD0],
+        set_scl_sda_program_instructions[I2C_SC1_SD0],
+        set_scl_sda_program_instructions[I2C_SC1_SD1]
+    };
+    uint16_t seq[count_of(start) + 2 + count_of(stop)];
+    uint8_t seq_len = 0;
+    uint8_t seq_pos = 0;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        ack_map[i] = 0;
+    }
+
+    if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
+    while (!pio_sm_is_rx_fifo_empty(pio_config.pio, pio_config.sm)) {
+        (void)pio_i2c_get();
+    }
+
+    uint16_t tx_addr = first; // 16 bits so last can be 0xff
+    uint16_t rx_addr = first;
+    bool rx_read_byte = false; // next RX word is the byte clocked after a read address
+    uint32_t start_us = time_us_32();
+    uint32_t to = timeout;
+    while (rx_addr <= last) {
+        if (seq_pos == seq_len && tx_addr <= last) {
+            seq_len = 0;
+            seq_pos = 0;
+            for (uint8_t i = 0; i < count_of(start); i++) {
+                seq[seq_len++] = start[i];
+            }
+            seq[seq_len++] = (tx_addr << PIO_I2C_DATA_LSB) | 1u;
+            if (tx_addr & 1u) {
+                seq[seq_len++] = (0xffu << PIO_I2C_DATA_LSB) | 1u; // read one and NACK
+            }
+            for (uint8_t i = 0; i < count_of(stop); i++) {
+                seq[seq_len++] = stop[i];
+            }
+            tx_addr++;
+        }
+        if (seq_pos < seq_len && !pio_sm_is_tx_fifo_full(pio_config.pio, pio_config.sm)) {
+            pio_i2c_put_timeout(seq[seq_pos++], timeout);
+            to = timeout;
+        }
+        if (!pio_sm_is_rx_fifo_empty(pio_config.pio, pio_config.sm)) {
+            uint32_t in_data = pio_i2c_get();
+            if (rx_read_byte) {
+                rx_read_byte = false;
+                rx_addr++;
+            } else {
+                if (!(in_data & 0b1)) {
+                    ack_map[rx_addr >> 5] |= 1u << (rx_addr & 0x1f);
+                }
+                if (rx_addr & 1u) {
+                    rx_read_byte = true;
+                } else {
+                    rx_addr++;
+                }
+            }
+            to = timeout;
+        }
+        if (!--to) {
+            pio_i2c_resume_after_error();
+            return HWI2C_TIMEOUT;
+        }
+    }
+
+    if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
+    bus_stats.us = time_us_32() - start_us;
+    bus_stats.bytes = (last - first + 1) + ((last - first + 1 + (first & 1u)) >> 1); // addresses + read bytes
+    return HWI2C_OK;
+}
+
+void pio_i2c_get_bus_stats(struct pio_i2c_bus_stats* stats) {
+    *stats = bus_stats;
+    // 9 clocks per byte with the ACK
+    stats->ideal_us = pio_i2c_khz ? (uint32_t)(((uint64_t)stats->bytes * 9 * 1000) / pio_i2c_khz) : 0;
+}
+
 // write an array to I2C with start and stop, return false on fail, true on success
 hwi2c_status_t pio_i2c_write_array_timeout(uint8_t addr, uint8_t* txbuf, uint len, uint32_t timeout) {
     if(pio_i2c_start_timeout(timeout)) return HWI2C_TIMEOUT;
@@ -223,11 +375,8 @@ hwi2c_status_t pio_i2c_write_array_timeout(uint8_t addr, uint8_t* txbuf, uint le
         return i2c_result;
     }
     
-    while (len) {
-        --len;
-        i2c_result = pio_i2c_write_timeout(*txbuf++, timeout);
-        if(i2c_result != HWI2C_OK) return i2c_result;
-    }
+    i2c_result = pio_i2c_stream_timeout(txbuf, NULL, len, timeout);
+    if(i2c_result != HWI2C_OK) return i2c_result;
 
     if (pio_i2c_stop_timeout(timeout)) return HWI2C_TIMEOUT;
     if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
@@ -240,29 +389,7 @@ hwi2c_status_t pio_i2c_read_array_timeout(uint8_t addr, uint8_t* rxbuf, uint len
     hwi2c_status_t i2c_result = pio_i2c_write_timeout(addr, timeout); //note, don't force the last bit high, its mysterious
     if(i2c_result != HWI2C_OK) return i2c_result;
 
-    /*
-    uint32_t tx_remain = len; // Need to stuff 0xff bytes in to get clocks
-    uint32_t temp = timeout;
-    while ((tx_remain || len)) {
-        if (tx_remain && !pio_sm_is_tx_fifo_full(pio_config.pio, pio_config.sm)) {
-            --tx_remain;
-            // NACK the final byte of the read
-            if (pio_i2c_put_timeout((0xff << PIO_I2C_DATA_LSB) | (tx_remain ? 0 : 1u), timeout)) return HWI2C_TIMEOUT;
-            temp = timeout; // reset the counter
-        }
-        if (!pio_sm_is_rx_fifo_empty(pio_config.pio, pio_config.sm)) {
-            --len;
-            *rxbuf++ = (pio_i2c_get()>>1);
-        }
-        temp--;
-        if (!temp) return HWI2C_TIMEOUT;
-    }
-    */
-
-    while(len){
-        --len;
-        pio_i2c_read_timeout(rxbuf++, len!=0, timeout);
-    }
+    if (pio_i2c_stream_timeout(NULL, rxbuf, len, timeout)) return HWI2C_TIMEOUT;
 
     if (pio_i2c_stop_timeout(timeout)) return HWI2C_TIMEOUT;
     if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
@@ -290,21 +417,15 @@ hwi2c_status_t pio_i2c_transaction_array_repeat_start(uint8_t addr, uint8_t* txb
     hwi2c_status_t i2c_result = pio_i2c_write_timeout(addr, timeout);
     if(i2c_result != HWI2C_OK) return i2c_result;
     
-    while (txlen) {
-        --txlen;
-        i2c_result = pio_i2c_write_timeout(*txbuf++, timeout);
-        if(i2c_result != HWI2C_OK) return i2c_result;
-    }
+    i2c_result = pio_i2c_stream_timeout(txbuf, NULL, txlen, timeout);
+    if(i2c_result != HWI2C_OK) return i2c_result;
 
     if(pio_i2c_restart_timeout(timeout)) return HWI2C_TIMEOUT;
 
     i2c_result = pio_i2c_write_timeout(addr|1u, timeout); //note, don't force the last bit high, its mysterious
     if(i2c_result != HWI2C_OK) return i2c_result;
 
-    while(rxlen){
-        --rxlen;
-        pio_i2c_read_timeout(rxbuf++, rxlen!=0, timeout);
-    }
+    if (pio_i2c_stream_timeout(NULL, rxbuf, rxlen, timeout)) return HWI2C_TIMEOUT;
 
     if (pio_i2c_stop_timeout(timeout)) return HWI2C_TIMEOUT;
     if (pio_i2c_wait_idle_timeout(timeout)) return HWI2C_TIMEOUT;
@@ -321,14 +442,8 @@ bool i2c_write_reg(uint8_t addr, uint8_t *reg, uint8_t reg_len, const uint8_t *d
     hwi2c_status_t i2c_result = pio_i2c_write_timeout(addr, timeout);
     if(i2c_result != HWI2C_OK) return true;
 
-    for(uint8_t i = 0; i < reg_len; i++) {
-        i2c_result = pio_i2c_write_timeout(reg[i], timeout);
-        if(i2c_result != HWI2C_OK) return true;
-    }
-    for(uint8_t i = 0; i < data_len; i++) {
-        i2c_result = pio_i2c_write_timeout(data[i], timeout);
-        if(i2c_result != HWI2C_OK) return true;
-    }
+    if (pio_i2c_stream_timeout(reg, NULL, reg_len, timeout)) return true;
+    if (pio_i2c_stream_timeout(data, NULL, data_len, timeout)) return true;
     if (pio_i2c_stop_timeout(timeout)) return true;
     if (pio_i2c_wait_idle_extern(timeout)) return true;
     return false;
@@ -340,10 +455,7 @@ bool i2c_read_reg(uint8_t addr, uint8_t *reg, uint8_t reg_len, uint8_t *data, ui
     hwi2c_status_t i2c_result = pio_i2c_write_timeout(addr, timeout);
     if(i2c_result != HWI2C_OK) return true;
 
-    for(uint8_t i = 0; i < reg_len; i++) {
-        i2c_result = pio_i2c_write_timeout(reg[i], timeout);
-        if(i2c_result != HWI2C_OK) return true;
-    }
+    if (pio_i2c_stream_timeout(reg, NULL, reg_len, timeout)) return true;
     
     if(pio_i2c_stop_timeout(timeout)) return true;
     busy_wait_ms(2);
@@ -353,10 +465,7 @@ bool i2c_read_reg(uint8_t addr, uint8_t *reg, uint8_t reg_len, uint8_t *data, ui
     i2c_result = pio_i2c_write_timeout(addr|1u, timeout); //note, don't force the last bit high, its mysterious
     if(i2c_result != HWI2C_OK) return true;
 
-    while(data_len){
-        --data_len;
-        pio_i2c_read_timeout(data++, data_len!=0, timeout);
-    }
+    if (pio_i2c_stream_timeout(NULL, data, data_len, timeout)) return true;
 
     if (pio_i2c_stop_timeout(timeout)) return true;
     if (pio_i2c_wait_idle_extern(timeout)) return true;
@@ -26,6 +26,15 @@ typedef enum {
     HWI2C_TIMEOUT = 2   ///< Timeout waiting for bus or slave
 } hwi2c_status_t;
 
+/**
+ * @brief Bus use of the last streamed array transfer.
+ */
+struct pio_i2c_bus_stats {
+    uint32_t bytes;    ///< Bytes clocked
+    uint32_t us;       ///< Time from the first byte queued to the last byte received
+    uint32_t ideal_us; ///< Time the bytes take back to back at the bus speed
+};
+
 /**
  * @brief Initialize I2C PIO and state machine.
  * @param sda            GPIO pin for I2C SDA (data)
@@ -180,6 +189,26 @@ hwi2c_status_t pio_i2c_transaction_array_timeout(
     uint8_t addr, uint8_t* txbuf, uint txlen, uint8_t* rxbuf, uint rxlen, uint32_t timeout);
 hwi2c_status_t pio_i2c_transaction_array_repeat_start(uint8_t addr, uint8_t* txbuf, uint txlen, uint8_t* rxbuf, uint rxlen, uint32_t timeout);
 hwi2c_status_t pio_i2c_wait_idle_extern(uint32_t timeout) ;
+
+/**
+ * @brief Get the bus use of the last array transfer.
+ * @details ideal_us / us is the bus utilisation, the rest is the gap between bytes.
+ * @param[out] stats  Filled with the last transfer
+ */
+void pio_i2c_get_bus_stats(struct pio_i2c_bus_stats* stats);
+
+/**
+ * @brief Probe a range of 8 bit (address + R/W) addresses in one pass.
+ * @details START, address, STOP for each address, read addresses clock one byte
+ *          and NACK it. The sequences are queued back to back, so the scan runs
+ *          at bus speed.
+ * @param first    First 8 bit address
+ * @param last     Last 8 bit address, inclusive
+ * @param[out] ack_map  256 bit map (8 words), bit n set when address n ACKed
+ * @param timeout  Timeout in loop iterations without progress
+ * @return HWI2C_OK or HWI2C_TIMEOUT (bus stuck, state machine reset)
+ */
+hwi2c_status_t pio_i2c_scan_timeout(uint8_t first, uint8_t last, uint32_t* ack_map, uint32_t timeout);
 //hwi2c_status_t pio_i2c_transaction_bpio(uint8_t* txbuf, uint txlen, uint8_t* rxbuf, uint rxlen, uint32_t timeout);
 // ----------------------------------------------------------------------------
 // Low-level functions
@@ -0,0 +1,148 @@
+/**
+ * @file hwuart_rx.c
+ * @brief Interrupt fed RX ring for the hardware UART mode.
+ * @details The RX interrupt fires at the FIFO threshold and on the RX timeout
+ *          (32 bit periods of idle with data in the FIFO). The handler reads
+ *          the whole FIFO, so bytes that come out together arrived less than
+ *          a timeout apart. Their timestamps are worked back from the time
+ *          the FIFO was emptied, one character time per byte.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+#include "hardware/irq.h"
+#include "pirate.h"
+#include "pirate/bio.h"
+#include "pirate/hwuart_rx.h"
+
+// stop the sender (RTS high) when the ring has less than two hardware FIFOs of room
+#define HWUART_RX_RTS_HEADROOM 64u
+
+static uint8_t ring_data_buf[HWUART_RX_RING_SIZE];
+static uint32_t ring_ts_buf[HWUART_RX_RING_SIZE];
+static uint8_t* ring_data; // NULL while stopped
+static uint32_t* ring_ts;
+static volatile uint32_t ring_head; // written by the interrupt
+static volatile uint32_t ring_tail; // written by hwuart_rx_get()
+static uint32_t char_us;
+static uint32_t rx_timeout_us;
+static bool rts_flow;
+static volatile bool rts_stopped;
+static struct hwuart_rx_stats stats;
+
+static inline uint irq_num(void) {
+    return UART0_IRQ + uart_get_index(M_UART_PORT);
+}
+
+static void hwuart_rx_irq(void) {
+    uart_hw_t* hw = uart_get_hw(M_UART_PORT);
+    bool rx_timeout = hw->mis & UART_UARTMIS_RTMIS_BITS;
+    uint8_t buf[32];
+    uint8_t n = 0;
+    while (!(hw->fr & UART_UARTFR_RXFE_BITS) && n < sizeof(buf)) {
+        uint32_t dr = hw->dr;
+        if (dr & UART_UARTDR_OE_BITS) {
+            stats.overruns++;
+        }
+        if (dr & (UART_UARTDR_BE_BITS | UART_UARTDR_PE_BITS | UART_UARTDR_FE_BITS)) {
+            stats.errors++;
+        }
+        buf[n++] = (uint8_t)dr;
+    }
+    // the RX timeout fires 32 bit periods after the last byte
+    uint32_t last_us = time_us_32() - (rx_timeout ? rx_timeout_us : 0);
+
+    uint32_t head = ring_head;
+    for (uint8_t i = 0; i < n; i++) {
+        if (head - ring_tail >= HWUART_RX_RING_SIZE) {
+            stats.dropped += n - i;
+            break;
+        }
+        ring_data[head & (HWUART_RX_RING_SIZE - 1)] = buf[i];
+        ring_ts[head & (HWUART_RX_RING_SIZE - 1)] = last_us - (n - 1 - i) * char_us;
+        head++;
+        stats.bytes++;
+    }
+    ring_head = head;
+
+    uint32_t fill = head - ring_tail;
+    if (fill > stats.max_fill) {
+        stats.max_fill = fill;
+    }
+    if (rts_flow && !rts_stopped && (HWUART_RX_RING_SIZE - fill) < HWUART_RX_RTS_HEADROOM) {
+        bio_put(M_UART_RTS, 1); // not ready
+        rts_stopped = true;
+    }
+}
+
+bool hwuart_rx_start(uint32_t baud, uint8_t bits_per_char, bool flow_control) {
+    if (ring_data) {
+        return true;
+    }
+    irq_handler_t handler = irq_get_exclusive_handler(irq_num());
+    if (handler && handler != hwuart_rx_irq) {
+        return false; // the terminal is on this UART
+    }
+    ring_ts = ring_ts_buf;
+    ring_data = ring_data_buf;
+    ring_head = 0;
+    ring_tail = 0;
+    stats = (struct hwuart_rx_stats){ 0 };
+    char_us = baud ? (bits_per_char * 1000000u) / baud : 0;
+    rx_timeout_us = baud ? (32u * 1000000u) / baud : 0;
+    rts_flow = flow_control;
+    rts_stopped = false;
+
+    irq_set_exclusive_handler(irq_num(), hwuart_rx_irq);
+    irq_set_enabled(irq_num(), true);
+    uart_set_irq_enables(M_UART_PORT, true, false);
+    if (rts_flow) {
+        bio_put(M_UART_RTS, 0); // ready to receive
+    }
+    return true;
+}
+
+void hwuart_rx_stop(void) {
+    if (!ring_data) {
+        return;
+    }
+    uart_set_irq_enables(M_UART_PORT, false, false);
+    irq_set_enabled(irq_num(), false);
+    irq_remove_handler(irq_num(), hwuart_rx_irq);
+    if (rts_flow) {
+        bio_put(M_UART_RTS, 1);
+    }
+    ring_data = NULL;
+    ring_ts = NULL;
+}
+
+bool hwuart_rx_active(void) {
+    return ring_data != NULL;
+}
+
+uint32_t hwuart_rx_available(void) {
+    return ring_data ? ring_head - ring_tail : 0;
+}
+
+bool hwuart_rx_get(uint8_t* c, uint32_t* timestamp_us) {
+    if (!hwuart_rx_available()) {
+        return false;
+    }
+    uint32_t tail = ring_tail;
+    *c = ring_data[tail & (HWUART_RX_RING_SIZE - 1)];
+    if (timestamp_us) {
+        *timestamp_us = ring_ts[tail & (HWUART_RX_RING_SIZE - 1)];
+    }
+    ring_tail = tail + 1;
+
+    if (rts_stopped && hwuart_rx_available() < HWUART_RX_RING_SIZE / 2) {
+        rts_stopped = false;
+        bio_put(M_UART_RTS, 0); // ready again
+    }
+    return true;
+}
+
+void hwuart_rx_get_stats(struct hwuart_rx_stats* s) {
+    *s = stats;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file hwuart_rx.h
+ * @brief Interrupt fed RX ring for the hardware UART mode.
+ * @details The UART RX interrupt moves bytes from the 32 byte hardware FIFO
+ *          into a ring, so the FIFO doesn't overrun while core0 is busy
+ *          printing. The ring is its own static buffer, the big buffer stays
+ *          free for the logic analyzer and SUMP during an async session.
+ *          Each byte can carry a microsecond timestamp for inter-byte gap
+ *          framing.
+ */
+
+#ifndef _HWUART_RX_H
+#define _HWUART_RX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HWUART_RX_RING_SIZE 1024u // bytes, power of 2, 10ms at 1Mbaud, RTS flow control covers longer stalls
+
+struct hwuart_rx_stats {
+    uint32_t bytes;    // received into the ring
+    uint32_t overruns; // hardware FIFO overruns (UART OE flag)
+    uint32_t dropped;  // bytes lost because the ring was full
+    uint32_t errors;   // framing, parity and break errors
+    uint32_t max_fill; // most bytes waiting in the ring
+};
+
+/**
+ * @brief Start the RX interrupt.
+ * @param baud          Actual baud rate, used to time stamp bytes that arrive together
+ * @param bits_per_char Start, data, parity and stop bits
+ * @param flow_control  Drive RTS from the ring fill level
+ * @return false if the UART interrupt is in use
+ */
+bool hwuart_rx_start(uint32_t baud, uint8_t bits_per_char, bool flow_control);
+
+/**
+ * @brief Stop the RX interrupt.
+ * @note Bytes still in the ring are discarded.
+ */
+void hwuart_rx_stop(void);
+
+/**
+ * @brief The RX ring is running.
+ */
+bool hwuart_rx_active(void);
+
+/**
+ * @brief Take the oldest byte from the ring.
+ * @param[out] c  Received byte
+ * @param[out] timestamp_us  time_us_32() at the end of the byte's stop bit, may be NULL
+ * @return false if the ring is empty
+ */
+bool hwuart_rx_get(uint8_t* c, uint32_t* timestamp_us);
+
+/**
+ * @brief Bytes waiting in the ring.
+ */
+uint32_t hwuart_rx_available(void);
+
+/**
+ * @brief Get the ring statistics, kept until the next hwuart_rx_start().
+ */
+void hwuart_rx_get_stats(struct hwuart_rx_stats* stats);
+
+#endif
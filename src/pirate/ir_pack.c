@@ -0,0 +1,226 @@
+/**
+ * @file ir_pack.c
+ * @brief Compact storage format for infrared MARK/SPACE pulse trains.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include "pirate/ir_pack.h"
+
+static uint32_t dict[IR_PACK_MAX_PAIRS];
+
+static uint8_t* put_varint(uint8_t* p, uint32_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static uint32_t varint_len(uint32_t v) {
+    uint32_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static bool get_varint(const uint8_t** p, const uint8_t* end, uint32_t* v) {
+    uint32_t r = 0;
+    for (uint32_t shift = 0; shift < 35; shift += 7) {
+        if (*p >= end) {
+            return false;
+        }
+        uint8_t b = *(*p)++;
+        r |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            *v = r;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+static inline uint32_t bit_width(uint32_t v) {
+    return v ? 32 - __builtin_clz(v) : 0;
+}
+
+// sorted distinct pairs in dict, returns the number of entries
+static uint32_t dict_build(const uint32_t* pairs, uint32_t count) {
+    uint32_t entries = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t j = entries;
+        while (j > 0 && dict[j - 1] > pairs[i]) {
+            j--;
+        }
+        if (j > 0 && dict[j - 1] == pairs[i]) {
+            continue;
+        }
+        memmove(&dict[j + 1], &dict[j], (entries - j) * sizeof(dict[0]));
+        dict[j] = pairs[i];
+        entries++;
+    }
+    return entries;
+}
+
+static uint32_t dict_index(uint32_t entries, uint32_t pair) {
+    uint32_t lo = 0, hi = entries;
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (dict[mid] <= pair) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+uint32_t ir_pack_encode(const struct ir_pack_frame* frame, const uint32_t* pairs, uint8_t* out) {
+    uint32_t count = frame->count;
+    if (count == 0 || count > IR_PACK_MAX_PAIRS) {
+        return 0;
+    }
+
+    uint32_t plain = 0;
+    int32_t mark = 0, space = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        plain += varint_len(zigzag((int32_t)(pairs[i] >> 16) - mark));
+        plain += varint_len(zigzag((int32_t)(pairs[i] & 0xffff) - space));
+        mark = pairs[i] >> 16;
+        space = pairs[i] & 0xffff;
+    }
+
+    uint32_t entries = dict_build(pairs, count);
+    uint32_t bits = bit_width(entries - 1);
+    uint32_t packed = (count * bits + 7) / 8;
+    mark = 0;
+    for (uint32_t i = 0; i < entries; i++) {
+        packed += varint_len((dict[i] >> 16) - mark) + varint_len(dict[i] & 0xffff);
+        mark = dict[i] >> 16;
+    }
+    if (packed + varint_len(entries) >= plain + 1) {
+        entries = 0;
+    }
+
+    uint8_t* p = out;
+    p = put_varint(p, frame->carrier_hz);
+    p = put_varint(p, frame->tick_us);
+    p = put_varint(p, count);
+    p = put_varint(p, entries);
+
+    mark = 0;
+    space = 0;
+    if (!entries) {
+        for (uint32_t i = 0; i < count; i++) {
+            p = put_varint(p, zigzag((int32_t)(pairs[i] >> 16) - mark));
+            p = put_varint(p, zigzag((int32_t)(pairs[i] & 0xffff) - space));
+            mark = pairs[i] >> 16;
+            space = pairs[i] & 0xffff;
+        }
+        return p - out;
+    }
+
+    for (uint32_t i = 0; i < entries; i++) {
+        p = put_varint(p, (dict[i] >> 16) - mark);
+        p = put_varint(p, dict[i] & 0xffff);
+        mark = dict[i] >> 16;
+    }
+    uint32_t acc = 0, acc_bits = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        acc = (acc << bits) | dict_index(entries, pairs[i]);
+        acc_bits += bits;
+        while (acc_bits >= 8) {
+            acc_bits -= 8;
+            *p++ = (uint8_t)(acc >> acc_bits);
+        }
+    }
+    if (acc_bits) {
+        *p++ = (uint8_t)(acc << (8 - acc_bits));
+    }
+    return p - out;
+}
+
+uint32_t ir_pack_decode(const uint8_t* in, uint32_t len, struct ir_pack_frame* frame, uint32_t* pairs, uint32_t max_pairs) {
+    const uint8_t* p = in;
+    const uint8_t* end = in + len;
+    uint32_t entries;
+
+    if (!get_varint(&p, end, &frame->carrier_hz) || !get_varint(&p, end, &frame->tick_us) ||
+        !get_varint(&p, end, &frame->count) || !get_varint(&p, end, &entries)) {
+        return 0;
+    }
+    uint32_t count = frame->count;
+    if (count == 0 || count > max_pairs || count > IR_PACK_MAX_PAIRS || entries > count) {
+        return 0;
+    }
+
+    uint32_t mark = 0, space = 0, v;
+    if (!entries) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (!get_varint(&p, end, &v)) {
+                return 0;
+            }
+            mark += unzigzag(v);
+            if (!get_varint(&p, end, &v)) {
+                return 0;
+            }
+            space += unzigzag(v);
+            if (mark > 0xffff || space > 0xffff) {
+                return 0;
+            }
+            pairs[i] = (mark << 16) | space;
+        }
+        return p - in;
+    }
+
+    for (uint32_t i = 0; i < entries; i++) {
+        if (!get_varint(&p, end, &v)) {
+            return 0;
+        }
+        mark += v;
+        if (!get_varint(&p, end, &space)) {
+            return 0;
+        }
+        if (mark > 0xffff || space > 0xffff) {
+            return 0;
+        }
+        dict[i] = (mark << 16) | space;
+    }
+    uint32_t bits = bit_width(entries - 1);
+    if ((uint32_t)(end - p) < (count * bits + 7) / 8) {
+        return 0;
+    }
+    uint32_t acc = 0, acc_bits = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        while (acc_bits < bits) {
+            acc = (acc << 8) | *p++;
+            acc_bits += 8;
+        }
+        acc_bits -= bits;
+        uint32_t index = (acc >> acc_bits) & ((1u << bits) - 1);
+        if (index >= entries) {
+            return 0;
+        }
+        pairs[i] = dict[index];
+    }
+    return p - in;
+}
+
+bool ir_pack_file_name(const char* name) {
+    size_t n = strlen(name);
+    return n > 4 && name[n - 4] == '.' && tolower((unsigned char)name[n - 3]) == 'i' &&
+           tolower((unsigned char)name[n - 2]) == 'r' && tolower((unsigned char)name[n - 1]) == 'z';
+}
@@ -0,0 +1,67 @@
+/**
+ * @file ir_pack.h
+ * @brief Compact storage format for infrared MARK/SPACE pulse trains.
+ * @details One frame is a run of unsigned LEB128 varints:
+ *
+ *          carrier_hz  modulation frequency, 0 if it wasn't measured
+ *          tick_us     duration unit in microseconds, 1 for captures
+ *          count       number of MARK/SPACE pairs
+ *          entries     0 for a plain frame, else the dictionary size
+ *
+ *          Plain: count pairs of zigzag deltas, MARK from the previous MARK
+ *          and SPACE from the previous SPACE, both starting at 0.
+ *
+ *          Dictionary: entries distinct pairs sorted by MARK then SPACE, each
+ *          the MARK delta from the previous entry and the SPACE. Then count
+ *          indexes of bit_width(entries - 1) bits, MSB first, padded to a byte.
+ *          This is the TV-B-Gone code table layout with varint time tables.
+ *
+ *          The encoder writes whichever is shorter. Files start with
+ *          IR_PACK_MAGIC and hold any number of frames back to back.
+ *          Pairs are uint32_t, MARK in the upper 16 bits, as irio_pio uses them.
+ */
+
+#ifndef _IR_PACK_H
+#define _IR_PACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define IR_PACK_MAGIC "IRZ1"
+#define IR_PACK_MAGIC_LEN 4
+#define IR_PACK_MAX_PAIRS 256
+// header varints plus the worst plain frame, two 3 byte deltas per pair
+#define IR_PACK_MAX_FRAME (4 * 5 + IR_PACK_MAX_PAIRS * 6)
+
+struct ir_pack_frame {
+    uint32_t carrier_hz;
+    uint32_t tick_us;
+    uint32_t count; // MARK/SPACE pairs
+};
+
+/**
+ * @brief Encode one frame.
+ * @param frame  Carrier, tick and pair count, count 1 to IR_PACK_MAX_PAIRS
+ * @param pairs  MARK << 16 | SPACE in ticks
+ * @param[out] out  At least IR_PACK_MAX_FRAME bytes
+ * @return Encoded length, 0 if the pair count is out of range
+ */
+uint32_t ir_pack_encode(const struct ir_pack_frame* frame, const uint32_t* pairs, uint8_t* out);
+
+/**
+ * @brief Decode one frame.
+ * @param in   Encoded bytes
+ * @param len  Bytes available, a frame may be followed by more frames
+ * @param[out] frame  Carrier, tick and pair count
+ * @param[out] pairs  MARK << 16 | SPACE in ticks
+ * @param max_pairs   Room in pairs
+ * @return Bytes used, 0 if the frame is cut short, corrupt or has too many pairs
+ */
+uint32_t ir_pack_decode(const uint8_t* in, uint32_t len, struct ir_pack_frame* frame, uint32_t* pairs, uint32_t max_pairs);
+
+/**
+ * @brief The file name ends in .irz, case insensitive.
+ */
+bool ir_pack_file_name(const char* name);
+
+#endif
@@ -11,6 +11,19 @@
 #include "lib/picofreq/picofreq.h"
 #include "pirate/irio_pio.h"
 #include "pirate/bio.h"
+#include "pirate/mem.h"
+
+// Capture rings in the big buffer, which is aligned well past the ring size,
+// so the DMA ring wrap keeps each channel inside its ring. The DMA transfer
+// count gives the number of counts written.
+#define IRIO_RX_RING_BITS 12u // bytes
+#define IRIO_RX_RING_ENTRIES ((1u << IRIO_RX_RING_BITS) / sizeof(uint16_t))
+#define IRIO_RX_ARM 0x0fffffffu // largest count on both chips
+
+enum {
+    IRIO_RING_MARK = 0,
+    IRIO_RING_SPACE,
+};
 
 static struct _pio_config pio_config_rx_mark;
 static struct _pio_config pio_config_rx_space;
@@ -18,6 +31,10 @@ static struct _pio_config pio_config_rx_mod_freq;
 static struct _pio_config pio_config_tx;
 static struct _pio_config pio_config_tx_carrier;
 
+static uint16_t* rx_ring[2];
+static int rx_chan[2] = { -1, -1 };
+static uint32_t rx_tail[2];
+
 void _irio_pio_tx_init(uint pin_tx, float desired_period_us, float mod_freq){
     #define INSTRUCTIONS_PER_CYCLE 2
     // Get the system clock frequency in Hz
@@ -142,18 +159,37 @@ void irio_pio_tx_set_mod_freq(float mod_freq){
     busy_wait_us(1);//takes effect in 3 cycles...
 }
 
+//change the MARK/SPACE time unit, 1us unless set
+void irio_pio_tx_set_tick(float tick_us){
+    float divider = (float)clock_get_hz(clk_sys) * tick_us / (1000000.0f*INSTRUCTIONS_PER_CYCLE);
+    pio_sm_set_clkdiv(pio_config_tx.pio, pio_config_tx.sm, divider);
+}
+
 //sends raw array of 32bit values. 
 //upper 16 bits are the mark, lower 16 bits are the space
 void irio_pio_tx_frame_write(float mod_freq, uint16_t pairs, uint32_t *buffer){
     //configure the PWM for the desired frequency
     irio_pio_tx_set_mod_freq(mod_freq);
 
-    //push the data to the FIFO, in pairs to prevent the transmitter from sticking 'on'
-    for(uint8_t i=0; i<pairs; i++){
-        pio_sm_put_blocking(pio_config_tx.pio, pio_config_tx.sm, buffer[i]);
-    }    
-    //wait for end of transmission
-    if(!pio_sm_wait_idle(pio_config_tx.pio, pio_config_tx.sm, 0xfffff)){
+    //DMA keeps the FIFO fed, the MARK/SPACE timing is all PIO
+    int chan = dma_claim_unused_channel(false);
+    if(chan >= 0){
+        dma_channel_config c = dma_channel_get_default_config(chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pio_get_dreq(pio_config_tx.pio, pio_config_tx.sm, true));
+        dma_channel_configure(chan, &c, &pio_config_tx.pio->txf[pio_config_tx.sm], buffer, pairs, true);
+        dma_channel_wait_for_finish_blocking(chan);
+        dma_channel_unclaim(chan);
+    }else{
+        //push the data to the FIFO, in pairs to prevent the transmitter from sticking 'on'
+        for(uint16_t i=0; i<pairs; i++){
+            pio_sm_put_blocking(pio_config_tx.pio, pio_config_tx.sm, buffer[i]);
+        }
+    }
+    //wait for end of transmission, the FIFO can still hold seconds of 10us ticks
+    if(!pio_sm_wait_idle(pio_config_tx.pio, pio_config_tx.sm, 0xffffff)){
         printf("PIO TX timeout\r\n");
     }
     return;
@@ -298,6 +334,133 @@ bool irio_pio_rx_frame_buf(float *mod_freq, uint16_t *us, uint16_t *pairs, uint3
     return false;
 }
 
+//claim the big buffer and two DMA channels, the MARK and SPACE counters
+//fill rings so no count is lost while a frame is printed or saved
+bool irio_pio_rx_capture_start(void){
+    if(rx_ring[0]) return true;
+    //mem_alloc() prints an error, the caller falls back to the FIFOs quietly
+    if(!mem_available()) return false;
+    uint8_t* buf = mem_alloc(2 * (1u << IRIO_RX_RING_BITS), BP_BIG_BUFFER_IR_CAPTURE);
+    if(!buf) return false;
+    rx_chan[IRIO_RING_MARK] = dma_claim_unused_channel(false);
+    rx_chan[IRIO_RING_SPACE] = dma_claim_unused_channel(false);
+    if(rx_chan[IRIO_RING_MARK] < 0 || rx_chan[IRIO_RING_SPACE] < 0){
+        if(rx_chan[IRIO_RING_MARK] >= 0) dma_channel_unclaim(rx_chan[IRIO_RING_MARK]);
+        rx_chan[IRIO_RING_MARK] = rx_chan[IRIO_RING_SPACE] = -1;
+        mem_free(buf);
+        return false;
+    }
+    rx_ring[IRIO_RING_MARK] = (uint16_t*)buf;
+    rx_ring[IRIO_RING_SPACE] = (uint16_t*)(buf + (1u << IRIO_RX_RING_BITS));
+
+    const struct _pio_config* cfg[2] = { &pio_config_rx_mark, &pio_config_rx_space };
+    for(uint8_t i=0; i<2; i++){
+        //the counters are 16 bits, the low half of the FIFO word
+        dma_channel_config c = dma_channel_get_default_config(rx_chan[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_ring(&c, true, IRIO_RX_RING_BITS);
+        channel_config_set_dreq(&c, pio_get_dreq(cfg[i]->pio, cfg[i]->sm, false));
+        dma_channel_configure(rx_chan[i], &c, rx_ring[i], (io_rw_16*)&cfg[i]->pio->rxf[cfg[i]->sm], IRIO_RX_ARM, true);
+        rx_tail[i] = 0;
+    }
+    return true;
+}
+
+void irio_pio_rx_capture_stop(void){
+    if(!rx_ring[0]) return;
+    for(uint8_t i=0; i<2; i++){
+        dma_channel_abort(rx_chan[i]);
+        dma_channel_unclaim(rx_chan[i]);
+        rx_chan[i] = -1;
+    }
+    mem_free((uint8_t*)rx_ring[IRIO_RING_MARK]);
+    rx_ring[IRIO_RING_MARK] = rx_ring[IRIO_RING_SPACE] = NULL;
+}
+
+static inline uint32_t irio_capture_head(uint8_t ring){
+    return IRIO_RX_ARM - dma_channel_hw_addr(rx_chan[ring])->transfer_count;
+}
+
+//next count from a ring, counts the ring has already overwritten are skipped
+static bool irio_capture_get(uint8_t ring, uint16_t *count){
+    uint32_t head = irio_capture_head(ring);
+    if(rx_tail[ring] == head) return false;
+    if(head - rx_tail[ring] > IRIO_RX_RING_ENTRIES){
+        rx_tail[ring] = head - IRIO_RX_RING_ENTRIES;
+    }
+    *count = rx_ring[ring][rx_tail[ring] & (IRIO_RX_RING_ENTRIES - 1)];
+    rx_tail[ring]++;
+    return true;
+}
+
+//drop everything in the rings for sync
+void irio_pio_rx_capture_drain(void){
+    if(!rx_ring[0]) return;
+    rx_tail[IRIO_RING_MARK] = irio_capture_head(IRIO_RING_MARK);
+    rx_tail[IRIO_RING_SPACE] = irio_capture_head(IRIO_RING_SPACE);
+}
+
+//same framing as irio_pio_rx_frame_buf(), reading the capture rings instead of the FIFOs
+//the frame also ends when max_pairs are captured
+bool irio_pio_rx_capture_frame(float *mod_freq, uint16_t *us, uint16_t *pairs, uint32_t *buffer, uint16_t max_pairs) {
+    enum {
+        AIR_RESET,
+        AIR_IDLE,
+        AIR_MARK,
+        AIR_SPACE
+    };
+
+    static uint8_t state = AIR_RESET;
+    uint16_t temp;
+
+    switch(state){
+        case AIR_RESET:
+            irio_pio_rx_reset_mod_freq();
+            state = AIR_IDLE;
+            break;
+        case AIR_IDLE:
+            //when IDLE, drop any SPACE counts
+            rx_tail[IRIO_RING_SPACE] = irio_capture_head(IRIO_RING_SPACE);
+            if(irio_capture_get(IRIO_RING_MARK, &temp)){
+                if(temp!=0xffff) temp=(uint16_t)(0xffff-temp);
+                *pairs=0;
+                buffer[*pairs] = temp<<16;
+                state = AIR_SPACE;
+            }
+            break;
+        case AIR_SPACE:
+            if(irio_capture_get(IRIO_RING_SPACE, &temp)){
+                if(temp!=0xffff) temp=(uint16_t)(0xffff-temp);
+                buffer[*pairs] |= temp;
+                (*pairs)++;
+                if(temp==0xffff || *pairs>=max_pairs){
+                    irio_pio_get_freq_mod(mod_freq, us);
+                    state = AIR_RESET; //timeout, note final space and go to idle
+                    return true;
+                }
+                state = AIR_MARK;
+            }
+            break;
+        case AIR_MARK:
+            //last was space, if another space, end of sequence
+            if(irio_capture_get(IRIO_RING_SPACE, &temp)){
+                irio_pio_get_freq_mod(mod_freq, us);
+                state = AIR_RESET;
+                return true;
+            }
+            if(irio_capture_get(IRIO_RING_MARK, &temp)){
+                if(temp!=0xffff) temp=(uint16_t)(0xffff-temp);
+                buffer[*pairs] = temp<<16;
+                state = AIR_SPACE;
+            }
+            break;
+    }
+
+    return false;
+}
+
 //On timeout, the PIO program increments the counter from 0 to 0xffff
 //however there is no such issue during a normal transition
 //so only reincrement on timeout
@@ -83,3 +83,37 @@ bool irio_pio_rx_frame_buf(float *mod_freq, uint16_t *us, uint16_t *pairs, uint3
  * @brief Reset receiver modulation frequency detection.
  */
 void irio_pio_rx_reset_mod_freq(void);
+
+/**
+ * @brief Set the MARK/SPACE time unit of the transmitter.
+ * @param tick_us  Microseconds per count, 1 after irio_pio_tx_init()
+ */
+void irio_pio_tx_set_tick(float tick_us);
+
+/**
+ * @brief Capture MARK/SPACE counts into rings in the big buffer by DMA.
+ * @return false if the big buffer or two DMA channels are not available
+ * @note Call after irio_pio_rx_init(), use irio_pio_rx_capture_frame() to read frames.
+ */
+bool irio_pio_rx_capture_start(void);
+
+/**
+ * @brief Stop the capture DMA and release the big buffer.
+ */
+void irio_pio_rx_capture_stop(void);
+
+/**
+ * @brief Drop all captured counts.
+ */
+void irio_pio_rx_capture_drain(void);
+
+/**
+ * @brief Receive IR frame from the capture rings.
+ * @param mod_freq   Output modulation frequency
+ * @param us         Output microseconds
+ * @param pairs      Output number of pairs
+ * @param buffer     Frame data buffer
+ * @param max_pairs  Room in buffer, the frame ends when it is full
+ * @return           true when a frame is complete
+ */
+bool irio_pio_rx_capture_frame(float *mod_freq, uint16_t *us, uint16_t *pairs, uint32_t *buffer, uint16_t max_pairs);
@@ -0,0 +1,317 @@
+/**
+ * @file jtag_pio.c
+ * @brief JTAG/SWD shift engine using PIO and DMA.
+ * @details The state machine waits at pull between shifts, so the CPU can
+ *          move the out/in pins and exec set instructions on TMS without
+ *          stopping it. Each shift writes the bit count, then the data bytes
+ *          go through the TX FIFO and come back through the RX FIFO, see
+ *          jtag.pio for the FIFO layout.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "pirate.h"
+#include "pio_config.h"
+#include "pirate/bio.h"
+#include "pirate/jtag_pio.h"
+#include "jtag.pio.h"
+
+#define JTAG_DMA_MIN_BYTES 8 // shorter shifts aren't worth setting up DMA
+
+#define JTAG_TCK M_SPI_CLK
+#define JTAG_TDI M_SPI_CDO
+#define JTAG_TDO M_SPI_CDI
+#define JTAG_TMS M_SPI_CS
+
+static struct _pio_config pio_config;
+static bool running;
+static uint32_t pio_freq;
+static bool pio_swd;
+static bool swdio_output;
+
+static inline uint32_t jtag_bits_to_bytes(uint32_t bits) {
+    return (bits + 7) / 8;
+}
+
+// the partial last byte, or nothing if the bit count is a multiple of 8
+static void jtag_pio_finish(uint8_t* tdo, uint32_t bits) {
+    uint32_t last = pio_sm_get_blocking(pio_config.pio, pio_config.sm);
+    uint32_t rem = bits % 8;
+    if (tdo && rem) {
+        tdo[bits / 8] = (uint8_t)(last >> (32 - rem));
+    }
+}
+
+static bool jtag_pio_run_dma(const uint8_t* tdi, uint8_t* tdo, uint32_t bits) {
+    static const uint8_t ones = 0xff;
+    static uint8_t discard;
+    PIO pio = pio_config.pio;
+    uint sm = pio_config.sm;
+
+    int tx_chan = dma_claim_unused_channel(false);
+    int rx_chan = dma_claim_unused_channel(false);
+    if (tx_chan < 0 || rx_chan < 0) {
+        if (tx_chan >= 0) {
+            dma_channel_unclaim(tx_chan);
+        }
+        return false;
+    }
+
+    pio_sm_put_blocking(pio, sm, bits - 1);
+
+    // whole bytes from the top byte lane, the partial byte is read by the CPU
+    dma_channel_config c = dma_channel_get_default_config(rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, tdo != NULL);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    dma_channel_configure(rx_chan, &c, tdo ? tdo : &discard, (io_rw_8*)&pio->rxf[sm] + 3, bits / 8, false);
+
+    // byte writes are replicated to all lanes, the low 8 bits shift out
+    c = dma_channel_get_default_config(tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, tdi != NULL);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(tx_chan, &c, &pio->txf[sm], tdi ? tdi : &ones, jtag_bits_to_bytes(bits), false);
+
+    dma_start_channel_mask((1u << rx_chan) | (1u << tx_chan));
+    dma_channel_wait_for_finish_blocking(rx_chan);
+    jtag_pio_finish(tdo, bits);
+    dma_channel_wait_for_finish_blocking(tx_chan);
+
+    dma_channel_unclaim(tx_chan);
+    dma_channel_unclaim(rx_chan);
+    return true;
+}
+
+static void jtag_pio_run(const uint8_t* tdi, uint8_t* tdo, uint32_t bits) {
+    PIO pio = pio_config.pio;
+    uint sm = pio_config.sm;
+
+    if (!bits) {
+        return;
+    }
+    if (bits / 8 >= JTAG_DMA_MIN_BYTES && jtag_pio_run_dma(tdi, tdo, bits)) {
+        return;
+    }
+
+    pio_sm_put_blocking(pio, sm, bits - 1);
+    uint32_t tx_bytes = jtag_bits_to_bytes(bits);
+    uint32_t rx_bytes = bits / 8;
+    uint32_t tx = 0, rx = 0;
+    while (rx < rx_bytes) {
+        if (tx < tx_bytes && !pio_sm_is_tx_fifo_full(pio, sm)) {
+            pio_sm_put(pio, sm, tdi ? tdi[tx] : 0xff);
+            tx++;
+        }
+        if (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+            uint8_t b = (uint8_t)(pio_sm_get(pio, sm) >> 24);
+            if (tdo) {
+                tdo[rx] = b;
+            }
+            rx++;
+        }
+    }
+    while (tx < tx_bytes) {
+        pio_sm_put_blocking(pio, sm, tdi ? tdi[tx] : 0xff);
+        tx++;
+    }
+    jtag_pio_finish(tdo, bits);
+}
+
+static inline void jtag_pio_set_tms(bool high) {
+    pio_sm_exec(pio_config.pio, pio_config.sm, pio_encode_set(pio_pins, high ? 1 : 0));
+}
+
+static void swd_pio_swdio_dir(bool output) {
+    if (output == swdio_output) {
+        return;
+    }
+    // same order as bio_output()/bio_input(), never drive against the target
+    if (output) {
+        bio_buf_output(JTAG_TMS);
+        pio_sm_exec(pio_config.pio, pio_config.sm, pio_encode_set(pio_pindirs, 1));
+    } else {
+        pio_sm_exec(pio_config.pio, pio_config.sm, pio_encode_set(pio_pindirs, 0));
+        bio_buf_input(JTAG_TMS);
+    }
+    swdio_output = output;
+}
+
+void jtag_pio_start(uint32_t freq, bool swd) {
+    if (freq > JTAG_PIO_MAX_FREQ) {
+        freq = JTAG_PIO_MAX_FREQ;
+    }
+    if (freq == 0) {
+        freq = 1000000;
+    }
+    if (running && freq == pio_freq && swd == pio_swd) {
+        return;
+    }
+    jtag_pio_stop();
+
+    // resets inactive
+    bio_output(BIO2);
+    bio_put(BIO2, 1);
+    bio_output(BIO3);
+    bio_put(BIO3, 1);
+
+    bio_buf_output(JTAG_TCK);
+    bio_buf_output(JTAG_TDI);
+    bio_buf_input(JTAG_TDO);
+    bio_buf_output(JTAG_TMS);
+
+    pio_config.pio = PIO_MODE_PIO;
+    pio_config.sm = 0;
+    pio_config.program = &jtag_shift_program;
+    pio_config.offset = pio_add_program(pio_config.pio, pio_config.program);
+#ifdef BP_PIO_SHOW_ASSIGNMENT
+    printf("PIO: pio=%d, sm=%d, offset=%d\r\n", PIO_NUM(pio_config.pio), pio_config.sm, pio_config.offset);
+#endif
+    jtag_shift_program_init(pio_config.pio,
+                            pio_config.sm,
+                            pio_config.offset,
+                            bio2bufiopin[JTAG_TCK],
+                            bio2bufiopin[JTAG_TDI],
+                            bio2bufiopin[JTAG_TDO],
+                            bio2bufiopin[JTAG_TMS],
+                            freq);
+    swdio_output = true;
+    if (swd) {
+        // SWDIO is both the out and the in pin
+        pio_sm_set_out_pins(pio_config.pio, pio_config.sm, bio2bufiopin[JTAG_TMS], 1);
+        pio_sm_set_in_pins(pio_config.pio, pio_config.sm, bio2bufiopin[JTAG_TMS]);
+    }
+
+    pio_freq = freq;
+    pio_swd = swd;
+    running = true;
+}
+
+void jtag_pio_stop(void) {
+    if (!running) {
+        return;
+    }
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, false);
+    pio_remove_program(pio_config.pio, pio_config.program, pio_config.offset);
+
+    const uint8_t pins[] = { JTAG_TCK, JTAG_TDI, JTAG_TDO, JTAG_TMS };
+    for (uint8_t i = 0; i < count_of(pins); i++) {
+        bio_input(pins[i]);
+        gpio_set_function(bio2bufiopin[pins[i]], GPIO_FUNC_SIO);
+    }
+    running = false;
+}
+
+bool jtag_pio_running(void) {
+    return running;
+}
+
+void jtag_pio_tms(const uint8_t* tms, uint32_t bits) {
+    if (pio_swd) {
+        swd_pio_swdio_dir(true);
+        jtag_pio_run(tms, NULL, bits);
+        return;
+    }
+    // TDI holds the level of its last bit while TMS is the out pin
+    pio_sm_set_out_pins(pio_config.pio, pio_config.sm, bio2bufiopin[JTAG_TMS], 1);
+    jtag_pio_run(tms, NULL, bits);
+    pio_sm_set_out_pins(pio_config.pio, pio_config.sm, bio2bufiopin[JTAG_TDI], 1);
+}
+
+void jtag_pio_shift(const uint8_t* tdi, uint8_t* tdo, uint32_t bits, bool exit) {
+    if (!bits) {
+        return;
+    }
+    if (!exit) {
+        jtag_pio_run(tdi, tdo, bits);
+        return;
+    }
+
+    // all but the last bit with TMS low, then the last one with TMS high
+    uint32_t last = bits - 1;
+    jtag_pio_run(tdi, tdo, last);
+    uint8_t in, out = 0xff;
+    if (tdi) {
+        out = (tdi[last / 8] >> (last % 8)) & 1;
+    }
+    jtag_pio_set_tms(true);
+    jtag_pio_run(&out, &in, 1);
+    jtag_pio_set_tms(false);
+    if (tdo) {
+        if (last % 8 == 0) {
+            tdo[last / 8] = in & 1; // first bit of a byte the scan above didn't reach
+        } else {
+            uint8_t mask = 1u << (last % 8);
+            tdo[last / 8] = (tdo[last / 8] & ~mask) | ((in & 1) ? mask : 0);
+        }
+    }
+}
+
+void jtag_pio_reset(void) {
+    static const uint8_t tms = 0x1f; // 5 x 1, 0
+    jtag_pio_tms(&tms, 6);
+}
+
+void jtag_pio_scan(bool ir, const uint8_t* tdi, uint8_t* tdo, uint32_t bits) {
+    static const uint8_t to_shift_ir = 0x03; // 1, 1, 0, 0
+    static const uint8_t to_shift_dr = 0x01; // 1, 0, 0
+    static const uint8_t to_idle = 0x01;     // Exit1: 1, 0
+
+    if (ir) {
+        jtag_pio_tms(&to_shift_ir, 4);
+    } else {
+        jtag_pio_tms(&to_shift_dr, 3);
+    }
+    jtag_pio_shift(tdi, tdo, bits, true);
+    jtag_pio_tms(&to_idle, 2);
+}
+
+void swd_pio_line_reset(void) {
+    static const uint8_t reset[] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03 }; // 50 x 1, 0, 0
+    jtag_pio_tms(reset, 52);
+}
+
+uint8_t swd_pio_transfer(bool ap, bool read, uint8_t addr, uint32_t* data) {
+    // start, APnDP, RnW, A[2:3], parity, stop, park
+    uint8_t request = 0x81 | (ap ? 0x02 : 0) | (read ? 0x04 : 0) | ((addr & 0x0c) << 1);
+    request |= (__builtin_parity(request & 0x1e) ? 0x20 : 0);
+    uint8_t in[5];
+
+    swd_pio_swdio_dir(true);
+    jtag_pio_run(&request, NULL, 8);
+
+    // turnaround and ACK
+    swd_pio_swdio_dir(false);
+    jtag_pio_run(NULL, in, 4);
+    uint8_t ack = (in[0] >> 1) & 0x07;
+
+    if (ack != SWD_ACK_OK) {
+        jtag_pio_run(NULL, NULL, 1); // turnaround
+        swd_pio_swdio_dir(true);
+        return ack;
+    }
+
+    if (read) {
+        jtag_pio_run(NULL, in, 33);
+        jtag_pio_run(NULL, NULL, 1); // turnaround
+        swd_pio_swdio_dir(true);
+        uint32_t value = in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+        if ((uint32_t)__builtin_parity(value) != (in[4] & 1u)) {
+            return SWD_ACK_PARITY_ERROR;
+        }
+        *data = value;
+        return ack;
+    }
+
+    jtag_pio_run(NULL, NULL, 1); // turnaround
+    swd_pio_swdio_dir(true);
+    uint8_t out[5] = { (uint8_t)*data, (uint8_t)(*data >> 8), (uint8_t)(*data >> 16), (uint8_t)(*data >> 24) };
+    out[4] = __builtin_parity(*data) ? 1 : 0;
+    jtag_pio_run(out, NULL, 33);
+    return ack;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file jtag_pio.h
+ * @brief JTAG/SWD shift engine using PIO and DMA.
+ * @details One PIO program shifts bits out on TDI (or TMS, or SWDIO) and
+ *          samples TDO (or SWDIO) on each TCK rising edge. Scans longer than
+ *          a few bytes are fed by two DMA channels, shorter ones by the CPU.
+ *          All bit buffers are LSB first, bit 0 of byte 0 goes out first.
+ *
+ *          JTAG: TCK, TDI, TDO and TMS on the SPI pins.
+ *          SWD: SWCLK on TCK, SWDIO on TMS.
+ */
+
+#ifndef _JTAG_PIO_H
+#define _JTAG_PIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define JTAG_PIO_MAX_FREQ 10000000u
+
+// SWD ACK values, plus a parity error on read data
+#define SWD_ACK_OK 0x1
+#define SWD_ACK_WAIT 0x2
+#define SWD_ACK_FAULT 0x4
+#define SWD_ACK_PARITY_ERROR 0x8
+
+/**
+ * @brief Load the shift program and take over the JTAG pins.
+ * @param freq  TCK frequency in Hz, limited to JTAG_PIO_MAX_FREQ
+ * @param swd   SWD wiring, SWDIO on TMS
+ * @note Does nothing if the engine already runs with the same settings.
+ */
+void jtag_pio_start(uint32_t freq, bool swd);
+
+/**
+ * @brief Stop the engine and release the PIO, safe to call when stopped.
+ */
+void jtag_pio_stop(void);
+
+/**
+ * @brief The engine owns the JTAG pins.
+ */
+bool jtag_pio_running(void);
+
+/**
+ * @brief Clock TMS bits, TDI holds its level. In SWD mode the bits go out on SWDIO.
+ * @param tms   TMS bits
+ * @param bits  Number of bits
+ */
+void jtag_pio_tms(const uint8_t* tms, uint32_t bits);
+
+/**
+ * @brief Shift bits through TDI and TDO in the current TAP state.
+ * @param tdi   Bits to shift out, NULL to shift out 1s
+ * @param[out] tdo  Bits shifted in, NULL to discard
+ * @param bits  Number of bits
+ * @param exit  Raise TMS with the last bit, moving Shift-xR to Exit1-xR
+ */
+void jtag_pio_shift(const uint8_t* tdi, uint8_t* tdo, uint32_t bits, bool exit);
+
+/**
+ * @brief Five TMS high clocks to Test-Logic-Reset, then Run-Test/Idle.
+ */
+void jtag_pio_reset(void);
+
+/**
+ * @brief IR or DR scan from Run-Test/Idle back to Run-Test/Idle.
+ * @param ir    Instruction register, else data register
+ * @param tdi   Bits to shift out, NULL to shift out 1s
+ * @param[out] tdo  Bits shifted in, NULL to discard
+ * @param bits  Register length
+ */
+void jtag_pio_scan(bool ir, const uint8_t* tdi, uint8_t* tdo, uint32_t bits);
+
+/**
+ * @brief SWD line reset: 50 clocks with SWDIO high and 2 idle clocks.
+ */
+void swd_pio_line_reset(void);
+
+/**
+ * @brief One SWD transfer with turnarounds, ACK and data parity.
+ * @param ap    Access port, else debug port
+ * @param read  Read transfer, else write
+ * @param addr  Register address, bits 3:2 are used
+ * @param[in,out] data  Data to write, or data read
+ * @return SWD_ACK_xxx, data is only valid with SWD_ACK_OK
+ */
+uint8_t swd_pio_transfer(bool ap, bool read, uint8_t addr, uint32_t* data);
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file lcd_blit.c
+ * @brief DMA pixel streaming to the LCD.
+ * @details Two line buffers: DMA feeds one to the SPI TX FIFO while the CPU
+ *          expands pixels into the other, so the SPI clock runs back to back
+ *          instead of stopping after every 2 byte pixel write.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "pirate.h"
+#include "pirate/lcd_blit.h"
+
+static uint16_t line_buf[2][LCD_BLIT_LINE_PIXELS];
+static uint8_t line_idx;    // line buffer being filled
+static uint32_t line_count; // pixels in the line buffer being filled
+static int dma_chan = -1;
+
+static void lcd_blit_dma_init(void) {
+    dma_chan = dma_claim_unused_channel(false);
+    if (dma_chan < 0) {
+        return;
+    }
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, spi_get_dreq(BP_SPI_PORT, true));
+    dma_channel_configure(dma_chan, &c, &spi_get_hw(BP_SPI_PORT)->dr, NULL, 0, false);
+}
+
+// start sending a buffer, waits for the previous one to finish loading the FIFO
+static void lcd_blit_send(const uint8_t* data, uint32_t bytes) {
+    if (dma_chan < 0) {
+        spi_write_blocking(BP_SPI_PORT, data, bytes);
+        return;
+    }
+    dma_channel_wait_for_finish_blocking(dma_chan);
+    dma_channel_set_read_addr(dma_chan, data, false);
+    dma_channel_set_trans_count(dma_chan, bytes, true);
+}
+
+static void lcd_blit_flush(void) {
+    if (line_count == 0) {
+        return;
+    }
+    lcd_blit_send((const uint8_t*)line_buf[line_idx], line_count * 2);
+    // lcd_blit_send() waited for the other line, it is free to fill
+    line_idx ^= 1;
+    line_count = 0;
+}
+
+static inline void lcd_blit_put(uint16_t color) {
+    line_buf[line_idx][line_count++] = color;
+    if (line_count == LCD_BLIT_LINE_PIXELS) {
+        lcd_blit_flush();
+    }
+}
+
+void lcd_blit_start(void) {
+    static bool dma_init = false;
+    if (!dma_init) {
+        lcd_blit_dma_init();
+        dma_init = true;
+    }
+    line_idx = 0;
+    line_count = 0;
+}
+
+void lcd_blit_fill(uint16_t color, uint32_t pixels) {
+    while (pixels--) {
+        lcd_blit_put(color);
+    }
+}
+
+void lcd_blit_1bpp(const uint8_t* bits, uint32_t pixels, uint16_t fg, uint16_t bg) {
+    for (uint32_t i = 0; i < pixels; i++) {
+        lcd_blit_put((bits[i >> 3] & (0b10000000 >> (i & 0b111))) ? fg : bg);
+    }
+}
+
+void lcd_blit_4bpp(const uint8_t* packed, uint32_t pixels, const uint16_t* palette) {
+    for (uint32_t i = 0; i < pixels; i += 2) {
+        uint8_t p = *packed++;
+        lcd_blit_put(palette[p & 0xf]);
+        if (i + 1 < pixels) {
+            lcd_blit_put(palette[p >> 4]);
+        }
+    }
+}
+
+void lcd_blit_bytes(const uint8_t* data, uint32_t bytes) {
+    lcd_blit_flush();
+    lcd_blit_send(data, bytes);
+}
+
+void lcd_blit_wait(void) {
+    if (dma_chan >= 0) {
+        dma_channel_wait_for_finish_blocking(dma_chan);
+    }
+}
+
+void lcd_blit_end(void) {
+    lcd_blit_flush();
+    if (dma_chan < 0) {
+        return; // spi_write_blocking() already waited and drained the RX FIFO
+    }
+    dma_channel_wait_for_finish_blocking(dma_chan);
+    while (spi_is_busy(BP_SPI_PORT)) {
+        tight_loop_contents();
+    }
+    // TX only, drain the RX FIFO and clear the overrun flag like spi_write_blocking()
+    while (spi_is_readable(BP_SPI_PORT)) {
+        (void)spi_get_hw(BP_SPI_PORT)->dr;
+    }
+    spi_get_hw(BP_SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file lcd_blit.h
+ * @brief DMA pixel streaming to the LCD.
+ * @details Expands packed pixels into RGB565 line buffers and streams them
+ *          to the LCD with DMA. Use between lcd_set_bounding_box() and the
+ *          end of the memory write, with the SPI bus claimed and LCD CS low:
+ *
+ *          lcd_blit_start(), any number of lcd_blit_*() pixel calls,
+ *          lcd_blit_end() before raising CS.
+ *
+ *          Colors are 16 bit values in LCD byte order (high byte first in
+ *          memory), the same layout as colors_pallet[] and the scope palette.
+ */
+
+#ifndef _LCD_BLIT_H
+#define _LCD_BLIT_H
+
+#include <stdint.h>
+
+#define LCD_BLIT_LINE_PIXELS 320 // pixels per line buffer, one LCD row in landscape
+
+/**
+ * @brief Convert a colors_pallet[] style 2 byte color to a blit color.
+ * @param color  High byte, low byte
+ * @return Color in LCD byte order
+ */
+static inline uint16_t lcd_blit_color(const uint8_t* color) {
+    return (uint16_t)color[0] | ((uint16_t)color[1] << 8);
+}
+
+/**
+ * @brief Start a pixel stream.
+ * @note Claims a DMA channel on first use, falls back to blocking SPI writes if none is free.
+ */
+void lcd_blit_start(void);
+
+/**
+ * @brief Stream a single color.
+ * @param color   Color in LCD byte order
+ * @param pixels  Number of pixels
+ */
+void lcd_blit_fill(uint16_t color, uint32_t pixels);
+
+/**
+ * @brief Stream 1 bit per pixel data, such as a font glyph column.
+ * @param bits    Bitmap, MSB first, continues into the next byte after 8 pixels
+ * @param pixels  Number of pixels
+ * @param fg      Color for 1 bits
+ * @param bg      Color for 0 bits
+ */
+void lcd_blit_1bpp(const uint8_t* bits, uint32_t pixels, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Stream 4 bit per pixel palette data.
+ * @param packed   Two pixels per byte, low nibble first
+ * @param pixels   Number of pixels
+ * @param palette  16 entry palette in LCD byte order
+ */
+void lcd_blit_4bpp(const uint8_t* packed, uint32_t pixels, const uint16_t* palette);
+
+/**
+ * @brief Stream pre-formatted LCD data straight from memory (flash images).
+ * @param data   Pixel data in LCD byte order, must stay valid until lcd_blit_end()
+ * @param bytes  Number of bytes
+ */
+void lcd_blit_bytes(const uint8_t* data, uint32_t bytes);
+
+/**
+ * @brief Wait until the DMA has finished reading memory passed to lcd_blit_bytes().
+ * @note Call before changing that memory in the middle of a stream.
+ */
+void lcd_blit_wait(void);
+
+/**
+ * @brief Send any buffered pixels and wait until the SPI is idle.
+ * @note Must be called before raising LCD CS.
+ */
+void lcd_blit_end(void);
+
+#endif
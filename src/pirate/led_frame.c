@@ -0,0 +1,188 @@
+/**
+ * @file led_frame.c
+ * @brief Whole frame output for WS2812 and APA102 strips in LED mode.
+ * @details Each buffer has room for the APA102 start frame, the LEDs and the
+ *          longest end frame, so a frame is always one DMA transfer. WS2812
+ *          frames skip the start frame word. Once a frame is sent it is
+ *          copied into the other buffer, partial updates build on it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "pirate.h"
+#include "pio_config.h"
+#include "pirate/led_frame.h"
+
+// APA102 needs half a clock per LED after the last one, plus the usual 32 ones
+#define LED_FRAME_END_WORDS(leds) (1 + (leds) / 64)
+#define LED_FRAME_WORDS (1 + LED_FRAME_MAX_LEDS + LED_FRAME_END_WORDS(LED_FRAME_MAX_LEDS))
+
+static uint32_t frame_words[2][LED_FRAME_WORDS];
+static PIO frame_pio;
+static uint frame_sm;
+static enum led_frame_format frame_format;
+static uint32_t* frame_buf[2]; // NULL until led_frame_start()
+static uint8_t back;
+static uint32_t frame_leds;
+static uint32_t frames;
+static int dma_chan = -1;
+static bool on_wire;
+
+static uint8_t lut[256];
+static uint8_t lut_brightness;
+static float lut_gamma;
+
+void led_frame_start(PIO pio, uint sm, enum led_frame_format format) {
+    if (frame_buf[0]) {
+        // a frame in flight is waited for by led_frame_show(), unless it is going to another SM
+        if (pio != frame_pio || sm != frame_sm || format != frame_format) {
+            led_frame_wait();
+        }
+    } else {
+        memset(frame_words, 0, sizeof(frame_words));
+        frame_buf[0] = frame_words[0];
+        frame_buf[1] = frame_words[1];
+        back = 0;
+        frame_leds = 0;
+        frames = 0;
+        lut_gamma = 0.0f; // force a rebuild
+        led_frame_lut(255, 1.0f);
+    }
+    frame_pio = pio;
+    frame_sm = sm;
+    frame_format = format;
+}
+
+void led_frame_stop(void) {
+    if (!frame_buf[0]) {
+        return;
+    }
+    led_frame_wait();
+    frame_buf[0] = NULL;
+    frame_buf[1] = NULL;
+}
+
+bool led_frame_active(void) {
+    return frame_buf[0] != NULL;
+}
+
+void led_frame_lut(uint8_t brightness, float gamma) {
+    if (gamma <= 0.0f) {
+        gamma = 1.0f;
+    }
+    if (brightness == lut_brightness && gamma == lut_gamma) {
+        return;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        lut[i] = (uint8_t)(powf(i / 255.0f, gamma) * brightness + 0.5f);
+    }
+    lut_brightness = brightness;
+    lut_gamma = gamma;
+}
+
+bool led_frame_set(uint32_t leds, uint32_t first, const uint8_t* rgb, uint32_t count) {
+    if (!frame_buf[0]) {
+        return false;
+    }
+    if (leds) {
+        if (leds > LED_FRAME_MAX_LEDS) {
+            return false;
+        }
+        // new LEDs start dark, not with an old end frame
+        if (leds > frame_leds) {
+            memset(&frame_buf[back][1 + frame_leds], 0, (leds - frame_leds) * sizeof(uint32_t));
+        }
+        frame_leds = leds;
+    }
+    if (first > frame_leds || count > frame_leds - first) {
+        return false;
+    }
+
+    uint32_t* p = &frame_buf[back][1 + first];
+    if (frame_format == LED_FRAME_APA102) {
+        for (uint32_t i = 0; i < count; i++, rgb += 3) {
+            p[i] = 0xFF000000u | ((uint32_t)lut[rgb[0]] << 16) | ((uint32_t)lut[rgb[1]] << 8) | lut[rgb[2]];
+        }
+    } else {
+        // the ws2812 program shifts out the top 24 bits
+        for (uint32_t i = 0; i < count; i++, rgb += 3) {
+            p[i] = ((uint32_t)lut[rgb[0]] << 24) | ((uint32_t)lut[rgb[1]] << 16) | ((uint32_t)lut[rgb[2]] << 8);
+        }
+    }
+    return true;
+}
+
+void led_frame_show(void) {
+    if (!frame_buf[0]) {
+        return;
+    }
+    led_frame_wait();
+
+    uint32_t* f = frame_buf[back];
+    const uint32_t* src;
+    uint32_t words;
+    if (frame_format == LED_FRAME_APA102) {
+        f[0] = 0x00000000; // start frame
+        for (uint32_t i = 0; i < LED_FRAME_END_WORDS(frame_leds); i++) {
+            f[1 + frame_leds + i] = 0xFFFFFFFF;
+        }
+        src = f;
+        words = 1 + frame_leds + LED_FRAME_END_WORDS(frame_leds);
+    } else {
+        src = f + 1;
+        words = frame_leds;
+    }
+
+    // the next frame starts as a copy of this one
+    back ^= 1;
+    memcpy(frame_buf[back], f, (1 + frame_leds) * sizeof(uint32_t));
+    frames++;
+    if (!words) {
+        return;
+    }
+    on_wire = true;
+
+    dma_chan = dma_claim_unused_channel(false);
+    if (dma_chan < 0) {
+        for (uint32_t i = 0; i < words; i++) {
+            pio_sm_put_blocking(frame_pio, frame_sm, src[i]);
+        }
+        return;
+    }
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(frame_pio, frame_sm, true));
+    dma_channel_configure(dma_chan, &c, &frame_pio->txf[frame_sm], src, words, true);
+}
+
+void led_frame_wait(void) {
+    if (dma_chan >= 0) {
+        dma_channel_wait_for_finish_blocking(dma_chan);
+        dma_channel_unclaim(dma_chan);
+        dma_chan = -1;
+    }
+    if (!on_wire) {
+        return;
+    }
+    if (!pio_sm_wait_idle(frame_pio, frame_sm, 0xffffff)) {
+        printf("Timeout, error!");
+    }
+    if (frame_format == LED_FRAME_WS2812) {
+        busy_wait_us(65); // >50us delay to reset
+    }
+    on_wire = false;
+}
+
+uint32_t led_frame_leds(void) {
+    return frame_leds;
+}
+
+uint32_t led_frame_count(void) {
+    return frames;
+}
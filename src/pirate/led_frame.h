@@ -0,0 +1,86 @@
+/**
+ * @file led_frame.h
+ * @brief Whole frame output for WS2812 and APA102 strips in LED mode.
+ * @details Frames are built in two static buffers, so the next frame can
+ *          be written while DMA feeds the current one to the LED state
+ *          machine. The big buffer stays free for the logic analyzer.
+ *          Colors pass through a gamma and brightness lookup table as they
+ *          are copied in.
+ */
+
+#ifndef _LED_FRAME_H
+#define _LED_FRAME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/pio.h"
+
+#define LED_FRAME_MAX_LEDS 1024u // 8KB for both buffers
+
+enum led_frame_format {
+    LED_FRAME_WS2812, // 24 bit words, top aligned
+    LED_FRAME_APA102, // start frame, 0xFF brightness byte, end frame
+};
+
+/**
+ * @brief Attach to the LED state machine, the first call clears the frames.
+ * @param pio     PIO running the ws2812 or apa102_mini program
+ * @param sm      State machine
+ * @param format  Word layout for the program
+ * @note The lookup table starts as full brightness, gamma 1.0. A frame still
+ *       on the wire is only waited for if the state machine or format changes.
+ */
+void led_frame_start(PIO pio, uint sm, enum led_frame_format format);
+
+/**
+ * @brief Wait for the frame on the wire and detach.
+ */
+void led_frame_stop(void);
+
+/**
+ * @brief led_frame_start() was called since the last led_frame_stop().
+ */
+bool led_frame_active(void);
+
+/**
+ * @brief Set the lookup table used for the following led_frame_set() calls.
+ * @param brightness  0 to 255, scales every color
+ * @param gamma       1.0 for linear, 2.2 or so for perceived brightness
+ * @note Only rebuilds the table when a setting changes.
+ */
+void led_frame_lut(uint8_t brightness, float gamma);
+
+/**
+ * @brief Copy colors into the next frame.
+ * @param leds   Strip length, 0 to keep the current length
+ * @param first  First LED to update
+ * @param rgb    3 bytes per LED in the order the strip expects, GRB for most WS2812
+ * @param count  Number of LEDs in rgb
+ * @return false if the LEDs don't fit in the strip or LED_FRAME_MAX_LEDS
+ * @note LEDs that are not updated keep the color of the last frame shown.
+ */
+bool led_frame_set(uint32_t leds, uint32_t first, const uint8_t* rgb, uint32_t count);
+
+/**
+ * @brief Send the next frame, returns while DMA moves it to the PIO.
+ * @note Waits for the previous frame and, for WS2812, the reset time first.
+ *       Without a free DMA channel the CPU writes the FIFO and returns when done.
+ */
+void led_frame_show(void);
+
+/**
+ * @brief Wait for the frame on the wire, including the WS2812 reset time.
+ */
+void led_frame_wait(void);
+
+/**
+ * @brief Current strip length.
+ */
+uint32_t led_frame_leds(void);
+
+/**
+ * @brief Frames shown since led_frame_start().
+ */
+uint32_t led_frame_count(void);
+
+#endif
@@ -28,6 +28,10 @@ uint8_t* mem_alloc(size_t size, uint32_t owner) {
     }
 }
 
+bool mem_available(void) {
+    return !allocated;
+}
+
 void mem_free(uint8_t* ptr) {
     if (ptr == mem_buffer) {
         allocated = false;
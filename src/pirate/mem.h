@@ -19,12 +19,16 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <stdbool.h>
 
 enum big_buffer_owners {
     BP_BIG_BUFFER_NONE = 0,
     BP_BIG_BUFFER_SCOPE,
     BP_BIG_BUFFER_LA,
     BP_BIG_BUFFER_DISKFORMAT,
+    BP_BIG_BUFFER_SPIFLASH,
+    BP_BIG_BUFFER_UART_BRIDGE,
+    BP_BIG_BUFFER_IR_CAPTURE,
 };
 
 /// @brief Attempts to allocate a nand page buffer.
@@ -33,6 +37,10 @@ enum big_buffer_owners {
 /// @note Max size: SPI_NAND_PAGE_SIZE + SPI_NAND_OOB_SIZE
 uint8_t* mem_alloc(size_t size, uint32_t owner);
 
+/// @brief Checks the buffer is free without printing an error like mem_alloc()
+/// @return true if mem_alloc() would succeed
+bool mem_available(void);
+
 /// @brief Frees the allocated nand page buffer
 /// @param ptr pointer to the nand page buffer
 void mem_free(uint8_t* ptr);
@@ -0,0 +1,53 @@
+/**
+ * @file perf.c
+ * @brief Timing probes for the hot paths.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pirate/perf.h"
+
+struct perf_probe perf_probes[PERF_PROBE_COUNT] = {
+    [PERF_SYNTAX_OP] = { .name = "syntax op" },
+    [PERF_BPIO_DECODE] = { .name = "bpio decode" },
+    [PERF_BPIO_VERIFY] = { .name = "bpio verify" },
+    [PERF_BPIO_HANDLER] = { .name = "bpio handler" },
+    [PERF_BPIO_SEND] = { .name = "bpio send" },
+    [PERF_USB_TASK] = { .name = "usb task" },
+    [PERF_USB_TX] = { .name = "usb tx" },
+    [PERF_LCD_UPDATE] = { .name = "lcd update" },
+    [PERF_STATUSBAR] = { .name = "statusbar" },
+};
+
+const char* perf_get(enum perf_probe_id id, struct perf_stats* stats) {
+    const struct perf_probe* p = &perf_probes[id];
+    // a sample may land on the other core while this is copied, the numbers
+    // can be one sample apart which is fine for a report
+    uint32_t count = p->count;
+    if (p->reset || count == 0) {
+        stats->count = 0;
+        stats->min_us = 0;
+        stats->max_us = 0;
+        stats->avg_us = 0;
+        return p->name;
+    }
+    stats->count = count;
+    stats->min_us = p->min_us;
+    stats->max_us = p->max_us;
+    stats->avg_us = (uint32_t)(p->total_us / count);
+    return p->name;
+}
+
+void perf_reset(void) {
+    for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+        perf_probes[i].reset = true;
+    }
+}
+
+bool perf_enabled(void) {
+#ifdef BP_PERF_PROBES
+    return true;
+#else
+    return false;
+#endif
+}
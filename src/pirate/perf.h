@@ -0,0 +1,104 @@
+/**
+ * @file perf.h
+ * @brief Timing probes for the hot paths.
+ * @details A probe times the code between PERF_START() and PERF_END() with
+ *          time_us_32() and keeps count/min/max/total in a static table. The
+ *          `perf` command and the BPIO status request dump the table.
+ *
+ *          Probes are compiled in when BP_PERF_PROBES is defined (see
+ *          CMakeLists.txt), otherwise the macros are empty and the table
+ *          stays at zero.
+ */
+
+#ifndef _PERF_H
+#define _PERF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+enum perf_probe_id {
+    PERF_SYNTAX_OP,     // core0: one bytecode instruction in syntax_run()
+    PERF_BPIO_DECODE,   // core0: COBS decode of a BPIO request
+    PERF_BPIO_VERIFY,   // core0: flatbuffer verify
+    PERF_BPIO_HANDLER,  // core0: request handler, includes building and sending the response
+    PERF_BPIO_SEND,     // core0: finalize, COBS encode and queue the response
+    PERF_USB_TASK,      // core1: tud_task() and CDC RX
+    PERF_USB_TX,        // core1: terminal and binmode TX queues
+    PERF_LCD_UPDATE,    // core1: display_lcd_update()
+    PERF_STATUSBAR,     // core1: VT100 status bar update
+    PERF_PROBE_COUNT
+};
+
+struct perf_probe {
+    const char* name;
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    volatile bool reset; // set by perf_reset(), cleared by the core that owns the probe
+};
+
+extern struct perf_probe perf_probes[PERF_PROBE_COUNT];
+
+/**
+ * @brief Add a sample to a probe.
+ * @note Each probe is only ever recorded from one core, so no locking.
+ */
+static inline void perf_record(enum perf_probe_id id, uint32_t us) {
+    struct perf_probe* p = &perf_probes[id];
+    if (p->reset) {
+        p->count = 0;
+        p->max_us = 0;
+        p->total_us = 0;
+        p->reset = false;
+    }
+    if (p->count == 0 || us < p->min_us) {
+        p->min_us = us;
+    }
+    if (us > p->max_us) {
+        p->max_us = us;
+    }
+    p->total_us += us;
+    p->count++;
+}
+
+#ifdef BP_PERF_PROBES
+#define PERF_START(id) uint32_t perf_start_##id = time_us_32()
+#define PERF_END(id) perf_record(id, time_us_32() - perf_start_##id)
+#else
+#define PERF_START(id) \
+    do {               \
+    } while (0)
+#define PERF_END(id) \
+    do {             \
+    } while (0)
+#endif
+
+struct perf_stats {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t avg_us;
+};
+
+/**
+ * @brief Read a probe.
+ * @param id  Probe
+ * @param stats  Filled with the probe statistics, zero after a reset
+ * @return Probe name
+ */
+const char* perf_get(enum perf_probe_id id, struct perf_stats* stats);
+
+/**
+ * @brief Clear all probes.
+ * @details The owning core clears the probe on its next sample, so a reset
+ *          never races a probe that is being recorded on the other core.
+ */
+void perf_reset(void);
+
+/**
+ * @brief Probes are compiled in.
+ */
+bool perf_enabled(void);
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file pinscan_pio.c
+ * @brief Parallel pin scan engine for pinout discovery.
+ * @details The state machine stalls on the TX FIFO between runs with the
+ *          pins holding the last step. Pin directions are only changed
+ *          while it is stopped, the FIFOs and program counter survive.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "pirate.h"
+#include "pio_config.h"
+#include "pirate/bio.h"
+#include "pirate/pinscan_pio.h"
+#include "pinscan.pio.h"
+
+static struct _pio_config pio_config;
+static uint32_t pin_count;
+static uint8_t output_mask;
+static bool running;
+
+void pinscan_pio_start(uint32_t channels, uint32_t step_hz) {
+    pinscan_pio_stop();
+    for (uint8_t i = 0; i < channels; i++) {
+        bio_input(BIO0 + i);
+    }
+
+    pio_config.pio = PIO_MODE_PIO;
+    pio_config.sm = 0;
+    pio_config.program = &pinscan_program;
+    pio_config.offset = pio_add_program(pio_config.pio, pio_config.program);
+#ifdef BP_PIO_SHOW_ASSIGNMENT
+    printf("PIO: pio=%d, sm=%d, offset=%d\r\n", PIO_NUM(pio_config.pio), pio_config.sm, pio_config.offset);
+#endif
+    pinscan_program_init(pio_config.pio, pio_config.sm, pio_config.offset, bio2bufiopin[BIO0], channels, step_hz);
+    pin_count = channels;
+    output_mask = 0;
+    running = true;
+}
+
+void pinscan_pio_stop(void) {
+    if (!running) {
+        return;
+    }
+    pinscan_pio_outputs(0);
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, false);
+    pio_remove_program(pio_config.pio, pio_config.program, pio_config.offset);
+    for (uint8_t i = 0; i < pin_count; i++) {
+        gpio_set_function(bio2bufiopin[BIO0 + i], GPIO_FUNC_SIO);
+    }
+    running = false;
+}
+
+void pinscan_pio_outputs(uint8_t mask) {
+    mask &= (1u << pin_count) - 1;
+    if (mask == output_mask) {
+        return;
+    }
+    uint8_t to_output = mask & ~output_mask;
+    uint8_t to_input = output_mask & ~mask;
+    uint base = bio2bufiopin[BIO0];
+
+    // same order as bio_output()/bio_input(), never drive against the target
+    for (uint8_t i = 0; i < pin_count; i++) {
+        if (to_output & (1u << i)) {
+            bio_buf_output(BIO0 + i);
+        }
+    }
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, false);
+    pio_sm_set_pindirs_with_mask(pio_config.pio, pio_config.sm, (uint32_t)mask << base, ((1u << pin_count) - 1) << base);
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, true);
+    for (uint8_t i = 0; i < pin_count; i++) {
+        if (to_input & (1u << i)) {
+            bio_buf_input(BIO0 + i);
+        }
+    }
+    output_mask = mask;
+}
+
+void pinscan_pio_run(const uint8_t* out, uint8_t* in, uint32_t steps) {
+    PIO pio = pio_config.pio;
+    uint sm = pio_config.sm;
+    uint32_t words = (steps + 3) / 4;
+    uint32_t tx = 0, rx = 0;
+
+    if (!steps) {
+        return;
+    }
+    while (rx < words) {
+        if (tx < words && !pio_sm_is_tx_fifo_full(pio, sm)) {
+            // the last word is padded with the last step, the pins just hold
+            uint32_t word = 0;
+            for (uint32_t i = 0; i < 4; i++) {
+                uint32_t step = tx * 4 + i;
+                word |= (uint32_t)out[step < steps ? step : steps - 1] << (i * 8);
+            }
+            pio_sm_put(pio, sm, word);
+            tx++;
+        }
+        if (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+            uint32_t word = pio_sm_get(pio, sm);
+            for (uint32_t i = 0; i < 4 && rx * 4 + i < steps; i++) {
+                in[rx * 4 + i] = (uint8_t)(word >> (i * 8));
+            }
+            rx++;
+        }
+    }
+}
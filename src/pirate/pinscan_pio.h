@@ -0,0 +1,41 @@
+/**
+ * @file pinscan_pio.h
+ * @brief Parallel pin scan engine for pinout discovery.
+ * @details A PIO program writes a step pattern to the IO pins and samples
+ *          all of them after each step, so one pass tests every input pin
+ *          as a candidate at once. Bit n of a step or sample byte is IOn.
+ */
+
+#ifndef _PINSCAN_PIO_H
+#define _PINSCAN_PIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Load the scan program on IO0 to IO(channels - 1), all inputs.
+ * @param channels  Number of IO pins, 1 to 8
+ * @param step_hz   Steps per second, two steps per clock
+ */
+void pinscan_pio_start(uint32_t channels, uint32_t step_hz);
+
+/**
+ * @brief Release the PIO and return the pins to inputs.
+ */
+void pinscan_pio_stop(void);
+
+/**
+ * @brief Choose the pins that drive, the others are inputs.
+ * @param mask  Bit n set to drive IOn
+ */
+void pinscan_pio_outputs(uint8_t mask);
+
+/**
+ * @brief Write steps to the pins and sample the pins after each step.
+ * @param out   Pin levels for each step
+ * @param[out] in  Pin samples for each step
+ * @param steps Number of steps
+ */
+void pinscan_pio_run(const uint8_t* out, uint8_t* in, uint32_t steps);
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * @file spiflash_read_pio.c
+ * @brief Dual/quad SPI flash fast read engine using PIO and DMA.
+ * @details The hardware SPI peripheral sends the instruction, address and
+ *          dummy bytes on IO0. CS stays low and the clock pin switches to the
+ *          spiflash_read PIO program, which samples all 8 BIO pins on each
+ *          rising edge. DMA moves the samples out of the RX FIFO, and a
+ *          256 entry lookup table turns each sample into 2 or 4 data bits.
+ *
+ *          The PIO stalls with the clock high when DMA isn't draining the
+ *          FIFO, so a long read can be split into chunks without
+ *          restarting the command.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/spi.h"
+#include "pirate.h"
+#include "pio_config.h"
+#include "pirate/bio.h"
+#include "pirate/hwspi.h"
+#include "pirate/spiflash_read_pio.h"
+#include "spiflash_read.pio.h"
+
+static struct _pio_config pio_config;
+static int dma_chan = -1;
+static uint8_t data_lines;
+static uint32_t clock_freq;
+
+// BIO7:0 sample -> data bits (IO3 IO2 IO1 IO0), rebuilt for the number of lines in use
+static uint8_t sample_lut[256];
+
+static void spiflash_read_pio_build_lut(void) {
+    for (uint32_t s = 0; s < 256; s++) {
+        uint8_t io0 = (s >> M_SPI_CDO) & 0b1;
+        uint8_t io1 = (s >> M_SPI_CDI) & 0b1;
+        uint8_t io2 = (s >> SPIFLASH_READ_PIO_IO2) & 0b1;
+        uint8_t io3 = (s >> SPIFLASH_READ_PIO_IO3) & 0b1;
+        if (data_lines == 4) {
+            sample_lut[s] = (io3 << 3) | (io2 << 2) | (io1 << 1) | io0;
+        } else {
+            sample_lut[s] = (io1 << 1) | io0;
+        }
+    }
+}
+
+bool spiflash_read_pio_init(uint8_t lines, uint32_t freq) {
+    if (lines != 2 && lines != 4) {
+        return false;
+    }
+    // only mode 0 is supported, the PIO clock idles low
+    if (spi_get_hw(M_SPI_PORT)->cr0 & (SPI_SSPCR0_SPO_BITS | SPI_SSPCR0_SPH_BITS)) {
+        return false;
+    }
+    dma_chan = dma_claim_unused_channel(false);
+    if (dma_chan < 0) {
+        return false;
+    }
+    data_lines = lines;
+    clock_freq = freq;
+    spiflash_read_pio_build_lut();
+
+    pio_config.pio = PIO_MODE_PIO;
+    pio_config.sm = 0;
+    pio_config.program = &spiflash_read_program;
+    pio_config.offset = pio_add_program(pio_config.pio, pio_config.program);
+#ifdef BP_PIO_SHOW_ASSIGNMENT
+    printf("PIO: pio=%d, sm=%d, offset=%d\r\n", PIO_NUM(pio_config.pio), pio_config.sm, pio_config.offset);
+#endif
+    return true;
+}
+
+void spiflash_read_pio_cleanup(void) {
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, false);
+    pio_remove_program(pio_config.pio, pio_config.program, pio_config.offset);
+    if (dma_chan >= 0) {
+        dma_channel_abort(dma_chan);
+        dma_channel_unclaim(dma_chan);
+        dma_chan = -1;
+    }
+}
+
+uint32_t spiflash_read_pio_raw_size(uint32_t bytes) {
+    // one sample byte per clock, 8/data_lines clocks per data byte, rounded up to whole FIFO words
+    uint32_t samples = bytes * (8 / data_lines);
+    return (samples + 3) & ~0b11u;
+}
+
+void spiflash_read_pio_start(const spiflash_read_pio_cmd_t* cmd, uint32_t address, bool address_4_byte) {
+    hwspi_select();
+    hwspi_write(cmd->instruction);
+    if (address_4_byte) {
+        hwspi_write_32(address, 4);
+    } else {
+        hwspi_write_32(address << 8, 3);
+    }
+    for (uint8_t i = 0; i < cmd->dummy_clocks / 8; i++) {
+        hwspi_write(0xff);
+    }
+
+    // IO0 is driven by the flash from here on
+    bio_set_function(M_SPI_CDO, GPIO_FUNC_SIO);
+    bio_input(M_SPI_CDO);
+    if (data_lines == 4) {
+        bio_input(SPIFLASH_READ_PIO_IO2);
+        bio_input(SPIFLASH_READ_PIO_IO3);
+    }
+
+    // hand the clock (idle low) to the PIO
+    spiflash_read_program_init(
+        pio_config.pio, pio_config.sm, pio_config.offset, bio2bufiopin[M_SPI_CLK], bio2bufiopin[BIO0], clock_freq);
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, true);
+}
+
+void spiflash_read_pio_dma_start(uint8_t* raw, uint32_t bytes) {
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, pio_get_dreq(pio_config.pio, pio_config.sm, false));
+    dma_channel_configure(dma_chan,
+                          &c,
+                          raw,
+                          &pio_config.pio->rxf[pio_config.sm],
+                          spiflash_read_pio_raw_size(bytes) / 4,
+                          true);
+}
+
+void spiflash_read_pio_dma_wait(void) {
+    dma_channel_wait_for_finish_blocking(dma_chan);
+}
+
+void spiflash_read_pio_decode(const uint8_t* raw, uint8_t* data, uint32_t bytes) {
+    if (data_lines == 4) {
+        for (uint32_t i = 0; i < bytes; i++) {
+            data[i] = (sample_lut[raw[0]] << 4) | sample_lut[raw[1]];
+            raw += 2;
+        }
+    } else {
+        for (uint32_t i = 0; i < bytes; i++) {
+            data[i] = (sample_lut[raw[0]] << 6) | (sample_lut[raw[1]] << 4) | (sample_lut[raw[2]] << 2) |
+                      sample_lut[raw[3]];
+            raw += 4;
+        }
+    }
+}
+
+void spiflash_read_pio_stop(void) {
+    pio_sm_set_enabled(pio_config.pio, pio_config.sm, false);
+    // the PIO may have stalled with the clock high, end the transaction before dropping it
+    hwspi_deselect();
+    pio_sm_set_pins_with_mask(pio_config.pio, pio_config.sm, 0, 1u << bio2bufiopin[M_SPI_CLK]);
+    pio_sm_clear_fifos(pio_config.pio, pio_config.sm);
+
+    // pins back to the SPI peripheral
+    bio_set_function(M_SPI_CLK, GPIO_FUNC_SPI);
+    bio_buf_output(M_SPI_CDO);
+    bio_set_function(M_SPI_CDO, GPIO_FUNC_SPI);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file spiflash_read_pio.h
+ * @brief Dual/quad SPI flash fast read engine using PIO and DMA.
+ * @details The command, address and dummy phase of a 1-1-2 or 1-1-4 fast read
+ *          is sent with the hardware SPI peripheral. The clock pin is then
+ *          handed to a PIO program that samples the BIO port on every clock,
+ *          and DMA moves the samples into a buffer for the CPU to unpack.
+ *
+ *          Pin mapping follows SPI mode: IO0=MOSI (BIO7), IO1=MISO (BIO4).
+ *          Quad reads also need IO2=BIO2 (/WP) and IO3=BIO3 (/HOLD).
+ */
+
+#ifndef _SPIFLASH_READ_PIO_H
+#define _SPIFLASH_READ_PIO_H
+
+#define SPIFLASH_READ_PIO_IO2 BIO2
+#define SPIFLASH_READ_PIO_IO3 BIO3
+
+typedef struct spiflash_read_pio_cmd {
+    uint8_t data_lines;   // 1, 2 or 4
+    uint8_t instruction;  // fast read instruction
+    uint8_t dummy_clocks; // wait states + mode clocks, must be a multiple of 8
+} spiflash_read_pio_cmd_t;
+
+/**
+ * @brief Claim the PIO state machine and a DMA channel.
+ * @param data_lines  2 or 4 data lines
+ * @param freq        SPI clock frequency in Hz
+ * @return true on success
+ */
+bool spiflash_read_pio_init(uint8_t data_lines, uint32_t freq);
+
+/**
+ * @brief Remove the PIO program and release the DMA channel.
+ */
+void spiflash_read_pio_cleanup(void);
+
+/**
+ * @brief Number of raw sample bytes needed to read a number of data bytes.
+ * @param bytes  Data bytes
+ * @return Raw buffer size in bytes (multiple of 4)
+ */
+uint32_t spiflash_read_pio_raw_size(uint32_t bytes);
+
+/**
+ * @brief Select the chip and start a fast read at an address.
+ * @details CS stays low until spiflash_read_pio_stop(), read any number of
+ *          chunks in between with spiflash_read_pio_dma_start().
+ * @param cmd             Fast read command
+ * @param address         Start address
+ * @param address_4_byte  Send 4 address bytes
+ */
+void spiflash_read_pio_start(const spiflash_read_pio_cmd_t* cmd, uint32_t address, bool address_4_byte);
+
+/**
+ * @brief Start DMA of the next chunk of samples.
+ * @param raw    Raw sample buffer, 4 byte aligned, spiflash_read_pio_raw_size(bytes) long
+ * @param bytes  Data bytes in this chunk
+ */
+void spiflash_read_pio_dma_start(uint8_t* raw, uint32_t bytes);
+
+/**
+ * @brief Wait for the current DMA chunk to complete.
+ */
+void spiflash_read_pio_dma_wait(void);
+
+/**
+ * @brief Unpack raw samples into data bytes.
+ * @param raw    Raw sample buffer
+ * @param data   Output buffer
+ * @param bytes  Data bytes to unpack
+ */
+void spiflash_read_pio_decode(const uint8_t* raw, uint8_t* data, uint32_t bytes);
+
+/**
+ * @brief Stop the state machine, deselect the chip and give the pins back to the SPI peripheral.
+ */
+void spiflash_read_pio_stop(void);
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file tasks.c
+ * @brief Cooperative task table for the core0 service loop.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pirate.h"
+#include "system_config.h"
+#include "displays.h"
+#include "modes.h"
+#include "binmode/binmodes.h"
+#include "pirate/tasks.h"
+
+static bool tasks_yielding_now;
+
+// under a command only a binmode that refuses hardware requests is serviced
+static void task_binmode(void) {
+    if (tasks_yielding_now && !binmodes[system_config.binmode_select].service_in_yield) {
+        return;
+    }
+    binmode_service();
+}
+
+static void task_display_periodic(void) {
+    displays[system_config.display].display_periodic();
+}
+
+static void task_protocol_periodic(void) {
+    modes[system_config.mode].protocol_periodic();
+}
+
+// in order of priority when several are due at the same time
+static struct task tasks[] = {
+    { .name = "binmode",  .run = task_binmode,          .period_us = 0, .budget_us = 1000, .flags = 0 },
+    { .name = "display",  .run = task_display_periodic,  .period_us = 0, .budget_us = 1000, .flags = TASK_PROMPT_ONLY },
+    { .name = "protocol", .run = task_protocol_periodic, .period_us = 0, .budget_us = 1000, .flags = TASK_PROMPT_ONLY },
+};
+
+static bool tasks_running;
+static uint64_t tasks_stats_start_us;
+
+static inline bool task_is_due(const struct task* t, uint32_t now) {
+    return (int32_t)(now - t->due_us) >= 0;
+}
+
+static void task_run(struct task* t) {
+    uint32_t start = time_us_32();
+    uint32_t latency = start - t->due_us;
+    if ((int32_t)latency > 0 && latency > t->max_latency_us) {
+        t->max_latency_us = latency;
+    }
+    t->run();
+    uint32_t run_us = time_us_32() - start;
+
+    // a period 0 task is due again right away, its latency is the gap between runs
+    t->due_us = start + t->period_us;
+    t->runs++;
+    t->total_us += run_us;
+    if (run_us > t->max_us) {
+        t->max_us = run_us;
+    }
+    if (run_us > t->budget_us) {
+        t->overruns++;
+    }
+}
+
+static void tasks_run_due(bool at_prompt) {
+    uint32_t ran = 0; // bit per task already run on this pass
+
+    if (tasks_running) {
+        return;
+    }
+    tasks_running = true;
+
+    if (!tasks_stats_start_us) {
+        tasks_stats_reset(); // first pass, everything is due now
+    }
+
+    while (true) {
+        // earliest deadline first among the tasks that are due and not run yet
+        uint32_t now = time_us_32();
+        struct task* next = NULL;
+        uint32_t next_bit = 0;
+        for (uint8_t i = 0; i < count_of(tasks); i++) {
+            struct task* t = &tasks[i];
+            if ((ran & (1u << i)) || !task_is_due(t, now)) {
+                continue;
+            }
+            if (!at_prompt && (t->flags & TASK_PROMPT_ONLY)) {
+                continue;
+            }
+            if (!next || (int32_t)(t->due_us - next->due_us) < 0) {
+                next = t;
+                next_bit = 1u << i;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        ran |= next_bit;
+        task_run(next);
+    }
+
+    tasks_running = false;
+}
+
+void tasks_service(bool at_prompt) {
+    tasks_run_due(at_prompt);
+}
+
+void tasks_yield(void) {
+    if (tasks_running) {
+        return;
+    }
+    tasks_yielding_now = true;
+    tasks_run_due(false);
+    tasks_yielding_now = false;
+}
+
+bool tasks_yielding(void) {
+    return tasks_yielding_now;
+}
+
+const struct task* tasks_get(uint8_t* count) {
+    *count = count_of(tasks);
+    return tasks;
+}
+
+uint64_t tasks_stats_elapsed_us(void) {
+    return time_us_64() - tasks_stats_start_us;
+}
+
+void tasks_stats_reset(void) {
+    uint32_t now = time_us_32();
+    for (uint8_t i = 0; i < count_of(tasks); i++) {
+        tasks[i].due_us = now;
+        tasks[i].runs = 0;
+        tasks[i].total_us = 0;
+        tasks[i].max_us = 0;
+        tasks[i].max_latency_us = 0;
+        tasks[i].overruns = 0;
+    }
+    tasks_stats_start_us = time_us_64();
+}
@@ -0,0 +1,75 @@
+/**
+ * @file tasks.h
+ * @brief Cooperative task table for the core0 service loop.
+ * @details The core0 loop used to call each background service on every
+ *          pass in a fixed order. They are now entries in a task table with
+ *          a period and a run time budget. tasks_service() runs the due tasks,
+ *          earliest deadline first, and keeps run time statistics for the
+ *          `tasks` command.
+ *
+ *          Long running commands (bridge, sniffers) call tasks_yield() in
+ *          their loops so the background tasks keep running under them.
+ *          The command owns the hardware meanwhile: only binmodes marked
+ *          service_in_yield run there, and they check tasks_yielding().
+ */
+
+#ifndef _TASKS_H
+#define _TASKS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TASK_PROMPT_ONLY 0x01 // only at the command prompt, never from tasks_yield()
+
+struct task {
+    const char* name;
+    void (*run)(void);
+    uint32_t period_us; // 0 runs on every pass
+    uint32_t budget_us; // run time above this is counted as an overrun
+    uint8_t flags;      // TASK_x
+    // statistics, cleared by tasks_stats_reset()
+    uint32_t due_us;         // time_us_32() the task is next due
+    uint32_t runs;
+    uint64_t total_us;       // run time
+    uint32_t max_us;         // longest run
+    uint32_t max_latency_us; // longest it waited past due
+    uint32_t overruns;
+};
+
+/**
+ * @brief Run every due task once.
+ * @param at_prompt  true at the command prompt, false runs only tasks without TASK_PROMPT_ONLY
+ */
+void tasks_service(bool at_prompt);
+
+/**
+ * @brief Run due background tasks from inside a long running command.
+ * @note Safe to call from a task, nested calls return without running anything.
+ */
+void tasks_yield(void);
+
+/**
+ * @brief A long running command is in tasks_yield() and holds the hardware.
+ * @return true while tasks run from tasks_yield()
+ */
+bool tasks_yielding(void);
+
+/**
+ * @brief Get the task table.
+ * @param count  Number of tasks
+ * @return Task table
+ */
+const struct task* tasks_get(uint8_t* count);
+
+/**
+ * @brief Time since the statistics were reset.
+ * @return Microseconds
+ */
+uint64_t tasks_stats_elapsed_us(void);
+
+/**
+ * @brief Clear the run time statistics.
+ */
+void tasks_stats_reset(void);
+
+#endif
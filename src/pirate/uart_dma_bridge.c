@@ -0,0 +1,225 @@
+/**
+ * @file uart_dma_bridge.c
+ * @brief DMA UART to USB CDC bridge.
+ * @details Both rings are 32K in the big buffer, which is 32K aligned, so the
+ *          DMA ring wrap keeps each channel inside its ring without being
+ *          reloaded. The DMA transfer count gives the position of the channel.
+ *
+ *          RX: one long transfer from the UART data register into the RX ring.
+ *          head = bytes written by the DMA, tail = bytes given to TinyUSB.
+ *
+ *          TX: core1 reads CDC 0 into the TX ring at head, each DMA transfer
+ *          sends everything queued up to head when it was started.
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+#include "tusb.h"
+#include "pirate.h"
+#include "pirate/bio.h"
+#include "pirate/mem.h"
+#include "pirate/uart_dma_bridge.h"
+
+#define BRIDGE_RING_BITS 15u
+#define BRIDGE_RING_SIZE (1u << BRIDGE_RING_BITS)
+#define BRIDGE_RING_MASK (BRIDGE_RING_SIZE - 1)
+#define BRIDGE_RX_ARM 0x0fffffffu // largest count on both chips, ~15 minutes at 3Mbaud
+#define BRIDGE_RTS_STOP (BRIDGE_RING_SIZE / 4 * 3)
+#define BRIDGE_RTS_GO (BRIDGE_RING_SIZE / 2)
+
+enum bridge_state {
+    BRIDGE_IDLE = 0,
+    BRIDGE_RUN,      // core1 serves the rings
+    BRIDGE_STOP_REQ, // core0 wants the rings back, core1 answers with BRIDGE_IDLE
+};
+
+static volatile enum bridge_state state;
+static uint8_t* buf;
+static uint8_t* rx_ring;
+static uint8_t* tx_ring;
+static int rx_chan = -1;
+static int tx_chan = -1;
+
+// core1 only while running
+static uint32_t rx_base; // bytes written by finished RX transfers
+static uint32_t rx_tail;
+static uint32_t tx_head;
+static uint32_t tx_base; // bytes queued before the current TX transfer
+static uint32_t tx_armed;
+static bool rts_stopped;
+static struct uart_dma_bridge_stats stats;
+static uint32_t start_us;
+
+static void bridge_rx_service(void) {
+    uint32_t head = rx_base + (BRIDGE_RX_ARM - dma_channel_hw_addr(rx_chan)->transfer_count);
+    if (!dma_channel_is_busy(rx_chan)) {
+        // the write address has wrapped to where the next byte goes, just start over
+        rx_base += BRIDGE_RX_ARM;
+        dma_channel_set_trans_count(rx_chan, BRIDGE_RX_ARM, true);
+    }
+
+    uint32_t fill = head - rx_tail;
+    if (fill > BRIDGE_RING_SIZE) {
+        // the DMA went round over bytes USB hadn't taken yet
+        stats.dropped += fill - BRIDGE_RING_SIZE;
+        rx_tail = head - BRIDGE_RING_SIZE;
+        fill = BRIDGE_RING_SIZE;
+    }
+
+    if (fill) {
+        uint32_t offset = rx_tail & BRIDGE_RING_MASK;
+        uint32_t n = MIN(fill, BRIDGE_RING_SIZE - offset);
+        n = MIN(n, tud_cdc_n_write_available(0));
+        if (n) {
+            n = tud_cdc_n_write(0, &rx_ring[offset], n);
+            tud_cdc_n_write_flush(0);
+            rx_tail += n;
+            stats.rx_bytes += n;
+            fill -= n;
+        }
+    }
+
+    if (!rts_stopped && fill > BRIDGE_RTS_STOP) {
+        bio_put(M_UART_RTS, 1); // not ready
+        rts_stopped = true;
+        stats.rts_stops++;
+    } else if (rts_stopped && fill < BRIDGE_RTS_GO) {
+        bio_put(M_UART_RTS, 0);
+        rts_stopped = false;
+    }
+}
+
+static void bridge_tx_service(void) {
+    uint32_t tx_tail = tx_base + (tx_armed - dma_channel_hw_addr(tx_chan)->transfer_count);
+    uint32_t available = tud_cdc_n_available(0);
+    uint32_t free_space = BRIDGE_RING_SIZE - (tx_head - tx_tail);
+    if (available && free_space) {
+        uint32_t offset = tx_head & BRIDGE_RING_MASK;
+        uint32_t n = MIN(available, free_space);
+        n = MIN(n, BRIDGE_RING_SIZE - offset);
+        tx_head += tud_cdc_n_read(0, &tx_ring[offset], n);
+    }
+
+    if (!dma_channel_is_busy(tx_chan)) {
+        stats.tx_bytes += tx_armed;
+        tx_base += tx_armed;
+        tx_armed = tx_head - tx_base;
+        if (tx_armed) {
+            // the read address already points at tx_base
+            dma_channel_set_trans_count(tx_chan, tx_armed, true);
+        }
+    }
+}
+
+void uart_dma_bridge_service(void) {
+    enum bridge_state s = state;
+    if (s == BRIDGE_STOP_REQ) {
+        state = BRIDGE_IDLE;
+        return;
+    }
+    if (s != BRIDGE_RUN) {
+        return;
+    }
+    bridge_rx_service();
+    bridge_tx_service();
+}
+
+bool uart_dma_bridge_active(void) {
+    return state != BRIDGE_IDLE;
+}
+
+bool uart_dma_bridge_start(void) {
+    if (state != BRIDGE_IDLE) {
+        return true;
+    }
+    buf = mem_alloc(BRIDGE_RING_SIZE * 2, BP_BIG_BUFFER_UART_BRIDGE);
+    if (!buf) {
+        return false;
+    }
+    rx_chan = dma_claim_unused_channel(false);
+    tx_chan = dma_claim_unused_channel(false);
+    if (rx_chan < 0 || tx_chan < 0) {
+        if (rx_chan >= 0) {
+            dma_channel_unclaim(rx_chan);
+        }
+        mem_free(buf);
+        rx_chan = -1;
+        tx_chan = -1;
+        return false;
+    }
+    rx_ring = buf;
+    tx_ring = buf + BRIDGE_RING_SIZE;
+    rx_base = 0;
+    rx_tail = 0;
+    tx_head = 0;
+    tx_base = 0;
+    tx_armed = 0;
+    rts_stopped = false;
+    stats = (struct uart_dma_bridge_stats){ 0 };
+
+    // stale bytes in the UART FIFO belong to whatever ran before
+    while (uart_is_readable(M_UART_PORT)) {
+        (void)uart_getc(M_UART_PORT);
+    }
+    uart_hw_t* hw = uart_get_hw(M_UART_PORT);
+    // baud = clk_peri / (16 * (ibrd + fbrd / 64))
+    stats.baud = (uint32_t)(((uint64_t)clock_get_hz(clk_peri) * 4) / ((hw->ibrd << 6) + hw->fbrd));
+
+    dma_channel_config c = dma_channel_get_default_config(rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, BRIDGE_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(M_UART_PORT, false));
+    dma_channel_configure(rx_chan, &c, rx_ring, &hw->dr, BRIDGE_RX_ARM, true);
+
+    c = dma_channel_get_default_config(tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_ring(&c, false, BRIDGE_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(M_UART_PORT, true));
+    dma_channel_configure(tx_chan, &c, &hw->dr, tx_ring, 0, false);
+
+    bio_put(M_UART_RTS, 0); // ready to receive
+    start_us = time_us_32();
+    __dmb(); // rings and channels are set before core1 sees the bridge running
+    state = BRIDGE_RUN;
+    __sev();
+    return true;
+}
+
+void uart_dma_bridge_stop(struct uart_dma_bridge_stats* s) {
+    if (state == BRIDGE_IDLE) {
+        if (s) {
+            *s = stats;
+        }
+        return;
+    }
+    state = BRIDGE_STOP_REQ;
+    __sev();
+    while (state != BRIDGE_IDLE) {
+        tight_loop_contents();
+    }
+    __dmb();
+    bio_put(M_UART_RTS, 1);
+
+    stats.tx_bytes += tx_armed - dma_channel_hw_addr(tx_chan)->transfer_count;
+    dma_channel_abort(rx_chan);
+    dma_channel_abort(tx_chan);
+    dma_channel_unclaim(rx_chan);
+    dma_channel_unclaim(tx_chan);
+    rx_chan = -1;
+    tx_chan = -1;
+    mem_free(buf);
+    buf = NULL;
+
+    stats.elapsed_us = time_us_32() - start_us;
+    if (s) {
+        *s = stats;
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * @file uart_dma_bridge.h
+ * @brief DMA UART to USB CDC bridge.
+ * @details DMA moves the UART RX FIFO into a ring in the big buffer and core1
+ *          writes straight from the ring into TinyUSB. CDC RX is read by core1 into a
+ *          second ring that DMA feeds to the UART TX FIFO. Neither direction
+ *          touches the terminal byte queues, so the bridge keeps up at
+ *          several Mbaud.
+ *
+ *          Core0 starts and stops the bridge. While it runs, core1 owns both
+ *          rings, the DMA channels and RTS.
+ */
+
+#ifndef _UART_DMA_BRIDGE_H
+#define _UART_DMA_BRIDGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct uart_dma_bridge_stats {
+    uint32_t rx_bytes;  // UART to USB
+    uint32_t tx_bytes;  // USB to UART
+    uint32_t dropped;   // UART bytes overwritten before USB took them
+    uint32_t rts_stops; // times RTS was raised on a full ring
+    uint32_t elapsed_us;
+    uint32_t baud; // from the UART divider
+};
+
+/**
+ * @brief Claim the big buffer and two DMA channels and start the bridge.
+ * @note Core0 only.
+ * @return false if the big buffer or the DMA channels are in use
+ */
+bool uart_dma_bridge_start(void);
+
+/**
+ * @brief Stop the bridge and release the buffer and channels.
+ * @note Core0 only, waits for core1 to let go of the rings.
+ * @param[out] stats  Transfer counts, may be NULL
+ */
+void uart_dma_bridge_stop(struct uart_dma_bridge_stats* stats);
+
+/**
+ * @brief The bridge is running, core1 serves CDC 0 from the rings.
+ */
+bool uart_dma_bridge_active(void);
+
+/**
+ * @brief Move data between the rings, TinyUSB and the DMA channels.
+ * @note Core1 service loop.
+ */
+void uart_dma_bridge_service(void);
+
+#endif
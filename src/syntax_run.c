@@ -18,6 +18,8 @@
 #include "syntax_internal.h"
 #include "pirate/bio.h"
 #include "pirate/amux.h"
+#include "pirate/perf.h"
+#include "pirate/bitbang_seq.h"
 
 // #define SYNTAX_DEBUG
 
@@ -178,6 +180,37 @@ syntax_run_func_ptr_t syntax_run_func[] = {
     [SYN_READ_DAT]       = syntax_run_read_dat
 };
 
+/*
+ * =============================================================================
+ * Pin sequences
+ * =============================================================================
+ */
+
+// Hand a run of clk/dat bytecodes to the mode as one sequence, so the edges
+// aren't spaced out by a dispatch per bytecode. Returns the bytecodes done,
+// 0 to run them one at a time.
+static uint32_t syntax_run_pin_sequence(uint32_t pos) {
+    if (!modes[system_config.mode].protocol_pin_sequence) {
+        return 0;
+    }
+    uint32_t run = bb_seq_run_length(&syntax_io.out[pos], syntax_io.out_cnt - pos);
+    if (run < 2 || syntax_io.in_cnt + run >= SYN_MAX_LENGTH) {
+        return 0;
+    }
+    uint32_t done = modes[system_config.mode].protocol_pin_sequence(&syntax_io.out[pos], run);
+    for (uint32_t i = 0; i < done; i++) {
+        struct _bytecode* in = &syntax_io.in[syntax_io.in_cnt++];
+        *in = syntax_io.out[pos + i];
+        // same result as the protocol_clkh/clkl/dath/datl handlers
+        if (in->command == SYN_SET_CLK_HIGH || in->command == SYN_SET_DAT_HIGH) {
+            in->out_data = 1;
+        } else if (in->command == SYN_SET_CLK_LOW || in->command == SYN_SET_DAT_LOW) {
+            in->out_data = 0;
+        }
+    }
+    return done;
+}
+
 /*
  * =============================================================================
  * Main run function
@@ -192,6 +225,12 @@ SYNTAX_STATUS syntax_run(void) {
     syntax_io.in_cnt = 0;
 
     for (uint32_t pos = 0; pos < syntax_io.out_cnt; pos++) {
+        uint32_t pins = syntax_run_pin_sequence(pos);
+        if (pins) {
+            pos += pins - 1;
+            continue;
+        }
+
         syntax_io.in[syntax_io.in_cnt] = syntax_io.out[pos];
 
         if (syntax_io.out[pos].command >= count_of(syntax_run_func)) {
@@ -199,7 +238,9 @@ SYNTAX_STATUS syntax_run(void) {
             return SSTATUS_ERROR;
         }
 
+        PERF_START(PERF_SYNTAX_OP);
         syntax_run_func[syntax_io.out[pos].command](&syntax_io, pos);
+        PERF_END(PERF_SYNTAX_OP);
 
         if (syntax_io.in_cnt + 1 >= SYN_MAX_LENGTH) {
             syntax_io.in[syntax_io.in_cnt].error_message = GET_T(T_SYNTAX_EXCEEDS_MAX_SLOTS);
@@ -138,6 +138,7 @@ typedef struct _system_config {
                                       // functions
     uint8_t binmode_select;           // index of currently active binary mode
     bool binmode_lock_terminal;       // disable terminal while in binmode
+    bool binmode_usb_paused;          // binary USB port lent to the scope frame stream, binmode not serviced
     uint32_t bpio_debug_enable;           // enable debug output for BPIO
 
 } _system_config;
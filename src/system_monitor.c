@@ -104,16 +104,24 @@ bool monitor_current_changed(void) {
 }
 
 bool monitor(void) {
-    char c;
-
-    bool current_sense = psu_status.enabled;
-    
     // TODO hw_adc helper functions - do conversion on request, and cache it????
     if (scope_running) { // scope is using the analog subsystem
         return 0;
     }
 
     amux_sweep();
+    return monitor_update();
+}
+
+// update the display strings from the last completed AMUX sweep
+bool monitor_update(void) {
+    char c;
+
+    bool current_sense = psu_status.enabled;
+
+    if (scope_running) { // scope is using the analog subsystem
+        return 0;
+    }
 
     for (uint8_t i = 0; i < count_of(voltages_value); i++) {
         c = ((*hw_pin_voltage_ordered[i]) / 1000) + 0x30; // TODO: really do the +0x30 here????
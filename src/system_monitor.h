@@ -10,6 +10,12 @@
  */
 bool monitor(void);
 
+/**
+ * @brief Update monitor values from the last completed AMUX sweep, without sweeping.
+ * @return  true if any value changed
+ */
+bool monitor_update(void);
+
 /**
  * @brief Initialize system monitor.
  */
@@ -362,6 +362,7 @@ enum T_translations{
     T_HELP_FLASH_READ,
     T_HELP_FLASH_VERIFY,
     T_HELP_FLASH_TEST,
+    T_HELP_FLASH_HASH,
     T_HELP_FLASH_PROBE,
     T_HELP_FLASH_INIT,
     T_HELP_FLASH_FILE_FLAG,
@@ -369,6 +370,8 @@ enum T_translations{
     T_HELP_FLASH_VERIFY_FLAG,
     T_HELP_FLASH_OVERRIDE,
     T_HELP_FLASH_YES_OVERRIDE,
+    T_HELP_FLASH_DIFF_FLAG,
+    T_HELP_FLASH_LINES_FLAG,
     T_HELP_I2C_EEPROM,
     T_HELP_SPI_EEPROM,
     T_HELP_1WIRE_EEPROM,
@@ -379,6 +382,7 @@ enum T_translations{
     T_HELP_EEPROM_VERIFY,
     T_HELP_EEPROM_TEST,
     T_HELP_EEPROM_LIST,
+    T_HELP_EEPROM_HASH,
     T_HELP_EEPROM_DEVICE_FLAG,
     T_HELP_EEPROM_FILE_FLAG,
     T_HELP_EEPROM_VERIFY_FLAG,
@@ -648,6 +652,26 @@ enum T_translations{
     T_HELP_I2C_USBPD_CURRENT,
     T_HELP_I2C_MPU6050,
     T_HELP_GLOBAL_JEP106_LOOKUP,
+    T_HELP_GCMD_ADCLOG,
+    T_HELP_GCMD_ADCLOG_CHANNELS,
+    T_HELP_GCMD_ADCLOG_RATE,
+    T_HELP_GCMD_ADCLOG_WINDOW,
+    T_HELP_GCMD_ADCLOG_FILE,
+    T_HELP_GCMD_ADCLOG_BINARY,
+    T_HELP_GCMD_TASKS,
+    T_HELP_GCMD_TASKS_RESET,
+    T_HELP_GCMD_PERF,
+    T_HELP_GCMD_PERF_RESET,
+    T_HWI2C_BUS_USE,
+    T_HELP_I2C_SCAN_FAST,
+    T_UART_RX_GAP,
+    T_UART_RX_TIMESTAMPS,
+    T_UART_RX_RING,
+    T_HELP_UART_BRIDGE_DMA,
+    T_UART_BRIDGE_DMA_UNAVAILABLE,
+    T_UART_BRIDGE_DMA_STATS,
+    T_HELP_1WIRE_SCAN_TEMP,
+    T_JTAG_BLUETAG_LEGACY,
 
 	T_LAST_ITEM_ALWAYS_AT_THE_END //LEAVE THIS ITEM AT THE END!!! It helps the compiler report errors if there are missing translations
 };
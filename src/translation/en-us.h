@@ -357,6 +357,7 @@ static char const * const en_us[]={
 	[T_HELP_FLASH_READ]="Read flash chip to file",
 	[T_HELP_FLASH_VERIFY]="Verify flash chip against file",
 	[T_HELP_FLASH_TEST]="Erase and write full chip with dummy data, verify",
+	[T_HELP_FLASH_HASH]="CRC32 and SHA-256 of flash contents (or -s/-b range)",
 	[T_HELP_FLASH_PROBE]="Probe flash chip for ID and SFDP info",
 	[T_HELP_FLASH_INIT]="Reset and initialize flash chip. Default if no options given",
 	[T_HELP_FLASH_FILE_FLAG]="File flag. File to write, read or verify",
@@ -364,6 +365,8 @@ static char const * const en_us[]={
 	[T_HELP_FLASH_VERIFY_FLAG]="Verify flag. Add verify after write or erase",
 	[T_HELP_FLASH_OVERRIDE]="Read without detect (0x03 command), -b to specify bytes to read",
 	[T_HELP_FLASH_YES_OVERRIDE]="Override yes/no prompt for destructive actions (erase, write, test)",
+	[T_HELP_FLASH_DIFF_FLAG]="Diff flag. Erase and program only sectors that differ from the file",
+	[T_HELP_FLASH_LINES_FLAG]="Data lines for read: 1, 2 (dual, default if supported) or 4 (quad, IO2=BIO2, IO3=BIO3)",
 	//EEPROM command help
 	[T_HELP_I2C_EEPROM]="read, write and erase 24XX series I2C EEPROM chips",
 	[T_HELP_SPI_EEPROM]="read, write and erase 25XX series SPI EEPROM chips",
@@ -375,6 +378,7 @@ static char const * const en_us[]={
 	[T_HELP_EEPROM_VERIFY]="Verify chip against file",
 	[T_HELP_EEPROM_TEST]="Erase and write chip with dummy data, verify",
 	[T_HELP_EEPROM_LIST]="List supported EEPROM devices",
+	[T_HELP_EEPROM_HASH]="CRC32 and SHA-256 of EEPROM contents (or -s/-b range)",
 	[T_HELP_EEPROM_DEVICE_FLAG]="Specify the EEPROM device",
 	[T_HELP_EEPROM_FILE_FLAG]="File to write, read or verify",
 	[T_HELP_EEPROM_VERIFY_FLAG]="Verify after write, read or erase",
@@ -650,6 +654,26 @@ static char const * const en_us[]={
 	[T_HELP_I2C_USBPD_CURRENT]="Current in mA for PDO request (optional, default max)",
 	[T_HELP_I2C_MPU6050]="interface with MPU-6050 6-axis IMU sensor",
 	[T_HELP_GLOBAL_JEP106_LOOKUP]="lookup vendor name from 2 byte JEDEC JEP106 ID code",
+	[T_HELP_GCMD_ADCLOG]="Log voltage and current min/avg/max to terminal, file or binary USB port",
+	[T_HELP_GCMD_ADCLOG_CHANNELS]="Channels to log: 0-7 IO pins, v VOUT, i current (default all)",
+	[T_HELP_GCMD_ADCLOG_RATE]="Scans per second (default 1000)",
+	[T_HELP_GCMD_ADCLOG_WINDOW]="Scans per logged min/avg/max record (default 100)",
+	[T_HELP_GCMD_ADCLOG_FILE]="Write CSV to file on the flash disk",
+	[T_HELP_GCMD_ADCLOG_BINARY]="Send binary frames on the binary USB port",
+	[T_HELP_GCMD_TASKS]="Show run time and latency of the background tasks",
+	[T_HELP_GCMD_TASKS_RESET]="Reset the statistics after showing them",
+	[T_HELP_GCMD_PERF]="Show timing of the bytecode, BPIO, USB and LCD hot paths",
+	[T_HELP_GCMD_PERF_RESET]="Reset the probes after showing them",
+	[T_HWI2C_BUS_USE]="Bus use, last transfer",
+	[T_HELP_I2C_SCAN_FAST]="Fast scan, skip the reserved addresses",
+	[T_UART_RX_GAP]="Async print packet gap",
+	[T_UART_RX_TIMESTAMPS]="Async print timestamps",
+	[T_UART_RX_RING]="RX buffer",
+	[T_HELP_UART_BRIDGE_DMA]="DMA bridge for high baud rates, RTS follows the buffer fill",
+	[T_UART_BRIDGE_DMA_UNAVAILABLE]="DMA bridge unavailable (buffer or DMA in use), using the standard bridge",
+	[T_UART_BRIDGE_DMA_STATS]="DMA bridge",
+	[T_HELP_1WIRE_SCAN_TEMP]="convert all temperature sensors at once and read them",
+	[T_JTAG_BLUETAG_LEGACY]="Use the blueTag permutation scan instead of the parallel PIO scan",
 };
 
 // Since en-us is the base language, the following static assert at least verifies the table size
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
 #include "pirate.h"
@@ -19,6 +20,7 @@
 #include "modes.h"
 #include "displays.h"
 #include "pirate/lcd.h"
+#include "pirate/lcd_blit.h"
 
 static inline void lcd_write_start(void) {
     spi_busy_wait(true);
@@ -122,54 +124,137 @@ void lcd_write_background(const unsigned char* image) {
 
     // Update October 2024: new image headers in pre-sorted pixel format for speed
     //  see image.py in the display folder to create new headers
-    // TODO: DMA it.
-    spi_write_blocking(BP_SPI_PORT, image, (320 * 240 * 2));
+    lcd_blit_start();
+    lcd_blit_bytes(image, (320 * 240 * 2));
+    lcd_blit_end();
+    lcd_update_stats.frame_bytes += 320 * 240 * 2;
 
     lcd_write_stop();
+    lcd_shadow_invalidate();
 }
 
 // Write a string to the LCD
 // TODO: in LCD write string, automaticall toupper/lower depending on the contents of the font and the string
+// Expanded glyph cache
+// Characters are kept as ready to send LCD pixels (columns plus right padding),
+// so a repeat of the same character and colors is a single DMA write from RAM.
+// Glyphs are allocated round robin from a pixel pool, the oldest are overwritten first.
+#if RPI_PLATFORM == RP2350
+#define LCD_GLYPH_CACHE_PIXELS 16384
+#define LCD_GLYPH_CACHE_ENTRIES 64
+#else
+#define LCD_GLYPH_CACHE_PIXELS 6144
+#define LCD_GLYPH_CACHE_ENTRIES 32
+#endif
+
+struct lcd_glyph_entry {
+    const FONT_INFO* font; // NULL if the entry is free
+    uint16_t text;
+    uint16_t back;
+    uint16_t start; // first pixel in the pool
+    uint16_t pixels;
+    uint8_t c;
+};
+
+static uint16_t lcd_glyph_pool[LCD_GLYPH_CACHE_PIXELS];
+static struct lcd_glyph_entry lcd_glyph_cache[LCD_GLYPH_CACHE_ENTRIES];
+static uint16_t lcd_glyph_pool_head;
+static uint8_t lcd_glyph_entry_next;
+
+struct lcd_update_stats lcd_update_stats;
+
+static const uint16_t* lcd_glyph_cache_get(
+    const FONT_INFO* font, uint8_t adjusted_c, uint16_t text, uint16_t back, uint32_t pixels) {
+    for (uint8_t i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        struct lcd_glyph_entry* e = &lcd_glyph_cache[i];
+        if (e->font == font && e->c == adjusted_c && e->text == text && e->back == back) {
+            lcd_update_stats.glyph_hits++;
+            return &lcd_glyph_pool[e->start];
+        }
+    }
+    lcd_update_stats.glyph_misses++;
+
+    if (pixels > LCD_GLYPH_CACHE_PIXELS) {
+        return NULL;
+    }
+    if (lcd_glyph_pool_head + pixels > LCD_GLYPH_CACHE_PIXELS) {
+        lcd_glyph_pool_head = 0;
+    }
+    uint16_t start = lcd_glyph_pool_head;
+    lcd_glyph_pool_head += pixels;
+
+    // free the entry we are about to use, and any glyph under the new pixels
+    lcd_glyph_cache[lcd_glyph_entry_next].font = NULL;
+    for (uint8_t i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        struct lcd_glyph_entry* e = &lcd_glyph_cache[i];
+        if (e->font && e->start < start + pixels && start < e->start + e->pixels) {
+            e->font = NULL;
+        }
+    }
+
+    // a cached glyph earlier in this stream may still be going out by DMA from the pool
+    lcd_blit_wait();
+
+    uint16_t* dst = &lcd_glyph_pool[start];
+    uint16_t rows = (*font).lookup[adjusted_c].height;
+    const uint8_t* bitmap = &(*font).bitmaps[(*font).lookup[adjusted_c].offset];
+    for (uint16_t col = 0; col < (*font).lookup[adjusted_c].width; col++) {
+        // one column is height_bytes of bitmap, MSB first
+        // some bits may be discarded because of poor packing by The Dot Factory
+        for (uint16_t row = 0; row < rows; row++) {
+            *dst++ = (bitmap[row >> 3] & (0b10000000 >> (row & 0b111))) ? text : back;
+        }
+        bitmap += (*font).height_bytes;
+    }
+    for (uint32_t i = rows * (*font).lookup[adjusted_c].width; i < pixels; i++) {
+        *dst++ = back;
+    }
+
+    struct lcd_glyph_entry* e = &lcd_glyph_cache[lcd_glyph_entry_next];
+    lcd_glyph_entry_next = (lcd_glyph_entry_next + 1) % LCD_GLYPH_CACHE_ENTRIES;
+    e->text = text;
+    e->back = back;
+    e->start = start;
+    e->pixels = pixels;
+    e->c = adjusted_c;
+    e->font = font;
+    return &lcd_glyph_pool[start];
+}
+
+// stream one character and its right hand padding, returns the number of pixels sent
+static uint32_t lcd_write_glyph(const FONT_INFO* font, uint8_t adjusted_c, uint16_t text, uint16_t back) {
+    uint16_t rows = (*font).lookup[adjusted_c].height;
+    uint32_t pixels = rows * ((*font).lookup[adjusted_c].width + (*font).right_padding);
+
+    const uint16_t* cached = lcd_glyph_cache_get(font, adjusted_c, text, back, pixels);
+    if (cached) {
+        lcd_blit_bytes((const uint8_t*)cached, pixels * 2);
+        return pixels;
+    }
+
+    uint16_t offset = (*font).lookup[adjusted_c].offset;
+    for (uint16_t col = 0; col < (*font).lookup[adjusted_c].width; col++) {
+        lcd_blit_1bpp(&(*font).bitmaps[offset + (col * (*font).height_bytes)], rows, text, back);
+    }
+    // depending on how the font fits in the bitmap,
+    // there may or may not be enough right hand padding between characters
+    // this adds a configurable amount of space
+    lcd_blit_fill(back, rows * (*font).right_padding);
+    return pixels;
+}
+
 void lcd_write_string(
     const FONT_INFO* font, const uint8_t* back_color, const uint8_t* text_color, const char* c, uint16_t fill_length) {
-    uint16_t row;
     uint16_t length = 0;
+    uint32_t pixels = 0;
     uint8_t adjusted_c;
+    uint16_t text = lcd_blit_color(text_color);
+    uint16_t back = lcd_blit_color(back_color);
 
+    lcd_blit_start();
     while (*c > 0) {
         adjusted_c = (*c) - (*font).start_char;
-        for (uint16_t col = 0; col < (*font).lookup[adjusted_c].width; col++) {
-            row = 0;
-            uint16_t rows = (*font).lookup[adjusted_c].height;
-            uint16_t offset = (*font).lookup[adjusted_c].offset;
-
-            for (uint16_t page = 0; page < (*font).height_bytes; page++) {
-
-                uint8_t bitmap_char = (*font).bitmaps[offset + (col * (*font).height_bytes) + page];
-
-                for (uint8_t i = 0; i < 8; i++) {
-                    if (bitmap_char & (0b10000000 >> i)) {
-                        spi_write_blocking(BP_SPI_PORT, text_color, 2);
-                    } else {
-                        spi_write_blocking(BP_SPI_PORT, back_color, 2);
-                    }
-
-                    row++;
-                    // break out of loop when we have all the rows
-                    // some bits may be discarded because of poor packing by The Dot Factory
-                    if (row == rows) {
-                        break;
-                    }
-                }
-            }
-        }
-        // depending on how the font fits in the bitmap,
-        // there may or may not be enough right hand padding between characters
-        // this adds a configurable amount of space
-        uint16_t needed_padding = (*font).lookup[adjusted_c].height * (*font).right_padding;
-        for (uint16_t pad = 0; pad < needed_padding; pad++) {
-            spi_write_blocking(BP_SPI_PORT, back_color, 2);
-        }
+        pixels += lcd_write_glyph(font, adjusted_c, text, back);
         (c)++;
         length++; // how many characters have we written
     }
@@ -178,10 +263,11 @@ void lcd_write_string(
     if (length < fill_length) {
         uint32_t fill = (fill_length - length) * ((*font).lookup[adjusted_c].height *
                                                   ((*font).right_padding + (*font).lookup[adjusted_c].width));
-        for (uint32_t i = 0; i < fill; i++) {
-            spi_write_blocking(BP_SPI_PORT, back_color, 2);
-        }
+        lcd_blit_fill(back, fill);
+        pixels += fill;
     }
+    lcd_blit_end();
+    lcd_update_stats.frame_bytes += pixels * 2;
 }
 
 uint16_t lcd_get_col(const struct display_layout* layout, const FONT_INFO* font, uint8_t col) {
@@ -224,6 +310,8 @@ void lcd_paint_background(void) {
 }
 
 void ui_lcd_update(uint32_t update_flags) {
+    lcd_update_stats.frame_bytes = 0;
+
     if (update_flags & UI_UPDATE_IMAGE) {
         lcd_write_background(layout.image->bitmap);
         lcd_paint_background();
@@ -324,6 +412,76 @@ void ui_lcd_update(uint32_t update_flags) {
                 left_margin, layout.current_top_pad, layout.font_big, colors_pallet[layout.current_color], c, 0);
         }
     }
+
+    lcd_update_stats.total_bytes += lcd_update_stats.frame_bytes;
+    lcd_update_stats.frames++;
+}
+
+// Shadow copy of the text cells on the screen
+// Each lcd_write_labels() position remembers what it drew last time,
+// only the characters that changed are sent to the LCD.
+// A cell is one character, or one blank fill space (char 0) after the string.
+#define LCD_SHADOW_SLOTS 64
+#define LCD_SHADOW_CELLS 16
+
+struct lcd_shadow_slot {
+    const FONT_INFO* font; // NULL if the slot is free
+    const uint8_t* text_color;
+    const uint8_t* back_color;
+    uint16_t left_margin;
+    uint16_t top_margin;
+    uint16_t height;
+    uint16_t extent;                     // pixels from left_margin covered by the cells
+    uint8_t count;                       // valid cells
+    uint8_t chars[LCD_SHADOW_CELLS];     // character, 0 for a blank fill cell
+    uint8_t widths[LCD_SHADOW_CELLS];    // cell width in pixels, including right padding
+};
+
+static struct lcd_shadow_slot lcd_shadow[LCD_SHADOW_SLOTS];
+static uint8_t lcd_shadow_next; // round robin replacement when all slots are in use
+
+void lcd_shadow_invalidate(void) {
+    for (uint8_t i = 0; i < LCD_SHADOW_SLOTS; i++) {
+        lcd_shadow[i].font = NULL;
+    }
+}
+
+// something else was drawn over this area, forget any slot it touches
+static void lcd_shadow_invalidate_area(
+    const struct lcd_shadow_slot* keep, uint16_t left, uint16_t right, uint16_t top, uint16_t bottom) {
+    for (uint8_t i = 0; i < LCD_SHADOW_SLOTS; i++) {
+        struct lcd_shadow_slot* s = &lcd_shadow[i];
+        if (s == keep || s->font == NULL) {
+            continue;
+        }
+        if (s->left_margin < right && left < s->left_margin + s->extent && s->top_margin < bottom &&
+            top < s->top_margin + s->height) {
+            s->font = NULL;
+        }
+    }
+}
+
+static struct lcd_shadow_slot* lcd_shadow_find(const FONT_INFO* font, uint16_t left_margin, uint16_t top_margin) {
+    struct lcd_shadow_slot* free_slot = NULL;
+    for (uint8_t i = 0; i < LCD_SHADOW_SLOTS; i++) {
+        struct lcd_shadow_slot* s = &lcd_shadow[i];
+        if (s->font == NULL) {
+            if (!free_slot) {
+                free_slot = s;
+            }
+            continue;
+        }
+        if (s->font == font && s->left_margin == left_margin && s->top_margin == top_margin) {
+            return s;
+        }
+    }
+    if (!free_slot) {
+        free_slot = &lcd_shadow[lcd_shadow_next];
+        lcd_shadow_next = (lcd_shadow_next + 1) % LCD_SHADOW_SLOTS;
+    }
+    free_slot->font = NULL;
+    free_slot->count = 0;
+    return free_slot;
 }
 
 void lcd_write_labels(uint16_t left_margin,
@@ -332,27 +490,107 @@ void lcd_write_labels(uint16_t left_margin,
                       const uint8_t* color,
                       const char* c,
                       uint16_t fill_length) {
-    lcd_set_bounding_box(left_margin,
-                         left_margin + ((240) - 1),
-                         top_margin,
-                         (top_margin + (*font).lookup[(*c) - (*font).start_char].height) - 1);
-	lcd_write_start();
-    lcd_write_string(font, layout.image->text_background_color, color, c, fill_length);
-    lcd_write_stop();
+    const uint8_t* back_color = layout.image->text_background_color;
+    uint8_t chars[LCD_SHADOW_CELLS];
+    uint8_t widths[LCD_SHADOW_CELLS];
+    uint8_t count = 0;
+    uint8_t last_c = 0;
+
+    if (*c == 0) {
+        return;
+    }
+    uint16_t height = (*font).lookup[(*c) - (*font).start_char].height;
+
+    // break the string and fill spaces into cells
+    for (const char* p = c; *p > 0; p++) {
+        if (count == LCD_SHADOW_CELLS) {
+            // too long to shadow, draw it all and forget anything underneath
+            lcd_set_bounding_box(left_margin, left_margin + ((240) - 1), top_margin, (top_margin + height) - 1);
+            lcd_write_start();
+            lcd_write_string(font, back_color, color, c, fill_length);
+            lcd_write_stop();
+            lcd_shadow_invalidate_area(NULL, left_margin, 240, top_margin, top_margin + height);
+            return;
+        }
+        last_c = (*p) - (*font).start_char;
+        chars[count] = *p;
+        widths[count] = (*font).lookup[last_c].width + (*font).right_padding;
+        count++;
+    }
+    uint8_t blanks = (fill_length > count) ? fill_length - count : 0;
+    if (count + blanks > LCD_SHADOW_CELLS) {
+        blanks = LCD_SHADOW_CELLS - count; // fill_length is a column width, never this big
+    }
+    for (uint8_t i = 0; i < blanks; i++) {
+        chars[count] = 0;
+        widths[count] = (*font).lookup[last_c].width + (*font).right_padding;
+        count++;
+    }
+
+    struct lcd_shadow_slot* s = lcd_shadow_find(font, left_margin, top_margin);
+    bool same_colors = (s->font != NULL && s->text_color == color && s->back_color == back_color);
+    bool aligned = same_colors; // cells before this one are the same width, so it is in the same place
+    uint16_t text = lcd_blit_color(color);
+    uint16_t back = lcd_blit_color(back_color);
+    uint16_t x = 0;
+    uint8_t i = 0;
+
+    while (i < count) {
+        aligned = aligned && i < s->count && s->widths[i] == widths[i];
+        if (aligned && s->chars[i] == chars[i]) {
+            x += widths[i];
+            i++;
+            lcd_update_stats.cells_skipped++;
+            continue;
+        }
+
+        // one bounding box for each run of changed cells
+        lcd_set_bounding_box(
+            left_margin + x, left_margin + x + ((240) - 1), top_margin, (top_margin + height) - 1);
+        lcd_write_start();
+        lcd_blit_start();
+        do {
+            uint32_t pixels;
+            if (chars[i]) {
+                pixels = lcd_write_glyph(font, chars[i] - (*font).start_char, text, back);
+            } else {
+                // add additional blank spaces to clear old characters off the line
+                pixels = (*font).lookup[last_c].height * widths[i];
+                lcd_blit_fill(back, pixels);
+            }
+            lcd_update_stats.frame_bytes += pixels * 2;
+            lcd_update_stats.cells_drawn++;
+            x += widths[i];
+            i++;
+            aligned = aligned && i < s->count && s->widths[i] == widths[i];
+        } while (i < count && !(aligned && s->chars[i] == chars[i]));
+        lcd_blit_end();
+        lcd_write_stop();
+    }
+
+    // anything past the new cells is no longer tracked, it may still be on the screen
+    s->font = font;
+    s->text_color = color;
+    s->back_color = back_color;
+    s->left_margin = left_margin;
+    s->top_margin = top_margin;
+    s->height = height;
+    s->extent = x;
+    s->count = count;
+    memcpy(s->chars, chars, count);
+    memcpy(s->widths, widths, count);
+    lcd_shadow_invalidate_area(s, left_margin, left_margin + x, top_margin, top_margin + height);
 }
 
 void lcd_clear(void) {
-    uint16_t x, y;
-
     lcd_set_bounding_box(0, 240, 0, 320);
 
     lcd_write_start();
-    for (x = 0; x < 240; x++) {
-        for (y = 0; y < 320; y++) {
-            spi_write_blocking(BP_SPI_PORT, colors_pallet[LCD_BLACK], 2);
-        }
-    }
+    lcd_blit_start();
+    lcd_blit_fill(lcd_blit_color(colors_pallet[LCD_BLACK]), 240 * 320);
+    lcd_blit_end();
     lcd_write_stop();
+    lcd_shadow_invalidate();
 }
 
 void lcd_set_bounding_box(uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye) {
@@ -11,6 +11,20 @@ void lcd_enable(void);
 void lcd_disable(void);
 void menu_update(uint8_t current, uint8_t next);
 void lcd_screensaver_alarm_reset(void);
+// forget the text shadow, call after anything other than ui_lcd_update() draws on the screen
+void lcd_shadow_invalidate(void);
+
+// debug counters for the text redraw
+struct lcd_update_stats {
+    uint32_t frame_bytes;   // pixel bytes sent by the last ui_lcd_update(), background and text
+    uint32_t total_bytes;   // pixel bytes sent by all ui_lcd_update() calls
+    uint32_t frames;        // ui_lcd_update() calls
+    uint32_t cells_drawn;   // characters and fill spaces sent
+    uint32_t cells_skipped; // characters and fill spaces already on the screen
+    uint32_t glyph_hits;    // characters sent from the expanded glyph cache
+    uint32_t glyph_misses;  // characters expanded from the font bitmap
+};
+extern struct lcd_update_stats lcd_update_stats;
 
 extern const uint8_t colors_pallet[][2];
 // Setup the text and background pixel colors
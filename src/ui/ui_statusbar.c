@@ -1,4 +1,6 @@
 #include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
 #include "pico/stdlib.h"
 #include <stdint.h>
 #include "pirate.h"
@@ -15,219 +17,326 @@
 #include "tusb.h"
 #include "pirate/psu.h"
 
+// The status bar is kept as a shadow copy of what the terminal shows,
+// one character and one color style per column for each of the four rows.
+// Every update renders the rows into a scratch line and only the columns
+// that differ from the shadow are sent, with cursor positioning.
+// A voltage digit change costs a few dozen bytes instead of the whole bar.
+#define SB_ROWS 4
+#define SB_COLS 256      // widest terminal we track, wider ones are clipped
+#define SB_CELL_COLS 8   // one tab stop per pin
+#define SB_RUN_GAP 8     // unchanged columns re-sent to join two changed runs
+#define SB_ECH_MIN 6     // runs of spaces this long are sent as erase characters
+
+enum sb_row {
+    SB_ROW_INFO,
+    SB_ROW_NAMES,
+    SB_ROW_LABELS,
+    SB_ROW_VALUES,
+};
+
+// style is the high nibble, pin number for SB_STYLE_NAME is the low nibble
+enum sb_style {
+    SB_STYLE_DEFAULT = 0x00,
+    SB_STYLE_NUM = 0x10,
+    SB_STYLE_NAME = 0x20,
+    SB_STYLE_INFO = 0x30,
+};
+
+typedef struct {
+    char c[SB_COLS];
+    uint8_t style[SB_COLS];
+} sb_line_t;
+
+static sb_line_t sb_shadow[SB_ROWS]; // c == 0 means unknown, always redrawn
+static sb_line_t sb_next;
+static bool sb_retry;
+
+static void sb_line_clear(sb_line_t* line, uint8_t style) {
+    memset(line->c, ' ', sizeof(line->c));
+    memset(line->style, style, sizeof(line->style));
+}
+
+// write a string at col, clipped to max columns, returns the columns used
+static uint16_t sb_line_put(sb_line_t* line, uint16_t col, uint16_t max, uint8_t style, const char* s) {
+    uint16_t n = 0;
+    while (s[n] && n < max && col + n < SB_COLS) {
+        line->c[col + n] = s[n];
+        line->style[col + n] = style;
+        n++;
+    }
+    return n;
+}
+
+// append to the status bar buffer, false (and nothing appended) if it doesn't fit
+static bool sb_printf(char* buf, uint32_t* len, size_t buffLen, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(&buf[*len], buffLen - *len, format, args);
+    va_end(args);
+    if (n < 0 || *len + n >= buffLen) {
+        buf[*len] = 0x00;
+        return false;
+    }
+    *len += n;
+    return true;
+}
+
+static bool sb_style(char* buf, uint32_t* len, size_t buffLen, uint8_t style) {
+    char color[48] = { 0 };
+    switch (style & 0xf0) {
+        case SB_STYLE_NUM:
+            return sb_printf(buf, len, buffLen, "%s%s", ui_term_color_reset(), ui_term_color_num_float());
+        case SB_STYLE_NAME:
+            ui_term_color_text_background_buf(color,
+                                              sizeof(color),
+                                              hw_pin_label_ordered_color[style & 0x0f][0],
+                                              hw_pin_label_ordered_color[style & 0x0f][1]);
+            return sb_printf(buf, len, buffLen, "%s", color);
+        case SB_STYLE_INFO:
+            ui_term_color_text_background_buf(color, sizeof(color), 0x000000, BP_COLOR_GREY);
+            return sb_printf(buf, len, buffLen, "%s", color);
+        case SB_STYLE_DEFAULT:
+        default:
+            return sb_printf(buf, len, buffLen, "%s", ui_term_color_reset());
+    }
+}
+
+static inline bool sb_changed(const sb_line_t* shadow, uint16_t col) {
+    return shadow->c[col] != sb_next.c[col] || shadow->style[col] != sb_next.style[col];
+}
+
+// send the columns of sb_next that differ from the shadow, returns false if the buffer filled up
+static bool sb_line_delta(char* buf, uint32_t* len, size_t buffLen, uint8_t row, uint16_t screen_row, uint16_t width) {
+    sb_line_t* shadow = &sb_shadow[row];
+    uint16_t x = 0;
+
+    while (x < width) {
+        if (!sb_changed(shadow, x)) {
+            x++;
+            continue;
+        }
+
+        // extend the run over short gaps of unchanged columns
+        uint16_t last = x;
+        for (uint16_t k = x + 1; k < width && k - last <= SB_RUN_GAP; k++) {
+            if (sb_changed(shadow, k)) {
+                last = k;
+            }
+        }
+        uint16_t end = last + 1;
+
+        uint32_t run_start = *len;
+        bool ok = sb_printf(buf, len, buffLen, "\033[%d;%dH", screen_row, x + 1);
+        int16_t style = -1;
+        uint16_t k = x;
+        while (ok && k < end) {
+            if (sb_next.style[k] != style) {
+                style = sb_next.style[k];
+                ok = sb_style(buf, len, buffLen, style);
+                continue;
+            }
+            uint16_t spaces = 0;
+            while (k + spaces < end && sb_next.c[k + spaces] == ' ' && sb_next.style[k + spaces] == style) {
+                spaces++;
+            }
+            if (spaces >= SB_ECH_MIN) {
+                // erase in the current background color, then step over it
+                ok = sb_printf(buf, len, buffLen, "\033[%dX", spaces);
+                k += spaces;
+                if (ok && k < end) {
+                    ok = sb_printf(buf, len, buffLen, "\033[%dC", spaces);
+                }
+                continue;
+            }
+            ok = sb_printf(buf, len, buffLen, "%c", sb_next.c[k]);
+            k++;
+        }
+
+        if (!ok) {
+            // drop the partial run, the shadow still differs so it goes out next time
+            *len = run_start;
+            return false;
+        }
+        memcpy(&shadow->c[x], &sb_next.c[x], end - x);
+        memcpy(&shadow->style[x], &sb_next.style[x], end - x);
+        x = end;
+    }
+    return true;
+}
+
+// info bar text, without colors
 uint32_t ui_statusbar_info(char* buf, size_t buffLen) {
     uint32_t len = 0;
-    uint32_t temp = 0;
-    uint32_t cnt = 0;
-
-    len += ui_term_color_text_background_buf(&buf[len], buffLen - len, 0x000000, BP_COLOR_GREY);
 
     if (psu_status.enabled) {
-        temp = snprintf(&buf[len],
+        len += snprintf(&buf[len],
                         buffLen - len,
                         "Vout: %u.%uV",
                         (psu_status.voltage_actual_int) / 10000,
                         ((psu_status.voltage_actual_int) % 10000) / 100);
-        len += temp;
-        cnt += temp;
 
         if (!psu_status.current_limit_override) {
-            temp = snprintf(&buf[len],
+            len += snprintf(&buf[len],
                             buffLen - len,
                             "/%u.%umA max",
                             (psu_status.current_actual_int) / 10000,
                             ((psu_status.current_actual_int) % 10000) / 100);
-            len += temp;
-            cnt += temp;
         }
 
         if(!psu_status.undervoltage_limit_override){
-            temp = snprintf(&buf[len],
+            len += snprintf(&buf[len],
                             buffLen - len,
                             "/%u.%uV min",
                             (psu_status.undervoltage_limit_int) / 10000,
                             ((psu_status.undervoltage_limit_int) % 10000) / 100);
-            len += temp;
-            cnt += temp;
         }
-        temp = snprintf(&buf[len], buffLen - len, " | ");
-        len += temp;
-        cnt += temp;
+        len += snprintf(&buf[len], buffLen - len, " | ");
     }
 
     if (psu_status.error_overcurrent) {
         // show Power Supply: ERROR
-        temp = snprintf(&buf[len],
+        len += snprintf(&buf[len],
                         buffLen - len,
                         "Vout: ERROR > %u.%umA | ",
                         (psu_status.current_actual_int) / 10000,
                         ((psu_status.current_actual_int) % 10000) / 100);
-        len += temp;
-        cnt += temp;
     }else if (psu_status.error_undervoltage){
         // show Power Supply: ERROR
-        temp = snprintf(&buf[len],
+        len += snprintf(&buf[len],
                         buffLen - len,
                         "Vout: ERROR < %u.%uV | ",
                         (psu_status.undervoltage_limit_int) / 10000,
                         ((psu_status.undervoltage_limit_int) % 10000) / 100);
-        len += temp;
-        cnt += temp;
     }
 
     if (system_config.pullup_enabled) {
         // show Pull-up resistors ON
-        temp = snprintf(&buf[len],
+        len += snprintf(&buf[len],
                         buffLen - len,
                         "Pull-ups: ON | ");
-        len += temp;
-        cnt += temp;
     }
     if (scope_running) { // scope is using the analog subsystem
-        temp = snprintf(&buf[len], buffLen - len, "V update slower when scope running");
-        len += temp;
-        cnt += temp;
+        len += snprintf(&buf[len], buffLen - len, "V update slower when scope running");
     }
-    // fill in blank space
-    len += snprintf(&buf[len], buffLen - len, "\033[%dX", system_config.terminal_ansi_columns - cnt);
-    len += snprintf(&buf[len], buffLen - len, "%s", ui_term_color_reset()); // snprintf to buffer
     return len;
 }
 
-// show voltages/pinstates
-uint32_t ui_statusbar_names(char* buf, size_t buffLen) {
-    uint32_t len = 0;
-    // pin list
+// show pin names in the pin colors
+static void ui_statusbar_names(sb_line_t* line) {
+    char c[SB_CELL_COLS + 1];
     for (int i = 0; i < HW_PINS; i++) {
-        len += ui_term_color_text_background_buf(
-            &buf[len], buffLen - len, hw_pin_label_ordered_color[i][0], hw_pin_label_ordered_color[i][1]);
-        len += snprintf(&buf[len], buffLen - len, "\033[8X"); // clear existing
-        len += snprintf(&buf[len], buffLen - len, "%d.%s\t", i + 1, hw_pin_label_ordered[i]);
+        uint16_t col = i * SB_CELL_COLS;
+        sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_NAME | i, "        ");
+        snprintf(c, sizeof(c), "%d.%s", i + 1, hw_pin_label_ordered[i]);
+        sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_NAME | i, c);
     }
-
-    len += snprintf(&buf[len], buffLen - len, "%s", ui_term_color_reset());
-    return len;
 }
 
-bool label_default(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
-    if (system_config.pin_changed & (0x01 << (uint8_t)i)) {
-        *len += snprintf(&buf[*len],
-                         buffLen - *len,
-                         "\033[8X%s\t",
-                         system_config.pin_labels[i] == 0 ? "-" : (char*)system_config.pin_labels[i]);
-        return true;
-    }
-    return false;
+static void label_default(sb_line_t* line, uint16_t col, uint32_t i) {
+    sb_line_put(line,
+                col,
+                SB_CELL_COLS,
+                SB_STYLE_DEFAULT,
+                system_config.pin_labels[i] == 0 ? "-" : (char*)system_config.pin_labels[i]);
 }
 
-bool label_current(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
-    // uint32_t isense;
+static void label_current(sb_line_t* line, uint16_t col, uint32_t i) {
     char* c;
-    if (monitor_get_current_ptr(&c) || (system_config.pin_changed & (0x01 << (uint8_t)i))) {
-        *len += snprintf(
-            &buf[*len], buffLen - *len, "\033[8X%s%s%smA\t", ui_term_color_num_float(), c, ui_term_color_reset());
-        return true;
-    }
-    return false;
+    monitor_get_current_ptr(&c);
+    // n is clipped to the cell, a value wider than the cell leaves no room for the unit
+    uint16_t n = sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_NUM, c);
+    sb_line_put(line, col + n, SB_CELL_COLS - n, SB_STYLE_DEFAULT, "mA");
 }
 
-bool value_voltage(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
+static void value_voltage(sb_line_t* line, uint16_t col, uint32_t i) {
     char* c;
-    if (monitor_get_voltage_ptr(i, &c)) {
-        *len += snprintf(&buf[*len], buffLen - *len, "%s%s%sV\t", ui_term_color_num_float(), c, ui_term_color_reset());
-        return true;
-    }
-
-    return false;
+    monitor_get_voltage_ptr(i, &c);
+    uint16_t n = sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_NUM, c);
+    sb_line_put(line, col + n, SB_CELL_COLS - n, SB_STYLE_DEFAULT, "V");
 }
 
-// TODO: freq function (update on change), pwm function (write once, untill update)
-bool value_freq(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
-    *len += snprintf(&buf[*len], buffLen - *len, "\033[8X"); // clear out tab, return to tab
+static void value_freq(sb_line_t* line, uint16_t col, uint32_t i) {
+    char c[SB_CELL_COLS + 1];
+    char units[2] = { 0 };
     float freq_friendly_value;
     uint8_t freq_friendly_units;
     freq_display_hz(&system_config.freq_config[i - 1].period, &freq_friendly_value, &freq_friendly_units);
-    *len += snprintf(&buf[*len],
-                     buffLen - *len,
-                     "%s%3.1f%s%c\t",
-                     ui_term_color_num_float(),
-                     freq_friendly_value,
-                     ui_term_color_reset(),
-                     *ui_const_freq_labels_short[freq_friendly_units]);
-    return true;
+    snprintf(c, sizeof(c), "%3.1f", freq_friendly_value);
+    units[0] = *ui_const_freq_labels_short[freq_friendly_units];
+    uint16_t n = sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_NUM, c);
+    sb_line_put(line, col + n, SB_CELL_COLS - n, SB_STYLE_DEFAULT, units);
 }
 
-bool value_pwm(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
-
-    if (!(system_config.pin_changed & (0x01 << (uint8_t)(i)))) {
-        return false;
-    }
-
-    return value_freq(len, buffLen, buf, i);
+static void value_ground(sb_line_t* line, uint16_t col, uint32_t i) {
+    sb_line_put(line, col, SB_CELL_COLS, SB_STYLE_DEFAULT, GET_T(T_GND));
 }
 
-bool value_ground(uint32_t* len, size_t buffLen, char* buf, uint32_t i) {
-    if (!(system_config.pin_changed & (0x01 << (uint8_t)(i)))) {
-        return false;
-    }
-
-    *len += snprintf(&buf[*len], buffLen - *len, "%s", GET_T(T_GND));
-    return true;
-}
 struct _iopins {
-    // bool (*name)(uint32_t *len, char *buf, uint32_t i);
-    bool (*label)(uint32_t* len, size_t buffLen, char* buf, uint32_t i);
-    bool (*value)(uint32_t* len, size_t buffLen, char* buf, uint32_t i);
+    void (*label)(sb_line_t* line, uint16_t col, uint32_t i);
+    void (*value)(sb_line_t* line, uint16_t col, uint32_t i);
 };
 
 const struct _iopins ui_statusbar_pin_functions[] = {
     [BP_PIN_IO] = { &label_default, &value_voltage },    [BP_PIN_MODE] = { &label_default, &value_voltage },
-    [BP_PIN_PWM] = { &label_default, &value_pwm },       [BP_PIN_FREQ] = { &label_default, &value_freq },
+    [BP_PIN_PWM] = { &label_default, &value_freq },      [BP_PIN_FREQ] = { &label_default, &value_freq },
     [BP_PIN_VREF] = { &label_default, &value_voltage },  [BP_PIN_VOUT] = { &label_current, &value_voltage },
     [BP_PIN_GROUND] = { &label_default, &value_ground }, [BP_PIN_DEBUG] = { &label_default, &value_voltage }
 
 };
 
-uint32_t ui_statusbar_labels(char* buf, size_t buffLen) {
-    uint32_t len = 0;
-    uint8_t j = 0;
-
-    // show state of IO pins
+static void ui_statusbar_labels(sb_line_t* line) {
     for (uint i = 0; i < HW_PINS; i++) {
-
-        if (system_config.pin_changed & (0x01 << (uint8_t)i)) {
-            len += snprintf(&buf[len], buffLen - len, "\033[8X"); // clear out tab, return to tab
-        }
-
-        if (!ui_statusbar_pin_functions[system_config.pin_func[i]].label(&len, buffLen, buf, i)) {
-            len += snprintf(&buf[len], buffLen - len, "\t"); // todo: just handle this
-        }
+        ui_statusbar_pin_functions[system_config.pin_func[i]].label(line, i * SB_CELL_COLS, i);
     }
-
-    return len;
 }
 
-uint32_t ui_statusbar_value(char* buf, size_t buffLen) {
-    uint32_t len = 0;
-
-    bool do_update = false;
-
-    // show state of IO pins
+static void ui_statusbar_value(sb_line_t* line) {
     for (uint i = 0; i < HW_PINS; i++) {
+        ui_statusbar_pin_functions[system_config.pin_func[i]].value(line, i * SB_CELL_COLS, i);
+    }
+}
 
-        if (system_config.pin_changed & (0x01 << (uint8_t)i)) {
-            len += snprintf(&buf[len], buffLen - len, "\033[8X"); // clear out tab, return to tab
-        }
+// render one row into sb_next and send the difference
+static bool ui_statusbar_row(char* buf, uint32_t* len, size_t buffLen, uint8_t row) {
+    uint16_t width = system_config.terminal_ansi_columns;
+    if (width > SB_COLS) {
+        width = SB_COLS;
+    }
 
-        if (ui_statusbar_pin_functions[system_config.pin_func[i]].value(&len, buffLen, buf, i)) {
-            do_update = true;
-        } else {
-            len += snprintf(&buf[len], buffLen - len, "\t"); // todo: just handle this
+    switch (row) {
+        case SB_ROW_INFO: {
+            char info[SB_COLS + 1];
+            sb_line_clear(&sb_next, SB_STYLE_INFO);
+            ui_statusbar_info(info, sizeof(info));
+            sb_line_put(&sb_next, 0, SB_COLS, SB_STYLE_INFO, info);
+            break;
         }
+        case SB_ROW_NAMES:
+            sb_line_clear(&sb_next, SB_STYLE_DEFAULT);
+            ui_statusbar_names(&sb_next);
+            break;
+        case SB_ROW_LABELS:
+            sb_line_clear(&sb_next, SB_STYLE_DEFAULT);
+            ui_statusbar_labels(&sb_next);
+            break;
+        case SB_ROW_VALUES:
+        default:
+            sb_line_clear(&sb_next, SB_STYLE_DEFAULT);
+            ui_statusbar_value(&sb_next);
+            break;
     }
+    // info is row-3, values are on the last row
+    return sb_line_delta(buf, len, buffLen, row, system_config.terminal_ansi_rows - 3 + row, width);
+}
 
-    return (do_update ? len : 0);
+// forget what the terminal shows, the next update redraws the whole status bar
+static void ui_statusbar_invalidate(void) {
+    for (uint8_t i = 0; i < SB_ROWS; i++) {
+        memset(sb_shadow[i].c, 0, sizeof(sb_shadow[i].c));
+    }
 }
+
 void ui_statusbar_update_blocking() {
     BP_ASSERT_CORE0(); // if called from core1, this will deadlock
     if(!tud_cdc_n_connected(0)) return;
@@ -240,57 +349,45 @@ void ui_statusbar_update_from_core1(uint32_t update_flags) {
     uint32_t len = 0;
     size_t buffLen = sizeof(tx_sb_buf);
 
-    if (!update_flags) // nothing to update
+    // a full update is a request to repaint (new terminal, cls, resize)
+    if ((update_flags & UI_UPDATE_ALL) == UI_UPDATE_ALL) {
+        ui_statusbar_invalidate();
+    }
+
+    if (!update_flags && !sb_retry) // nothing to update
     {
         return;
     }
 
+    // the last update is still going out, the shadow already has it
+    // try again next time rather than overwrite the buffer
+    if (tx_sb_buf_ready) {
+        sb_retry = true;
+        return;
+    }
+    sb_retry = false;
+
     // save cursor, hide cursor
     // NOTE: \033 is the escape character, but a following digit is pulled into the hex value.
     //       How to avoid non-portable escape sequence?
     len += snprintf(&tx_sb_buf[len], buffLen - len, "\0337\033[?25l");
-
-    // print each line of the toolbar
-    if (update_flags & UI_UPDATE_INFOBAR) {
-        monitor_force_update(); // we want to repaint the whole screen if we're doing the pin names...
-        len += snprintf(&tx_sb_buf[len],
-                        buffLen - len,
-                        "\033[%d;0H",
-                        system_config.terminal_ansi_rows - 3); // position at row-3 col=0
-        len += ui_statusbar_info(&tx_sb_buf[len], buffLen - len);
-    }
-
-    if (update_flags & UI_UPDATE_NAMES) {
-        len += snprintf(&tx_sb_buf[len], buffLen - len, "\033[%d;0H", system_config.terminal_ansi_rows - 2);
-        len += ui_statusbar_names(&tx_sb_buf[len], buffLen - len);
-    }
-
-    if ((update_flags & UI_UPDATE_CURRENT) && !(update_flags & UI_UPDATE_LABELS)) // show current under Vout
-    {
-        char* c;
-        if (monitor_get_current_ptr(&c)) {
-            len += snprintf(&tx_sb_buf[len],
-                            buffLen - len,
-                            "\033[%d;0H%s%s%smA",
-                            system_config.terminal_ansi_rows - 1,
-                            ui_term_color_num_float(),
-                            c,
-                            ui_term_color_reset());
+    uint32_t header_len = len;
+
+    // leave room to restore the cursor
+    size_t rows_buffLen = buffLen - 16;
+    for (uint8_t row = 0; row < SB_ROWS; row++) {
+        if (!ui_statusbar_row(tx_sb_buf, &len, rows_buffLen, row)) {
+            sb_retry = true; // out of space, the rest goes out next time
+            break;
         }
     }
 
-    if (update_flags & UI_UPDATE_LABELS) {
-        len += snprintf(&tx_sb_buf[len], buffLen - len, "\033[%d;0H", system_config.terminal_ansi_rows - 1);
-        len += ui_statusbar_labels(&tx_sb_buf[len], buffLen - len);
-    }
-
-    if (update_flags & UI_UPDATE_VOLTAGES) {
-        len += snprintf(&tx_sb_buf[len], buffLen - len, "\033[%d;0H", system_config.terminal_ansi_rows - 0);
-        len += ui_statusbar_value(&tx_sb_buf[len], buffLen - len);
+    if (len == header_len) { // nothing changed
+        return;
     }
 
     // restore cursor, show cursor
-    len += snprintf(&tx_sb_buf[len], buffLen - len, "\0338");
+    len += snprintf(&tx_sb_buf[len], buffLen - len, "%s\0338", ui_term_color_reset());
 
     if (!system_config.terminal_hide_cursor) {
         len += snprintf(&tx_sb_buf[len], buffLen - len, "\033[?25h");
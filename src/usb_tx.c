@@ -24,6 +24,7 @@
 #include "hardware/dma.h"
 #include "hardware/uart.h"
 #include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "usb_rx.h"
 #include "usb_tx.h"
 #include "tusb.h"
@@ -204,19 +205,36 @@ void tx_fifo_service(void) {
     return;
 }
 
+// core1 sleeps when idle, __sev() is the doorbell that wakes it to drain the FIFOs
 void tx_fifo_put(char* c) {
     BP_ASSERT_CORE0(); // tx fifo shoudl only be added to from core 0 (deadlock risk)
     spsc_queue_add_blocking(&tx_fifo, (uint8_t)*c);
+    __sev();
 }
 
 void tx_fifo_try_put(char* c) {
     BP_ASSERT_CORE0(); // tx fifo shoudl only be added to from core 0 (deadlock risk)
     spsc_queue_try_add(&tx_fifo, (uint8_t)*c);
+    __sev();
 }
 
 void bin_tx_fifo_put(const char c) {
     BP_ASSERT_CORE0(); // tx fifo shoudl only be added to from core 0 (deadlock risk)
     spsc_queue_add_blocking(&bin_tx_fifo, (uint8_t)c);
+    __sev();
+}
+
+bool bin_tx_fifo_try_write(const uint8_t* buf, uint32_t len) {
+    BP_ASSERT_CORE0(); // tx fifo shoudl only be added to from core 0 (deadlock risk)
+    // all or nothing so binary frames are never split, free space only grows while core1 drains
+    if (spsc_queue_free(&bin_tx_fifo) < len) {
+        return false;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        spsc_queue_try_add(&bin_tx_fifo, buf[i]);
+    }
+    __sev();
+    return true;
 }
 
 bool bin_tx_fifo_try_get(char* c) {
@@ -251,6 +269,11 @@ void bin_tx_fifo_service(void) {
     tud_cdc_n_write_flush(1);
 }
 
+bool tx_fifo_not_empty(void) {
+    // OK to check empty from either core
+    return !spsc_queue_is_empty(&tx_fifo);
+}
+
 bool bin_tx_not_empty(void) {
     // OK to check empty from either core
     return !spsc_queue_is_empty(&bin_tx_fifo);
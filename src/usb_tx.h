@@ -38,11 +38,25 @@ void tx_sb_start(uint32_t valid_characters_in_status_bar);
  */
 void bin_tx_fifo_put(const char c);
 
+/**
+ * @brief Put a whole frame in binary transmit FIFO if there is room.
+ * @param buf  Data to transmit
+ * @param len  Number of bytes
+ * @return     true if queued, false if the FIFO is too full (nothing queued)
+ */
+bool bin_tx_fifo_try_write(const uint8_t* buf, uint32_t len);
+
 /**
  * @brief Service binary transmit FIFO.
  */
 void bin_tx_fifo_service(void);
 
+/**
+ * @brief Check if terminal TX FIFO not empty.
+ * @return  true if data pending
+ */
+bool tx_fifo_not_empty(void);
+
 /**
  * @brief Check if binary TX FIFO not empty.
  * @return  true if data pending
@@ -56,4 +70,5 @@ bool bin_tx_not_empty(void);
  */
 bool bin_tx_fifo_try_get(char* c);
 
-extern char tx_sb_buf[1024];
\ No newline at end of file
+extern char tx_sb_buf[1024];
+extern bool tx_sb_buf_ready; // status bar buffer queued and not yet sent
\ No newline at end of file
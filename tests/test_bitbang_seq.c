@@ -0,0 +1,287 @@
+/**
+ * @file test_bitbang_seq.c
+ * @brief Host-side test for the pin bytecode to PIO sequence compiler
+ *
+ * Compiles bytecode runs with the 2-wire/3-wire instruction encoding and
+ * replays the FIFO words the way the PIO program's escape mechanism runs
+ * them, checking the pin pattern edge by edge.
+ *
+ * Build & run:
+ *   gcc -O2 -Wall -Wextra -Isrc \
+ *       -o tests/test_bitbang_seq tests/test_bitbang_seq.c src/pirate/bitbang_seq.c
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pirate/bitbang_seq.h"
+
+/* ------------------------------------------------------------------ */
+/* Test infrastructure                                                */
+/* ------------------------------------------------------------------ */
+
+#define TEST_PASS  0
+#define TEST_FAIL  1
+
+static int tests_run    = 0;
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define RUN_TEST(fn)                                                    \
+    do {                                                                \
+        tests_run++;                                                    \
+        printf("  [RUN]  %s\n", #fn);                                  \
+        if ((fn)() == TEST_PASS) {                                      \
+            tests_passed++;                                             \
+            printf("  [PASS] %s\n", #fn);                               \
+        } else {                                                        \
+            tests_failed++;                                             \
+            printf("  [FAIL] %s\n", #fn);                               \
+        }                                                               \
+    } while (0)
+
+#define ASSERT_TRUE(cond, msg)                                          \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            printf("    ASSERT FAILED: %s (%s:%d)\n",                   \
+                   msg, __FILE__, __LINE__);                            \
+            return TEST_FAIL;                                           \
+        }                                                               \
+    } while (0)
+
+#define ASSERT_EQ(a, b, msg)                                            \
+    do {                                                                \
+        if ((a) != (b)) {                                               \
+            printf("    ASSERT_EQ FAILED: %s  (%u != %u) (%s:%d)\n",   \
+                   msg, (unsigned)(a), (unsigned)(b),                   \
+                   __FILE__, __LINE__);                                 \
+            return TEST_FAIL;                                           \
+        }                                                               \
+    } while (0)
+
+/* ------------------------------------------------------------------ */
+/* Encoding and replay                                                */
+/* ------------------------------------------------------------------ */
+
+/* set pins, 0 side 0 [7], data is the set value, clock the side-set bit */
+static const struct bb_seq_encoding enc = {
+    .set = 0xf700,
+    .dat = 1u << 0,
+    .clk = 1u << 11,
+    .nop = 0xa042,
+    .icount_lsb = 10,
+};
+
+/* pin levels after each executed instruction, as 'C'/'c' + 'D'/'d' pairs */
+static char pattern[4096];
+
+/* Run the FIFO words like the PIO program: an escape word with count n
+ * executes the next n + 1 words. Returns -1 on a malformed stream. */
+static int replay(const uint16_t* words, uint32_t n, uint32_t* blocks) {
+    uint32_t i = 0;
+    size_t p = 0;
+    *blocks = 0;
+    pattern[0] = 0;
+    while (i < n) {
+        uint32_t count = (words[i] >> enc.icount_lsb) & 0x3f;
+        if (count == 0 || (words[i] & ((1u << enc.icount_lsb) - 1))) {
+            return -1; /* a data record, not an escape */
+        }
+        i++;
+        (*blocks)++;
+        for (uint32_t j = 0; j <= count; j++, i++) {
+            if (i >= n) {
+                return -1;
+            }
+            if (words[i] == enc.nop) {
+                continue;
+            }
+            if ((words[i] & 0xe000) != 0xe000) {
+                return -1; /* not a set instruction */
+            }
+            pattern[p++] = (words[i] & enc.clk) ? 'C' : 'c';
+            pattern[p++] = (words[i] & enc.dat) ? 'D' : 'd';
+        }
+    }
+    pattern[p] = 0;
+    return 0;
+}
+
+static struct _bytecode op(uint8_t command, uint32_t repeat) {
+    struct _bytecode b;
+    memset(&b, 0, sizeof(b));
+    b.command = command;
+    b.repeat = repeat;
+    return b;
+}
+
+/* ------------------------------------------------------------------ */
+/* Tests                                                              */
+/* ------------------------------------------------------------------ */
+
+static int test_pin_ops(void) {
+    /* _ / - \ : data low, clock high, data high, clock low */
+    struct _bytecode code[] = {
+        op(SYN_SET_DAT_LOW, 1),
+        op(SYN_SET_CLK_HIGH, 1),
+        op(SYN_SET_DAT_HIGH, 1),
+        op(SYN_SET_CLK_LOW, 1),
+    };
+    struct bb_seq_state state = { .clk = false, .dat = true };
+    uint16_t words[16];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 4, &enc, &state, words, 16, &consumed);
+
+    ASSERT_EQ(consumed, 4, "all ops compiled");
+    ASSERT_EQ(n, 5, "escape word + 4 instructions");
+    ASSERT_EQ(words[0], 3u << 10, "escape runs 4 instructions");
+    ASSERT_EQ(words[1], 0xf700, "clock low, data low");
+    ASSERT_EQ(words[2], 0xff00, "clock high, data low");
+    ASSERT_EQ(words[3], 0xff01, "clock high, data high");
+    ASSERT_EQ(words[4], 0xf701, "clock low, data high");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_TRUE(strcmp(pattern, "cdCdCDcD") == 0, "pattern");
+    ASSERT_TRUE(!state.clk && state.dat, "final state");
+    return TEST_PASS;
+}
+
+static int test_single_op_padded(void) {
+    struct _bytecode code[] = { op(SYN_SET_CLK_HIGH, 1) };
+    struct bb_seq_state state = { .clk = false, .dat = true };
+    uint16_t words[8];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 1, &enc, &state, words, 8, &consumed);
+
+    /* same shape as pio_hw2wire_set_mask(): escape, nop, set */
+    ASSERT_EQ(n, 3, "escape + pad + instruction");
+    ASSERT_EQ(words[0], 1u << 10, "escape runs 2 instructions");
+    ASSERT_EQ(words[1], 0xa042, "nop first");
+    ASSERT_EQ(words[2], 0xff01, "clock high, data kept high");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_TRUE(strcmp(pattern, "CD") == 0, "pattern");
+    return TEST_PASS;
+}
+
+static int test_tick(void) {
+    /* clock starts high: pulled low first, then 3 x (high, low) */
+    struct _bytecode code[] = { op(SYN_TICK_CLOCK, 3) };
+    struct bb_seq_state state = { .clk = true, .dat = false };
+    uint16_t words[16];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 1, &enc, &state, words, 16, &consumed);
+
+    ASSERT_EQ(consumed, 1, "tick compiled");
+    ASSERT_EQ(n, 8, "escape + 7 instructions");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_TRUE(strcmp(pattern, "cdCdcdCdcdCdcd") == 0, "pattern");
+    ASSERT_TRUE(!state.clk, "clock ends low");
+    return TEST_PASS;
+}
+
+static int test_stops_at_other_op(void) {
+    struct _bytecode code[] = {
+        op(SYN_SET_DAT_HIGH, 1),
+        op(SYN_SET_CLK_HIGH, 1),
+        op(SYN_READ_DAT, 1),
+        op(SYN_SET_CLK_LOW, 1),
+    };
+    struct bb_seq_state state = { 0 };
+    uint16_t words[16];
+    uint32_t consumed, blocks;
+
+    ASSERT_EQ(bb_seq_run_length(code, 4), 2, "run ends at the bit read");
+    ASSERT_TRUE(!bb_seq_is_pin_op(SYN_WRITE), "write isn't a pin op");
+    ASSERT_TRUE(!bb_seq_is_pin_op(SYN_ADC + 1), "out of range");
+
+    uint32_t n = bb_seq_compile(code, 4, &enc, &state, words, 16, &consumed);
+    ASSERT_EQ(consumed, 2, "compiled up to the bit read");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_TRUE(strcmp(pattern, "cDCD") == 0, "pattern");
+    return TEST_PASS;
+}
+
+static int test_long_run_blocks(void) {
+    /* 100 ticks = 200 instructions, split into escape blocks of 64 */
+    struct _bytecode code[] = { op(SYN_TICK_CLOCK, 100) };
+    struct bb_seq_state state = { 0 };
+    uint16_t words[256];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 1, &enc, &state, words, 256, &consumed);
+
+    ASSERT_EQ(consumed, 1, "tick compiled");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_EQ(blocks, 4, "64 + 64 + 64 + 8");
+    ASSERT_EQ(n, 204, "instructions + escape words");
+    ASSERT_EQ(strlen(pattern), 400, "200 pin states");
+    for (size_t i = 0; i < 400; i += 4) {
+        ASSERT_TRUE(pattern[i] == 'C' && pattern[i + 2] == 'c', "high, low");
+    }
+    return TEST_PASS;
+}
+
+static int test_last_block_single_padded(void) {
+    /* 65 instructions: a full block and a padded one */
+    struct _bytecode code[65];
+    for (int i = 0; i < 65; i++) {
+        code[i] = op((i & 1) ? SYN_SET_DAT_LOW : SYN_SET_DAT_HIGH, 1);
+    }
+    struct bb_seq_state state = { 0 };
+    uint16_t words[128];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 65, &enc, &state, words, 128, &consumed);
+
+    ASSERT_EQ(consumed, 65, "all ops compiled");
+    ASSERT_EQ(n, 68, "64 + escape, nop + 1 + escape");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_EQ(blocks, 2, "two blocks");
+    ASSERT_EQ(strlen(pattern), 130, "65 pin states");
+    ASSERT_TRUE(pattern[128] == 'c' && pattern[129] == 'D', "last is data high");
+    return TEST_PASS;
+}
+
+static int test_buffer_full(void) {
+    struct _bytecode code[] = {
+        op(SYN_SET_DAT_HIGH, 1),
+        op(SYN_TICK_CLOCK, 10),
+        op(SYN_SET_DAT_LOW, 1),
+    };
+    struct bb_seq_state state = { 0 };
+    uint16_t words[12];
+    uint32_t consumed, blocks;
+    uint32_t n = bb_seq_compile(code, 3, &enc, &state, words, 12, &consumed);
+
+    /* the tick needs 20 instructions, only the first op fits */
+    ASSERT_EQ(consumed, 1, "stopped before the tick");
+    ASSERT_TRUE(n <= 12, "inside the buffer");
+    ASSERT_TRUE(replay(words, n, &blocks) == 0, "valid stream");
+    ASSERT_TRUE(strcmp(pattern, "cD") == 0, "pattern");
+    ASSERT_TRUE(state.dat && !state.clk, "state after the first op only");
+
+    n = bb_seq_compile(&code[1], 1, &enc, &state, words, 4, &consumed);
+    ASSERT_EQ(consumed, 0, "op bigger than the buffer");
+    ASSERT_EQ(n, 0, "nothing written");
+    return TEST_PASS;
+}
+
+/* ------------------------------------------------------------------ */
+
+int main(void) {
+    printf("\n=== Bitbang Sequence Test Suite ===\n\n");
+
+    RUN_TEST(test_pin_ops);
+    RUN_TEST(test_single_op_padded);
+    RUN_TEST(test_tick);
+    RUN_TEST(test_stops_at_other_op);
+    RUN_TEST(test_long_run_blocks);
+    RUN_TEST(test_last_block_single_padded);
+    RUN_TEST(test_buffer_full);
+
+    printf("\n=== Results: %d/%d passed", tests_passed, tests_run);
+    if (tests_failed > 0) {
+        printf(", %d FAILED", tests_failed);
+    }
+    printf(" ===\n\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1 @@
+cd "$(dirname "$0")/.." && gcc -O2 -Wall -Wextra -Wpedantic -Isrc -o tests/test_bitbang_seq tests/test_bitbang_seq.c src/pirate/bitbang_seq.c && ./tests/test_bitbang_seq
\ No newline at end of file
@@ -0,0 +1,275 @@
+/**
+ * @file test_ir_pack.c
+ * @brief Host-side test for the .irz infrared pulse train format
+ *
+ * Encodes MARK/SPACE frames, decodes them back and checks the encoder's
+ * choice between plain deltas and the pair dictionary, frames stored back
+ * to back, and that cut short or corrupt input is rejected.
+ *
+ * Build & run:
+ *   gcc -O2 -Wall -Wextra -Isrc \
+ *       -o tests/test_ir_pack tests/test_ir_pack.c src/pirate/ir_pack.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pirate/ir_pack.h"
+
+/* ------------------------------------------------------------------ */
+/* Test infrastructure                                                */
+/* ------------------------------------------------------------------ */
+
+#define TEST_PASS  0
+#define TEST_FAIL  1
+
+static int tests_run    = 0;
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define RUN_TEST(fn)                                                    \
+    do {                                                                \
+        tests_run++;                                                    \
+        printf("  [RUN]  %s\n", #fn);                                  \
+        if ((fn)() == TEST_PASS) {                                      \
+            tests_passed++;                                             \
+            printf("  [PASS] %s\n", #fn);                               \
+        } else {                                                        \
+            tests_failed++;                                             \
+            printf("  [FAIL] %s\n", #fn);                               \
+        }                                                               \
+    } while (0)
+
+#define ASSERT_TRUE(cond, msg)                                          \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            printf("    ASSERT FAILED: %s (%s:%d)\n",                   \
+                   msg, __FILE__, __LINE__);                            \
+            return TEST_FAIL;                                           \
+        }                                                               \
+    } while (0)
+
+#define ASSERT_EQ(a, b, msg)                                            \
+    do {                                                                \
+        if ((a) != (b)) {                                               \
+            printf("    ASSERT_EQ FAILED: %s  (%u != %u) (%s:%d)\n",   \
+                   msg, (unsigned)(a), (unsigned)(b),                   \
+                   __FILE__, __LINE__);                                 \
+            return TEST_FAIL;                                           \
+        }                                                               \
+    } while (0)
+
+/* ------------------------------------------------------------------ */
+/* Frames                                                             */
+/* ------------------------------------------------------------------ */
+
+#define PAIR(mark, space) (((uint32_t)(mark) << 16) | (space))
+
+static uint8_t packed[4 * IR_PACK_MAX_FRAME];
+static uint32_t decoded[IR_PACK_MAX_PAIRS];
+
+/* NEC: leader, 32 bits, stop bit with the long gap */
+static uint32_t nec(uint32_t* pairs, uint32_t code) {
+    uint32_t n = 0;
+    pairs[n++] = PAIR(9000, 4500);
+    for (int i = 0; i < 32; i++) {
+        pairs[n++] = PAIR(562, ((code >> i) & 1) ? 1687 : 562);
+    }
+    pairs[n++] = PAIR(562, 40000);
+    return n;
+}
+
+static uint32_t rng = 12345;
+static uint32_t next_random(void) {
+    rng = rng * 1103515245u + 12345u;
+    return rng >> 8;
+}
+
+/* encode, decode and compare, returns the encoded length or 0 on a mismatch */
+static uint32_t round_trip(const struct ir_pack_frame* frame, const uint32_t* pairs) {
+    struct ir_pack_frame out;
+    uint32_t len = ir_pack_encode(frame, pairs, packed);
+    if (!len || len > IR_PACK_MAX_FRAME) {
+        return 0;
+    }
+    if (ir_pack_decode(packed, len, &out, decoded, IR_PACK_MAX_PAIRS) != len) {
+        return 0;
+    }
+    if (out.carrier_hz != frame->carrier_hz || out.tick_us != frame->tick_us || out.count != frame->count) {
+        return 0;
+    }
+    if (memcmp(decoded, pairs, frame->count * sizeof(uint32_t))) {
+        return 0;
+    }
+    return len;
+}
+
+/* ------------------------------------------------------------------ */
+/* Tests                                                              */
+/* ------------------------------------------------------------------ */
+
+static int test_nec_dictionary(void) {
+    uint32_t pairs[64];
+    struct ir_pack_frame frame = { .carrier_hz = 38000, .tick_us = 1 };
+    frame.count = nec(pairs, 0x20df10ef);
+
+    uint32_t len = round_trip(&frame, pairs);
+    ASSERT_TRUE(len, "round trip");
+    /* 4 distinct pairs with 2 bit indexes, the entry count follows
+     * the 3 byte carrier, tick and count */
+    ASSERT_EQ(packed[5], 4, "dictionary with 4 entries");
+    ASSERT_TRUE(len < 50, "NEC packs under 50 bytes");
+    return TEST_PASS;
+}
+
+static int test_plain_distinct(void) {
+    /* slowly drifting durations, no repeats: deltas beat a dictionary */
+    uint32_t pairs[100];
+    for (uint32_t i = 0; i < 100; i++) {
+        pairs[i] = PAIR(500 + i * 3, 800 + i * 5);
+    }
+    struct ir_pack_frame frame = { .carrier_hz = 36000, .tick_us = 1, .count = 100 };
+
+    uint32_t len = round_trip(&frame, pairs);
+    ASSERT_TRUE(len, "round trip");
+    ASSERT_EQ(packed[5], 0, "plain frame");
+    return TEST_PASS;
+}
+
+static int test_single_pair_and_limits(void) {
+    uint32_t pairs[IR_PACK_MAX_PAIRS + 1];
+    for (uint32_t i = 0; i <= IR_PACK_MAX_PAIRS; i++) {
+        pairs[i] = PAIR(0xffff, 0xffff - i);
+    }
+    struct ir_pack_frame frame = { .carrier_hz = 0, .tick_us = 10, .count = 1 };
+    ASSERT_TRUE(round_trip(&frame, pairs), "one pair, largest durations");
+
+    frame.count = IR_PACK_MAX_PAIRS;
+    ASSERT_TRUE(round_trip(&frame, pairs), "most pairs");
+
+    frame.count = 0;
+    ASSERT_EQ(ir_pack_encode(&frame, pairs, packed), 0, "no pairs");
+    frame.count = IR_PACK_MAX_PAIRS + 1;
+    ASSERT_EQ(ir_pack_encode(&frame, pairs, packed), 0, "too many pairs");
+    return TEST_PASS;
+}
+
+static int test_back_to_back(void) {
+    uint32_t pairs[3][64];
+    struct ir_pack_frame frames[3] = {
+        { .carrier_hz = 38000, .tick_us = 1 },
+        { .carrier_hz = 40000, .tick_us = 10 },
+        { .carrier_hz = 0, .tick_us = 1 },
+    };
+    uint32_t total = 0;
+    for (int f = 0; f < 3; f++) {
+        frames[f].count = nec(pairs[f], 0x12345678u * (f + 1));
+        total += ir_pack_encode(&frames[f], pairs[f], &packed[total]);
+    }
+
+    uint32_t pos = 0;
+    for (int f = 0; f < 3; f++) {
+        struct ir_pack_frame out;
+        uint32_t used = ir_pack_decode(&packed[pos], total - pos, &out, decoded, IR_PACK_MAX_PAIRS);
+        ASSERT_TRUE(used, "frame decodes");
+        ASSERT_EQ(out.carrier_hz, frames[f].carrier_hz, "carrier");
+        ASSERT_EQ(out.tick_us, frames[f].tick_us, "tick");
+        ASSERT_EQ(out.count, frames[f].count, "count");
+        ASSERT_TRUE(!memcmp(decoded, pairs[f], out.count * sizeof(uint32_t)), "pairs");
+        pos += used;
+    }
+    ASSERT_EQ(pos, total, "all bytes used");
+    return TEST_PASS;
+}
+
+static int test_cut_short(void) {
+    uint32_t pairs[64];
+    struct ir_pack_frame frame = { .carrier_hz = 38000, .tick_us = 1 }, out;
+    frame.count = nec(pairs, 0xa55a00ff);
+    uint32_t len = ir_pack_encode(&frame, pairs, packed);
+
+    for (uint32_t i = 0; i < len; i++) {
+        ASSERT_EQ(ir_pack_decode(packed, i, &out, decoded, IR_PACK_MAX_PAIRS), 0, "cut short");
+    }
+    ASSERT_EQ(ir_pack_decode(packed, len, &out, decoded, frame.count - 1), 0, "no room for the pairs");
+    return TEST_PASS;
+}
+
+static int test_corrupt(void) {
+    struct ir_pack_frame out;
+
+    /* 3 entries, 2 bit indexes, the second index is 3 */
+    const uint8_t bad_index[] = { 0, 1, 2, 3, 1, 1, 1, 1, 1, 1, 0x30 };
+    ASSERT_EQ(ir_pack_decode(bad_index, sizeof(bad_index), &out, decoded, IR_PACK_MAX_PAIRS), 0,
+              "index past the dictionary");
+
+    /* more entries than pairs */
+    const uint8_t bad_entries[] = { 0, 1, 1, 2, 1, 1, 1, 1, 0x00 };
+    ASSERT_EQ(ir_pack_decode(bad_entries, sizeof(bad_entries), &out, decoded, IR_PACK_MAX_PAIRS), 0,
+              "dictionary bigger than the frame");
+
+    /* plain MARK delta of +0x10000 */
+    const uint8_t too_long[] = { 0, 1, 1, 0, 0x80, 0x80, 0x08, 0 };
+    ASSERT_EQ(ir_pack_decode(too_long, sizeof(too_long), &out, decoded, IR_PACK_MAX_PAIRS), 0,
+              "duration over 16 bits");
+
+    /* a varint that never ends */
+    const uint8_t endless[] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 1, 1, 0 };
+    ASSERT_EQ(ir_pack_decode(endless, sizeof(endless), &out, decoded, IR_PACK_MAX_PAIRS), 0,
+              "varint over 32 bits");
+    return TEST_PASS;
+}
+
+static int test_random_round_trips(void) {
+    uint32_t pairs[IR_PACK_MAX_PAIRS];
+    for (int iter = 0; iter < 5000; iter++) {
+        struct ir_pack_frame frame = {
+            .carrier_hz = next_random() % 60000,
+            .tick_us = 1 + next_random() % 20,
+            .count = 1 + next_random() % IR_PACK_MAX_PAIRS,
+        };
+        /* a few distinct pairs favour the dictionary, many favour deltas */
+        uint32_t distinct = 1 + next_random() % (iter & 1 ? 4 : IR_PACK_MAX_PAIRS);
+        uint32_t palette[IR_PACK_MAX_PAIRS];
+        for (uint32_t i = 0; i < distinct; i++) {
+            palette[i] = PAIR(next_random() & 0xffff, next_random() & 0xffff);
+        }
+        for (uint32_t i = 0; i < frame.count; i++) {
+            pairs[i] = palette[next_random() % distinct];
+        }
+        ASSERT_TRUE(round_trip(&frame, pairs), "random frame");
+    }
+    return TEST_PASS;
+}
+
+static int test_file_name(void) {
+    ASSERT_TRUE(ir_pack_file_name("tv.irz"), ".irz");
+    ASSERT_TRUE(ir_pack_file_name("TV.IRZ"), "upper case");
+    ASSERT_TRUE(!ir_pack_file_name("tv.air"), "aIR text");
+    ASSERT_TRUE(!ir_pack_file_name(".irz"), "no name");
+    ASSERT_TRUE(!ir_pack_file_name("irz"), "no extension");
+    return TEST_PASS;
+}
+
+/* ------------------------------------------------------------------ */
+
+int main(void) {
+    printf("\n=== IR Pack Test Suite ===\n\n");
+
+    RUN_TEST(test_nec_dictionary);
+    RUN_TEST(test_plain_distinct);
+    RUN_TEST(test_single_pair_and_limits);
+    RUN_TEST(test_back_to_back);
+    RUN_TEST(test_cut_short);
+    RUN_TEST(test_corrupt);
+    RUN_TEST(test_random_round_trips);
+    RUN_TEST(test_file_name);
+
+    printf("\n=== Results: %d/%d passed", tests_passed, tests_run);
+    if (tests_failed > 0) {
+        printf(", %d FAILED", tests_failed);
+    }
+    printf(" ===\n\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1 @@
+cd "$(dirname "$0")/.." && gcc -O2 -Wall -Wextra -Wpedantic -Isrc -o tests/test_ir_pack tests/test_ir_pack.c src/pirate/ir_pack.c && ./tests/test_ir_pack
\ No newline at end of file
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Pack the TV-B-Gone POWER code table into the ir_pack format.
+
+Reads the Adafruit style table (struct IrCode with a times table and bit
+packed indexes, as in tvbgone-codes.h before it was packed) and writes a C
+header with all NApowerCodes frames back to back, see src/pirate/ir_pack.h.
+Durations stay in the original 10us units, the frames have tick_us = 10.
+
+    python3 tools/tvbgone_pack.py old-tvbgone-codes.h src/commands/infrared/tvbgone-codes.h
+"""
+import re
+import sys
+
+TICK_US = 10
+HEADER = '''/*
+TV-B-Gone POWER codes for the Bus Pirate tvbgone command.
+
+Codes captured from Generation 3 TV-B-Gone by Limor Fried & Mitch Altman,
+ported to PIC C18 by Ian Lesnet 2009 (see modified Perl script parsegen3.pl).
+
+TV-B-Gone Firmware version 1.2
+for use with ATtiny85v and v1.2 hardware
+(c) Mitch Altman + Limor Fried 2009
+
+Distributed under Creative Commons 2.5 -- Attib & Share Alike
+
+Generated by tools/tvbgone_pack.py, do not edit. Each code is one ir_pack
+frame (see pirate/ir_pack.h) with durations in {tick}us ticks, the frames are
+stored back to back in NApowerCodes order.
+{sizes}
+*/
+
+#define NUM_NA_CODES {count}
+
+const uint8_t tvbgone_na_codes[] = {{
+{data}}};
+'''
+
+
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7f) | 0x80)
+        v >>= 7
+    out.append(v)
+    return out
+
+
+def zigzag(v):
+    return v << 1 if v >= 0 else ((-v) << 1) - 1
+
+
+def encode(carrier, tick, pairs):
+    """Same choice as ir_pack_encode(): plain deltas or a sorted pair dictionary."""
+    plain = bytearray()
+    mark = space = 0
+    for m, s in pairs:
+        plain += varint(zigzag(m - mark)) + varint(zigzag(s - space))
+        mark, space = m, s
+    plain = varint(0) + plain
+
+    entries = sorted(set(pairs))
+    bits = (len(entries) - 1).bit_length()
+    packed = bytearray(varint(len(entries)))
+    mark = 0
+    for m, s in entries:
+        packed += varint(m - mark) + varint(s)
+        mark = m
+    acc = acc_bits = 0
+    for p in pairs:
+        acc = (acc << bits) | entries.index(p)
+        acc_bits += bits
+        while acc_bits >= 8:
+            acc_bits -= 8
+            packed.append((acc >> acc_bits) & 0xff)
+    if acc_bits:
+        packed.append((acc << (8 - acc_bits)) & 0xff)
+
+    body = packed if len(packed) < len(plain) else plain
+    return varint(carrier) + varint(tick) + varint(len(pairs)) + body
+
+
+def parse(src):
+    src = re.sub(r'/\*.*?\*/', '', src, flags=re.S)
+    src = re.sub(r'//[^\n]*', '', src)
+    # the old size: each times and samples array once at its element size
+    # (codes share times tables), a 12 byte struct IrCode for every code and
+    # a 4 byte pointer for each NApowerCodes entry
+    old = 0
+    arrays = {}
+    for m in re.finditer(r'const uint(8|16)_t (\w+)\[\] = \{(.*?)\};', src, re.S):
+        arrays[m.group(2)] = [int(x, 0) for x in re.findall(r'0x[0-9a-fA-F]+|\d+', m.group(3))]
+        old += len(arrays[m.group(2)]) * int(m.group(1)) // 8
+    codes = {}
+    for m in re.finditer(r'const struct IrCode (\w+) = \{(.*?)\};', src, re.S):
+        f = re.match(r'\s*freq_to_timerval\((\d+)\),\s*(\d+),\s*(\d+),\s*(\w+),\s*(\w+)', m.group(2))
+        codes[m.group(1)] = (int(f.group(1)), int(f.group(2)), int(f.group(3)), arrays[f.group(4)], arrays[f.group(5)])
+        old += 12
+    table = re.search(r'NApowerCodes\[\]\s*=\s*\{(.*?)\};', src, re.S).group(1)
+    names = re.findall(r'&(\w+)', table)
+    old += len(names) * 4
+    return [codes[name] for name in names], old
+
+
+def unpack(numpairs, bits, times, samples):
+    acc = int.from_bytes(bytes(samples), 'big')
+    total = len(samples) * 8
+    pairs = []
+    for i in range(numpairs):
+        index = (acc >> (total - (i + 1) * bits)) & ((1 << bits) - 1)
+        pairs.append((times[index * 2], times[index * 2 + 1]))
+    return pairs
+
+
+def main():
+    src = open(sys.argv[1], encoding='latin1').read()
+    codes, old = parse(src)
+    data = bytearray()
+    for freq, numpairs, bits, times, samples in codes:
+        data += encode(freq, TICK_US, unpack(numpairs, bits, times, samples))
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append('    ' + ' '.join('0x%02x,' % b for b in data[i:i + 16]) + '\n')
+    sizes = '\n%d codes, %d bytes (%d bytes as struct IrCode tables).' % (len(codes), len(data), old)
+    out = HEADER.format(tick=TICK_US, sizes=sizes, count=len(codes), data=''.join(rows))
+    open(sys.argv[2], 'w', newline='\n').write(out)
+    print(sizes.strip())
+
+
+if __name__ == '__main__':
+    main()